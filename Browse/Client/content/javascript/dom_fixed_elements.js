@@ -26,6 +26,7 @@ function FixedElement(node)
     /* Attributes */
     this.node = node;
     this.rects = [];
+    this.topmost = false; // whether node is known to be on top of page at its rects
     
     this.node.setAttribute("fixedId", this.id);
 
@@ -68,6 +69,7 @@ FixedElement.prototype.updateRects = function(){
     {
         var previous_rects = this.rects;
         this.rects = [[0,0,0,0]];
+        this.topmost = false;
         return !EqualClientRectsData(this.rects, previous_rects);
     }
 
@@ -148,11 +150,20 @@ FixedElement.prototype.updateRects = function(){
         }
     );
             
+    // Check whether fixed subtree receives pointer events at its rects. Page may put fixed elements below
+    // content, e.g. as background, or let pointer events pass through them
+    var topmost = (domRectList.length > 0);
+    for(var i = 0; i < domRectList.length && topmost; i++)
+    {
+        topmost = this.isTopmostAt(domRectList[i]);
+    }
+
     // Check if Rect data changed, if yes, inform CEF about changes
-    var changed = !EqualClientRectsData(this.rects, updatedRectsData);
+    var changed = !EqualClientRectsData(this.rects, updatedRectsData) || topmost !== this.topmost;
 
     // Save updated rect data in FixedElement objects attribute
     this.rects = updatedRectsData;
+    this.topmost = topmost;
 
     if(changed)
         // Inform CEF that fixed element has been updated
@@ -161,6 +172,30 @@ FixedElement.prototype.updateRects = function(){
     return changed;
 }
 
+FixedElement.prototype.isTopmost = function(){
+    return this.topmost;
+}
+
+// Sample center and corners of rect, moved inside by one pixel. Points outside of viewport do not count as topmost
+FixedElement.prototype.isTopmostAt = function(rect){
+    if(rect.width <= 2 || rect.height <= 2)
+        return false;
+
+    var points = [
+        [(rect.left + rect.right) / 2, (rect.top + rect.bottom) / 2],
+        [rect.left + 1, rect.top + 1],
+        [rect.right - 1, rect.top + 1],
+        [rect.right - 1, rect.bottom - 1],
+        [rect.left + 1, rect.bottom - 1]];
+    for(var i = 0; i < points.length; i++)
+    {
+        var hit = document.elementFromPoint(points[i][0], points[i][1]);
+        if(hit === null || !this.node.contains(hit))
+            return false;
+    }
+    return true;
+}
+
 // TODO: Get rid of this function and only use object constructor?
 function AddFixedElement(node)
 {
@@ -42,6 +42,7 @@ function DOMNode(node, id, type, cef_hidden=false)
 
     this.rects = []
     this.bitmask = [0];
+    this.occlusionProbing = true; // C++ disables probing for nodes whose occlusion it decides itself
     // MutationObserver will handle setting up the following references, if necessary
     this.fixObj = undefined;
     this.overflow = undefined;  // TODO: Rename to overflowObj for consistency?
@@ -145,11 +146,21 @@ DOMNode.prototype.updateRects = function(altNode){
     }
     UpdateRectUpdateTimer(t0);
     
-    this.updateOccBitmask(altNode);
+    if(this.occlusionProbing)
+        this.updateOccBitmask(altNode);
+    else
+        CountSkippedBitmask();
     
     return rects_changed; // No update needed, no changes
 }
 
+// Called by C++, which only lets Javascript probe occlusion when it cannot decide it itself
+DOMNode.prototype.setOcclusionProbing = function(probing){
+    this.occlusionProbing = probing;
+    if(probing)
+        this.updateOccBitmask();
+}
+
 DOMNode.prototype.updateOccBitmask = function(altNode, debug){
     var t1 = performance.now();
     var bm = [];
@@ -28,6 +28,15 @@ function SendToMsgRouter(msg)
     ConsolePrint(msg);
 }
 
+// Set by C++ when latency of cefQuery should be measured
+var latencyProbing = false;
+
+// Send current time to C++, which measures latency of cefQuery until handling
+function SendLatencyProbe()
+{
+    ConsolePrint("latency#" + (performance.timing.navigationStart + performance.now()));
+}
+
 ConsolePrint("Starting to import helpers.js ...");
 
 
@@ -80,13 +89,18 @@ function CefPoll(num_partitions, update_partition)
                 if(typeof(o.updateRects()) === "function")
                     o.updateRects();
 
-                SendAttributeChangesToCEF("OccBitmask", o);
+                if(o.occlusionProbing)
+                    SendAttributeChangesToCEF("OccBitmask", o);
                 SendAttributeChangesToCEF("Rects", o); // For language list on wikipedia.org main page, for example
             } 
         });
     });
 
 
+    UpdatePollTimer(t_start);
+    if(latencyProbing)
+        SendLatencyProbe();
+
     // DISABLED FOR DEBUGGING
     if(!partitioned)
         console.log("Took ", performance.now() - t_start, "ms.");
@@ -561,6 +575,20 @@ function UpdateRectUpdateTimer(t0)
 function UpdateBitmaskTimer(t0)
 {
     time_spent_creating_bitmask += (performance.now() - t0);
+    bitmask_count++;
+}
+var bitmask_count = 0;
+var bitmask_skipped_count = 0;
+function CountSkippedBitmask()
+{
+    bitmask_skipped_count++;
+}
+var time_spent_polling = 0.0;
+var poll_count = 0;
+function UpdatePollTimer(t0)
+{
+    time_spent_polling += (performance.now() - t0);
+    poll_count++;
 }
 function PrintPerformanceInformation()
 {
@@ -574,6 +602,9 @@ function PrintPerformanceInformation()
     ConsolePrint('### Bitmask creation: \t'+Math.round(time_spent_creating_bitmask / 1000)+'s / '+
         Math.round(time_spent_creating_bitmask * 1000) / 1000 +'ms -- '+
             100*Math.round(time_spent_creating_bitmask/window.page_load_time_*1000)/1000 +'% of page load time');
+    ConsolePrint('### Bitmask probing: \t'+bitmask_count+' probed, '+bitmask_skipped_count+' decided by C++');
+    if(poll_count > 0)
+        ConsolePrint('### Polling: \t'+poll_count+' polls, '+Math.round(time_spent_polling / poll_count * 1000) / 1000+'ms per poll');
 }
 
 function SendFaviconURLtoCEF(url)
@@ -23,6 +23,49 @@ const std::vector<DOMAttribute> DOMNode::_description = {
 	Rects, FixedId, OverflowId, OccBitmask
 };
 
+DOMNode::~DOMNode()
+{
+	if (auto spRectStore = _wpRectStore.lock())
+	{
+		spRectStore->Release(_rectSlot);
+	}
+}
+
+void DOMNode::SetRectStore(std::shared_ptr<DOMRectStore> spRectStore)
+{
+	_wpRectStore = spRectStore;
+	_rectSlot = spRectStore->Allocate();
+	spRectStore->SetRects(_rectSlot, _rects);
+	spRectStore->SetFixed(_rectSlot, IsFixed());
+}
+
+RectSpan DOMNode::GetViewportRects() const
+{
+	if (auto spRectStore = _wpRectStore.lock())
+	{
+		return spRectStore->GetViewportRects(_rectSlot);
+	}
+	return RectSpan();
+}
+
+void DOMNode::SetRects(std::vector<Rect> rects)
+{
+	_rects = rects;
+	if (auto spRectStore = _wpRectStore.lock())
+	{
+		spRectStore->SetRects(_rectSlot, _rects);
+	}
+}
+
+void DOMNode::SetFixedId(int fixedId)
+{
+	_fixedId = fixedId;
+	if (auto spRectStore = _wpRectStore.lock())
+	{
+		spRectStore->SetFixed(_rectSlot, IsFixed());
+	}
+}
+
 int DOMNode::Initialize(CefRefPtr<CefProcessMessage> msg)
 {
 	const auto args = msg->GetArgumentList();
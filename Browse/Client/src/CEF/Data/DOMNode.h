@@ -13,6 +13,7 @@
 
 #include "src/CEF/Data/DOMNodeInteraction.h"
 #include "src/CEF/Data/Rect.h"
+#include "src/CEF/Data/DOMRectStore.h"
 #include "src/Utils/glmWrapper.h"
 #include "src/CEF/Data/DOMAttribute.h"
 #include "include/cef_process_message.h"
@@ -47,6 +48,12 @@ public:
 	DOMNode(int id) :
         _id(id) {}
 
+	// Destructor, releases slot in rect store
+	virtual ~DOMNode();
+
+	// Keep rects also in store of Tab, which projects them into viewport
+	void SetRectStore(std::shared_ptr<DOMRectStore> spRectStore);
+
 	// Define initialization through IPC message in each DOMNode subclass
 	virtual int Initialize(CefRefPtr<CefProcessMessage> msg);
 
@@ -65,18 +72,29 @@ public:
 	virtual int GetId() override { return _id; }
 
 	// Custom final getter
-	std::vector<Rect> GetRects() const { return _rects; }
+	const std::vector<Rect>& GetRects() const { return _rects; }
+	RectSpan GetViewportRects() const; // empty without rect store
 	int GetFixedId() const { return _fixedId; }
 	int GetOverflowId() const { return _overflowId; }
 	bool IsFixed() const { return (_fixedId >= 0); }
-	bool IsOccluded() const { return _occluded; }
+	bool IsOccluded() const { return (_occlusion == Occlusion::UNDECIDED) ? _occluded : (_occlusion == Occlusion::OCCLUDED); }
+	bool IsOccludedInJavascript() const { return _occluded; }
+
+	// Occlusion decided on browser side. Bitmask from Javascript is used while undecided
+	enum class Occlusion { UNDECIDED, VISIBLE, OCCLUDED };
+	void SetOcclusion(Occlusion occlusion) { _occlusion = occlusion; }
+	Occlusion GetOcclusion() const { return _occlusion; }
+
+	// Whether Javascript probes occlusion of this node. Only bookkeeping, Tab informs Javascript
+	void SetOcclusionProbing(bool probing) { _occlusionProbing = probing; }
+	bool IsOcclusionProbing() const { return _occlusionProbing; }
 
 private:
 
 	// Setter
 	void SetId(int id) { _id = id; }
-	void SetRects(std::vector<Rect> rects) { _rects = rects; }
-	void SetFixedId(int fixedId) { _fixedId = fixedId; }
+	void SetRects(std::vector<Rect> rects);
+	void SetFixedId(int fixedId);
 	void SetOverflowId(int overflowId) { _overflowId = overflowId; }
 	void SetOccBitmask(std::vector<bool> bitmask) { 
 		_occBitmask = bitmask; 
@@ -100,6 +118,10 @@ private:
 	int _overflowId = -1;	// first DOMOverflowElement's ID, which is hierarchically above this node, if any
 	std::vector<bool> _occBitmask;
 	bool _occluded = false; // true if occluded
+	Occlusion _occlusion = Occlusion::UNDECIDED;
+	bool _occlusionProbing = true; // Javascript probes by default
+	std::weak_ptr<DOMRectStore> _wpRectStore;
+	DOMRectStore::Slot _rectSlot = -1;
 };
 
 /*
@@ -0,0 +1,180 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Generational slot map of DOM nodes of one type, keyed by the id given by
+// Javascript. Ids are indices into Javascript arrays, so lookup is a plain
+// array access. Ids beyond DOM_NODE_SLOT_MAP_DIRECT_IDS are looked up in a
+// hash map, so a single large id does not allocate slots for all ids below.
+// Nodes are kept densely for iteration. Handles carry the generation of their
+// node and become dead when the node is removed.
+
+#ifndef DOMNODESLOTMAP_H_
+#define DOMNODESLOTMAP_H_
+
+#include "src/Global.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+// Stable handle onto node in slot map
+struct DOMNodeHandle
+{
+	int id = -1;
+	unsigned int generation = 0;
+};
+
+template<typename T>
+class DOMNodeSlotMap
+{
+public:
+
+	// Iteration goes over dense array of nodes
+	typedef typename std::vector<std::shared_ptr<T> >::const_iterator const_iterator;
+
+	// Add node with id. Replaces node which has been stored with same id
+	DOMNodeHandle Emplace(int id, std::shared_ptr<T> spNode)
+	{
+		if (id < 0 || !spNode) { return DOMNodeHandle(); }
+		Slot& rSlot = AcquireSlot(id);
+		rSlot.generation = ++_generation; // invalidates handles of previous node
+		if (rSlot.dense >= 0)
+		{
+			_nodes[rSlot.dense] = spNode;
+		}
+		else
+		{
+			rSlot.dense = (int)_nodes.size();
+			_nodes.push_back(spNode);
+			_ids.push_back(id);
+		}
+		return GetHandle(id);
+	}
+
+	// Remove node with id. Last node is moved into gap
+	void Erase(int id)
+	{
+		Slot* pSlot = FindSlot(id);
+		if (pSlot == nullptr) { return; }
+		const int dense = pSlot->dense;
+		const int last = (int)_nodes.size() - 1;
+		if (dense != last)
+		{
+			_nodes[dense] = std::move(_nodes[last]);
+			_ids[dense] = _ids[last];
+			FindSlot(_ids[dense])->dense = dense;
+		}
+		_nodes.pop_back();
+		_ids.pop_back();
+		if (id < DOM_NODE_SLOT_MAP_DIRECT_IDS)
+		{
+			pSlot->dense = -1;
+		}
+		else
+		{
+			_sparseSlots.erase(id);
+		}
+	}
+
+	// Remove all nodes and release slots. Generations keep counting, so handles to removed nodes stay dead
+	void Clear()
+	{
+		_slots.clear();
+		_slots.shrink_to_fit();
+		_sparseSlots.clear();
+		_nodes.clear();
+		_nodes.shrink_to_fit();
+		_ids.clear();
+		_ids.shrink_to_fit();
+	}
+
+	// Whether node with id is stored
+	bool Contains(int id) const
+	{
+		return FindSlot(id) != nullptr;
+	}
+
+	// Get node by id. Returns empty pointer if not stored
+	const std::shared_ptr<T>& Find(int id) const
+	{
+		const Slot* pSlot = FindSlot(id);
+		return pSlot != nullptr ? _nodes[pSlot->dense] : _empty;
+	}
+
+	// Get handle of node with id. Handle of missing node is dead
+	DOMNodeHandle GetHandle(int id) const
+	{
+		DOMNodeHandle handle;
+		if (const Slot* pSlot = FindSlot(id))
+		{
+			handle.id = id;
+			handle.generation = pSlot->generation;
+		}
+		return handle;
+	}
+
+	// Get node by handle. Returns empty pointer if node of handle has been removed or replaced
+	const std::shared_ptr<T>& Get(DOMNodeHandle handle) const
+	{
+		const Slot* pSlot = FindSlot(handle.id);
+		return (pSlot != nullptr && pSlot->generation == handle.generation) ? _nodes[pSlot->dense] : _empty;
+	}
+
+	// Whether node of handle is still stored
+	bool IsAlive(DOMNodeHandle handle) const
+	{
+		const Slot* pSlot = FindSlot(handle.id);
+		return pSlot != nullptr && pSlot->generation == handle.generation;
+	}
+
+	// Access like on container
+	const_iterator begin() const { return _nodes.begin(); }
+	const_iterator end() const { return _nodes.end(); }
+	size_t size() const { return _nodes.size(); }
+	bool empty() const { return _nodes.empty(); }
+
+private:
+
+	// Slot per id with index into dense arrays
+	struct Slot
+	{
+		int dense = -1;
+		unsigned int generation = 0;
+	};
+
+	// Get slot of stored node. Returns null if no node is stored with id
+	const Slot* FindSlot(int id) const
+	{
+		if (id < 0) { return nullptr; }
+		if (id < DOM_NODE_SLOT_MAP_DIRECT_IDS)
+		{
+			return (id < (int)_slots.size() && _slots[id].dense >= 0) ? &_slots[id] : nullptr;
+		}
+		auto it = _sparseSlots.find(id);
+		return it != _sparseSlots.end() ? &it->second : nullptr;
+	}
+	Slot* FindSlot(int id)
+	{
+		return const_cast<Slot*>(static_cast<const DOMNodeSlotMap*>(this)->FindSlot(id));
+	}
+
+	// Get slot for id, creates it if necessary
+	Slot& AcquireSlot(int id)
+	{
+		if (id < DOM_NODE_SLOT_MAP_DIRECT_IDS)
+		{
+			if (id >= (int)_slots.size()) { _slots.resize(id + 1); }
+			return _slots[id];
+		}
+		return _sparseSlots[id];
+	}
+
+	// Members
+	std::vector<Slot> _slots; // indexed by id below DOM_NODE_SLOT_MAP_DIRECT_IDS
+	std::unordered_map<int, Slot> _sparseSlots; // ids from DOM_NODE_SLOT_MAP_DIRECT_IDS on
+	std::vector<std::shared_ptr<T> > _nodes; // dense
+	std::vector<int> _ids; // dense, id of node at same index
+	unsigned int _generation = 0; // counts over all slots, so released slots cannot revive handles
+	std::shared_ptr<T> _empty;
+};
+
+#endif // DOMNODESLOTMAP_H_
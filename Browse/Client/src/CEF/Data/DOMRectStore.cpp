@@ -0,0 +1,145 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "DOMRectStore.h"
+#include <algorithm>
+
+DOMRectStore::Slot DOMRectStore::Allocate()
+{
+	// Reuse released slot if available
+	Slot slot;
+	if (!_freeSlots.empty())
+	{
+		slot = _freeSlots.back();
+		_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = (Slot)_used.size();
+		_offsets.push_back(0);
+		_counts.push_back(0);
+		_fixed.push_back(false);
+		_used.push_back(false);
+	}
+
+	// Initialize slot without rects
+	_offsets[slot] = (unsigned int)_pageRects.size();
+	_counts[slot] = 0;
+	_fixed[slot] = false;
+	_used[slot] = true;
+	return slot;
+}
+
+void DOMRectStore::Release(Slot slot)
+{
+	if (slot < 0 || slot >= (Slot)_used.size() || !_used[slot]) { return; }
+	_garbageCount += _counts[slot];
+	_counts[slot] = 0;
+	_used[slot] = false;
+	_freeSlots.push_back(slot);
+}
+
+void DOMRectStore::SetRects(Slot slot, const std::vector<Rect>& rRects)
+{
+	if (slot < 0 || slot >= (Slot)_used.size() || !_used[slot]) { return; }
+
+	// Overwrite in place when count stays the same, otherwise append at end
+	if (rRects.size() != _counts[slot])
+	{
+		_garbageCount += _counts[slot];
+		_offsets[slot] = (unsigned int)_pageRects.size();
+		_counts[slot] = (unsigned int)rRects.size();
+		_pageRects.resize(_pageRects.size() + rRects.size());
+		_viewportRects.resize(_pageRects.size());
+	}
+	std::copy(rRects.begin(), rRects.end(), _pageRects.begin() + _offsets[slot]);
+	ProjectSlot(slot);
+
+	// Get rid of rects which are no longer used
+	if (_garbageCount > _pageRects.size() / 2)
+	{
+		Compact();
+	}
+}
+
+void DOMRectStore::SetFixed(Slot slot, bool fixed)
+{
+	if (slot < 0 || slot >= (Slot)_used.size() || !_used[slot]) { return; }
+	if (_fixed[slot] != (char)fixed)
+	{
+		_fixed[slot] = fixed;
+		ProjectSlot(slot);
+	}
+}
+
+void DOMRectStore::Project(double scrollingOffsetX, double scrollingOffsetY)
+{
+	if (scrollingOffsetX == _scrollingOffsetX && scrollingOffsetY == _scrollingOffsetY) { return; }
+	_scrollingOffsetX = scrollingOffsetX;
+	_scrollingOffsetY = scrollingOffsetY;
+	for (Slot slot = 0; slot < (Slot)_used.size(); slot++)
+	{
+		if (_used[slot]) { ProjectSlot(slot); }
+	}
+}
+
+RectSpan DOMRectStore::GetPageRects(Slot slot) const
+{
+	if (slot < 0 || slot >= (Slot)_used.size() || !_used[slot] || _counts[slot] == 0) { return RectSpan(); }
+	const Rect* pBegin = _pageRects.data() + _offsets[slot];
+	return RectSpan(pBegin, pBegin + _counts[slot]);
+}
+
+RectSpan DOMRectStore::GetViewportRects(Slot slot) const
+{
+	if (slot < 0 || slot >= (Slot)_used.size() || !_used[slot] || _counts[slot] == 0) { return RectSpan(); }
+	const Rect* pBegin = _viewportRects.data() + _offsets[slot];
+	return RectSpan(pBegin, pBegin + _counts[slot]);
+}
+
+void DOMRectStore::ProjectSlot(Slot slot)
+{
+	// Fixed rects are already given in viewport coordinates
+	const float x = _fixed[slot] ? 0.f : (float)_scrollingOffsetX;
+	const float y = _fixed[slot] ? 0.f : (float)_scrollingOffsetY;
+	const unsigned int end = _offsets[slot] + _counts[slot];
+	for (unsigned int i = _offsets[slot]; i < end; i++)
+	{
+		const Rect& rRect = _pageRects[i];
+		_viewportRects[i] = Rect(rRect.top - y, rRect.left - x, rRect.bottom - y, rRect.right - x);
+	}
+}
+
+void DOMRectStore::Compact()
+{
+	// Collect used slots ordered by offset, so rects are only moved towards the front
+	std::vector<Slot> slots;
+	for (Slot slot = 0; slot < (Slot)_used.size(); slot++)
+	{
+		if (_used[slot]) { slots.push_back(slot); }
+	}
+	std::sort(slots.begin(), slots.end(), [this](Slot a, Slot b) { return _offsets[a] < _offsets[b]; });
+
+	// Move rects of used slots to the front
+	unsigned int offset = 0;
+	for (Slot slot : slots)
+	{
+		if (_offsets[slot] != offset)
+		{
+			std::copy(
+				_pageRects.begin() + _offsets[slot],
+				_pageRects.begin() + _offsets[slot] + _counts[slot],
+				_pageRects.begin() + offset);
+			std::copy(
+				_viewportRects.begin() + _offsets[slot],
+				_viewportRects.begin() + _offsets[slot] + _counts[slot],
+				_viewportRects.begin() + offset);
+			_offsets[slot] = offset;
+		}
+		offset += _counts[slot];
+	}
+	_pageRects.resize(offset);
+	_viewportRects.resize(offset);
+	_garbageCount = 0;
+}
@@ -0,0 +1,94 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Central storage of DOM node rects in page coordinates. Rects of all nodes
+// are kept in flat arrays, viewport rects are projected from them whenever
+// the scrolling offset changes. Spans are valid until next change of store.
+
+#ifndef DOMRECTSTORE_H_
+#define DOMRECTSTORE_H_
+
+#include "src/CEF/Data/Rect.h"
+#include <vector>
+
+// Read only view onto consecutive rects without copying them
+class RectSpan
+{
+public:
+
+	// Constructor
+	RectSpan(const Rect* pBegin = nullptr, const Rect* pEnd = nullptr) : _pBegin(pBegin), _pEnd(pEnd) {}
+
+	// Access like on vector
+	const Rect* begin() const { return _pBegin; }
+	const Rect* end() const { return _pEnd; }
+	size_t size() const { return (size_t)(_pEnd - _pBegin); }
+	bool empty() const { return _pBegin == _pEnd; }
+	const Rect& front() const { return *_pBegin; }
+	const Rect& operator[](size_t index) const { return _pBegin[index]; }
+
+private:
+
+	// Members
+	const Rect* _pBegin;
+	const Rect* _pEnd;
+};
+
+class DOMRectStore
+{
+public:
+
+	// Slot of one DOM node within store
+	typedef int Slot;
+
+	// Allocate slot for DOM node
+	Slot Allocate();
+
+	// Release slot of DOM node
+	void Release(Slot slot);
+
+	// Set rects of DOM node in page coordinates (or viewport coordinates when fixed)
+	void SetRects(Slot slot, const std::vector<Rect>& rRects);
+
+	// Set whether DOM node is fixed, so scrolling does not move it
+	void SetFixed(Slot slot, bool fixed);
+
+	// Project rects into viewport. Only does work when scrolling offset changed
+	void Project(double scrollingOffsetX, double scrollingOffsetY);
+
+	// Get rects of DOM node in page coordinates
+	RectSpan GetPageRects(Slot slot) const;
+
+	// Get rects of DOM node in viewport coordinates
+	RectSpan GetViewportRects(Slot slot) const;
+
+private:
+
+	// Project rects of single slot into viewport
+	void ProjectSlot(Slot slot);
+
+	// Remove rects of released or resized slots from arrays
+	void Compact();
+
+	// Structure of arrays indexed by slot
+	std::vector<unsigned int> _offsets;
+	std::vector<unsigned int> _counts;
+	std::vector<char> _fixed;
+	std::vector<char> _used;
+
+	// Released slots for reuse
+	std::vector<Slot> _freeSlots;
+
+	// Flat arrays of rects, ranges are given by offset and count of slot
+	std::vector<Rect> _pageRects;
+	std::vector<Rect> _viewportRects;
+
+	// Count of rects in arrays which do not belong to any slot
+	unsigned int _garbageCount = 0;
+
+	// Scrolling offset used for projection
+	double _scrollingOffsetX = 0;
+	double _scrollingOffsetY = 0;
+};
+
+#endif // DOMRECTSTORE_H_
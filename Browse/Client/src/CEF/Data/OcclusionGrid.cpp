@@ -0,0 +1,59 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "OcclusionGrid.h"
+#include <algorithm>
+#include <cmath>
+
+void OcclusionGrid::Reset(int width, int height, int cellSize)
+{
+	_width = std::max(0, width);
+	_height = std::max(0, height);
+	_cellSize = std::max(1, cellSize);
+	_columns = (_width + _cellSize - 1) / _cellSize;
+	_rows = (_height + _cellSize - 1) / _cellSize;
+	_cells.assign(_columns * _rows, Coverage::FREE);
+}
+
+void OcclusionGrid::Add(const Rect& rRect)
+{
+	if (rRect.IsZero()) { return; }
+
+	// Range of touched cells, clamped to grid
+	const float size = (float)_cellSize;
+	const int firstColumn = std::max(0, (int)std::floor(rRect.left / size));
+	const int lastColumn = std::min(_columns - 1, (int)std::floor(rRect.right / size));
+	const int firstRow = std::max(0, (int)std::floor(rRect.top / size));
+	const int lastRow = std::min(_rows - 1, (int)std::floor(rRect.bottom / size));
+
+	for (int row = firstRow; row <= lastRow; row++)
+	{
+		for (int column = firstColumn; column <= lastColumn; column++)
+		{
+			// Cell is full when rect contains its part within viewport completely
+			Coverage& rCell = _cells[row * _columns + column];
+			const float left = column * size;
+			const float top = row * size;
+			const float right = std::min(left + size, (float)_width);
+			const float bottom = std::min(top + size, (float)_height);
+			if (rRect.left <= left && rRect.right >= right && rRect.top <= top && rRect.bottom >= bottom)
+			{
+				rCell = Coverage::FULL;
+			}
+			else if (rCell == Coverage::FREE)
+			{
+				rCell = Coverage::PARTIAL;
+			}
+		}
+	}
+}
+
+OcclusionGrid::Coverage OcclusionGrid::Test(float x, float y) const
+{
+	if (x < 0 || y < 0) { return Coverage::FREE; }
+	const int column = (int)(x / _cellSize);
+	const int row = (int)(y / _cellSize);
+	if (column >= _columns || row >= _rows) { return Coverage::FREE; }
+	return _cells[row * _columns + column];
+}
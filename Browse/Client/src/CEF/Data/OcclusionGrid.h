@@ -0,0 +1,41 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Coarse occupancy grid over the viewport. Rects of fixed elements are
+// rasterized into it once per frame, so occlusion of DOM nodes can be tested
+// without asking Javascript. Cells are either free, partially or fully covered.
+
+#ifndef OCCLUSIONGRID_H_
+#define OCCLUSIONGRID_H_
+
+#include "src/CEF/Data/Rect.h"
+#include <vector>
+
+class OcclusionGrid
+{
+public:
+
+	// Coverage of single cell
+	enum class Coverage { FREE, PARTIAL, FULL };
+
+	// Clear grid and adapt it to viewport resolution
+	void Reset(int width, int height, int cellSize);
+
+	// Rasterize rect given in viewport coordinates
+	void Add(const Rect& rRect);
+
+	// Coverage of cell at viewport coordinates. Outside of viewport is free
+	Coverage Test(float x, float y) const;
+
+private:
+
+	// Members
+	std::vector<Coverage> _cells;
+	int _width = 0;
+	int _height = 0;
+	int _cellSize = 1;
+	int _columns = 0;
+	int _rows = 0;
+};
+
+#endif // OCCLUSIONGRID_H_
@@ -7,6 +7,7 @@
 #include "src/CEF/Handler.h"
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Logger.h"
+#include "src/Setup.h"
 #include "src/Singletons/JSMailer.h"
 #include "include/base/cef_bind.h"
 #include "include/cef_app.h"
@@ -43,7 +44,11 @@ void Handler::OnAfterCreated(CefRefPtr<CefBrowser> browser)
 
   // Add to the list of existing browsers.
   _browserList.push_back(browser);
+  ++_openBrowserCount;
   LogDebug("Handler: New CefBrowser with id = ", browser->GetIdentifier(), " created.");
+
+  // Assign browser to Tab which waits for it
+  _pMediator->OnBrowserCreated(browser);
 }
 
 bool Handler::DoClose(CefRefPtr<CefBrowser> browser)
@@ -72,6 +77,7 @@ void Handler::OnBeforeClose(CefRefPtr<CefBrowser> browser)
   CEF_REQUIRE_UI_THREAD();
 
   _msgRouter->OnBeforeClose(browser);
+  --_openBrowserCount;
 
    //Remove from the list of existing browsers.
   BrowserList::iterator bit = _browserList.begin();
@@ -155,6 +161,12 @@ void Handler::OnLoadEnd(CefRefPtr<CefBrowser> browser, CefRefPtr<CefFrame> frame
 		frame->ExecuteJavaScript(
 			"PrintPerformanceInformation();", "", 0);
 
+		// Let Javascript send latency probes with its polling
+		if (setup::CEF_QUERY_LATENCY_PROBE)
+		{
+			frame->ExecuteJavaScript("latencyProbing = true;", "", 0);
+		}
+
         // Set zoom level according to Tab's settings
         SetZoomLevel(browser, false);
 
@@ -294,8 +306,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 
 		if (type == "TextInput")
 		{
-			const auto& wpNode = _pMediator->GetDOMTextInput(browser, id);
-			if (const auto& node = wpNode.lock())
+			if (const auto& node = _pMediator->GetDOMTextInput(browser, id))
 			{
 				node->Initialize(msg);
 			}
@@ -303,8 +314,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 		}
 		if (type == "Link")
 		{
-			const auto& wpNode = _pMediator->GetDOMLink(browser, id);
-			if (const auto& node = wpNode.lock())
+			if (const auto& node = _pMediator->GetDOMLink(browser, id))
 			{
 				node->Initialize(msg);
 			}
@@ -312,8 +322,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 		}
 		if (type == "SelectField")
 		{
-			const auto& wpNode = _pMediator->GetDOMSelectField(browser, id);
-			if (const auto& node = wpNode.lock())
+			if (const auto& node = _pMediator->GetDOMSelectField(browser, id))
 			{
 				node->Initialize(msg);
 			}
@@ -321,8 +330,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 		}
 		if (type == "OverflowElement")
 		{
-			const auto& wpNode = _pMediator->GetDOMOverflowElement(browser, id);
-			if (const auto& node = wpNode.lock())
+			if (const auto& node = _pMediator->GetDOMOverflowElement(browser, id))
 			{
 				node->Initialize(msg);
 			}
@@ -331,8 +339,7 @@ bool Handler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 		// TODO: Refactor this.
 		if (type == "Checkbox")
 		{
-			const auto& wpNode = _pMediator->GetDOMCheckbox(browser, id);
-			if (const auto& node = wpNode.lock())
+			if (const auto& node = _pMediator->GetDOMCheckbox(browser, id))
 			{
 				node->Initialize(msg);
 			}
@@ -494,6 +501,52 @@ void Handler::ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser)
     browser->GetMainFrame()->ExecuteJavaScript(resetScrolling, browser->GetMainFrame()->GetURL(), 0);
 }
 
+void Handler::SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y)
+{
+    const std::string setScrolling = "window.scrollTo(" + std::to_string(x) + ", " + std::to_string(y) + ");";
+    browser->GetMainFrame()->ExecuteJavaScript(setScrolling, browser->GetMainFrame()->GetURL(), 0);
+}
+
+void Handler::PauseMainFramesMedia(CefRefPtr<CefBrowser> browser)
+{
+    // Mark media which was playing, so only that is resumed later
+    const std::string pauseMedia = "Array.prototype.forEach.call(document.querySelectorAll('video, audio'), function(media) { if(!media.paused) { media.pause(); media.pausedByFreeze = true; } });";
+    browser->GetMainFrame()->ExecuteJavaScript(pauseMedia, browser->GetMainFrame()->GetURL(), 0);
+}
+
+void Handler::ResumeMainFramesMedia(CefRefPtr<CefBrowser> browser)
+{
+    const std::string resumeMedia = "Array.prototype.forEach.call(document.querySelectorAll('video, audio'), function(media) { if(media.pausedByFreeze) { media.pausedByFreeze = false; media.play(); } });";
+    browser->GetMainFrame()->ExecuteJavaScript(resumeMedia, browser->GetMainFrame()->GetURL(), 0);
+}
+
+void Handler::GetNavigationURLs(CefRefPtr<CefBrowser> browser, std::vector<std::string>& rURLs, int& rCurrentIndex)
+{
+    // Visitor is executed synchronously, since Handler lives on the UI thread
+    class NavigationURLVisitor : public CefNavigationEntryVisitor
+    {
+    public:
+        NavigationURLVisitor(std::vector<std::string>& rURLs, int& rCurrentIndex) : _rURLs(rURLs), _rCurrentIndex(rCurrentIndex) {}
+
+        bool Visit(CefRefPtr<CefNavigationEntry> entry, bool current, int index, int total) OVERRIDE
+        {
+            if (current) { _rCurrentIndex = (int)_rURLs.size(); }
+            _rURLs.push_back(entry->GetURL().ToString());
+            return true;
+        }
+
+    private:
+        std::vector<std::string>& _rURLs;
+        int& _rCurrentIndex;
+
+        IMPLEMENT_REFCOUNTING(NavigationURLVisitor);
+    };
+
+    rURLs.clear();
+    rCurrentIndex = -1;
+    browser->GetHost()->GetNavigationEntries(new NavigationURLVisitor(rURLs, rCurrentIndex), false);
+}
+
 void Handler::SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged)
 {
 
@@ -581,9 +634,9 @@ void Handler::SendToJSLoggingMediator(std::string message)
 	
 }
 
-bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Handler::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefString img_url, CefRefPtr<CefImage> img)
 {
-	return _pMediator->ForwardFaviconBytes(browser, img);
+	return _pMediator->ForwardFaviconBytes(browser, img_url, img);
 }
 
 bool Handler::StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url)
@@ -15,6 +15,7 @@
 #include "src/CEF/RequestHandler.h"
 #include <list>
 #include <set>
+#include <vector>
 
 // Forward declaration
 class Mediator;
@@ -135,6 +136,12 @@ public:
 	void EmulateSelectAll(CefRefPtr<CefBrowser> browser);
     
     void ResetMainFramesScrolling(CefRefPtr<CefBrowser> browser);
+    void SetMainFramesScrolling(CefRefPtr<CefBrowser> browser, double x, double y);
+    void PauseMainFramesMedia(CefRefPtr<CefBrowser> browser);
+    void ResumeMainFramesMedia(CefRefPtr<CefBrowser> browser);
+
+    // Collect URLs of navigation entries, rCurrentIndex is index of currently displayed entry
+    void GetNavigationURLs(CefRefPtr<CefBrowser> browser, std::vector<std::string>& rURLs, int& rCurrentIndex);
 
     // Bool value indicates need to reload DOM node data, true when called from outside of Tab due to changes
     void SetZoomLevel(CefRefPtr<CefBrowser> browser, bool definitelyChanged = true);
@@ -162,11 +169,14 @@ public:
 	// Check if favicon was already loaded, if not download it
 	bool StartFaviconImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
 	// HandlerImageDownload interface methods
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefString img_url, CefRefPtr<CefImage> img);
 
 	// Decide whether to block ads
 	void BlockAds(bool blockAds) { _requestHandler->BlockAds(blockAds); }
 
+	// Browsers created and not yet closed
+	int GetOpenBrowserCount() const { return _openBrowserCount; }
+
 private:
 
     /* METHODS */
@@ -179,6 +189,8 @@ private:
     // List of existing browser windows. Only accessed on the CEF UI thread
     typedef std::list<CefRefPtr<CefBrowser> > BrowserList;
     BrowserList _browserList;
+    // Count of browsers between creation and close, unlike list above which is cleared at close request
+    int _openBrowserCount = 0;
     // Handler's current closing state
     bool _isClosing;
 
@@ -9,7 +9,7 @@
 #define IMAGEDOWNLOAD_H_
 
 #include "include/cef_browser.h"
-#include <algorithm>
+#include <map>
 
 class HandlerImageInterface;	// Forward declaration
 
@@ -35,14 +35,14 @@ private:
 class HandlerImageInterface
 {
 public:
-	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img) = 0;
+	virtual bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefString img_url, CefRefPtr<CefImage> img) = 0;
 
 	void StartImageDownload(CefRefPtr<CefBrowser> browser, CefString img_url);
 	void FinishImageDownload(CefRefPtr<PendingImageDownload> download);
 
 
 private:
-	std::vector< CefRefPtr<PendingImageDownload> > _downloads;
+	std::map<PendingImageDownload*, CefRefPtr<PendingImageDownload> > _downloads;
 };
 
 
@@ -23,6 +23,7 @@ public:
     // CefBrowserProcessHandler methods
     virtual CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() OVERRIDE { return this; }
     virtual void OnContextInitialized() OVERRIDE;
+    virtual void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE { ScheduleMessageLoopWork(delay_ms); } // called on arbitrary thread
 
 private:
 
@@ -13,8 +13,13 @@
 #include "src/CEF/Data/DOMNode.h"
 #include "src/Utils/Logger.h"
 #include "src/Global.h"
+#include "src/Singletons/Tracer.h"
+#include <thread>
 #include "include/cef_app.h"
 #include "include/wrapper/cef_helpers.h"
+#include "submodules/glfw/include/GLFW/glfw3.h"
+#include <algorithm>
+#include <chrono>
 
 
 void Mediator::SetMaster(MasterNotificationInterface* pMaster)
@@ -26,44 +31,145 @@ void Mediator::RegisterTab(TabCEFInterface* pTab, std::string URL, CefRefPtr<Cef
 {
     CEF_REQUIRE_UI_THREAD();
 
-    /*Following information might be changed and used in the future
-    http://magpcss.org/ceforum/apidocs3/projects/%28default%29/_cef_browser_settings_t.html
-        - webgl: enable WebGL
-        - windowless_frame_rate: default 30 fps, maximum 60
-    */
-    CefWindowInfo window_info;				// CefBrowser relevant information
-    window_info.SetAsWindowless(0);			// Window handle set to zero (may cause visual errors)
-    CefBrowserSettings browser_settings;	// Browser settings
+	// Decide on url
+	if (URL.empty()) { URL = BLANK_PAGE_URL; }
 
-    // Enable WebGL part 1 (other is in App.cpp)
-    if(setup::ENABLE_WEBGL)
-    {
-        browser_settings.webgl = STATE_ENABLED;
-        browser_settings.windowless_frame_rate = 60;
-	
-    }
+	// Remember Tab until its browser is created
+	auto start = std::chrono::steady_clock::now();
+	int token = _nextCreationToken++;
+	PendingTab pending;
+	pending.pTab = pTab;
+	pending.URL = URL;
+	pending.requestContext = request_context;
+	pending.registrationTime = start;
+	_pendingTabs.emplace(token, pending);
 
-	browser_settings.application_cache = STATE_ENABLED; // Goal: Accepting & saving cookies enabled
+	// Render with maximal frame rate until Tab tells otherwise
+	FrameRate frameRate;
+	frameRate.requested = setup::WEB_VIEW_MAX_FRAME_RATE;
+	_frameRates.emplace(pTab, frameRate);
 
-    // TODO: Delay Renderer OR save Tab & Texture as default if key(browser) not in map, reset after map insertion
-    //			OR add maps to CreateBrowserSync and fill them before Renderer starts (if possible)
+	LogDebug("Mediator: Tab registered, creation token = ", token);
+	CreateNextBrowser();
 
-    _pendingTab = pTab;
+	LogInfo("Mediator: Tab registration blocked for ",
+		std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count(), "ms.");
+}
 
-	// Decide on url
-	if (URL.empty()) { URL = BLANK_PAGE_URL; }
+void Mediator::CreateNextBrowser()
+{
+	// Only one creation at a time, so created browser can be matched to token of its Tab
+	if (_creatingBrowsers) { return; }
+	_creatingBrowsers = true;
+	while (_creationToken < 0 && !_pendingTabs.empty())
+	{
+		auto iter = _pendingTabs.begin();
+		_creationToken = iter->first;
+		PendingTab& rPending = iter->second;
+
+		/*Following information might be changed and used in the future
+		http://magpcss.org/ceforum/apidocs3/projects/%28default%29/_cef_browser_settings_t.html
+			- webgl: enable WebGL
+			- windowless_frame_rate: default 30 fps, maximum 60
+		*/
+		CefWindowInfo window_info;				// CefBrowser relevant information
+		window_info.SetAsWindowless(0);			// Window handle set to zero (may cause visual errors)
+		CefBrowserSettings browser_settings;	// Browser settings
+
+		// Enable WebGL part 1 (other is in App.cpp)
+		if(setup::ENABLE_WEBGL)
+		{
+			browser_settings.webgl = STATE_ENABLED;
+			browser_settings.windowless_frame_rate = setup::WEB_VIEW_MAX_FRAME_RATE;
+		}
 
-    LogDebug("Mediator: Creating new CefBrowser at Tab registration.");
-    // Create new CefBrowser with given information
-    CefRefPtr<CefBrowser> browser = CefBrowserHost::CreateBrowserSync(
-        window_info, _handler.get(), URL, browser_settings, request_context);
+		browser_settings.application_cache = STATE_ENABLED; // Goal: Accepting & saving cookies enabled
 
-	LogDebug("Mediator::RegisterTab: request_context == nullptr? ", request_context == nullptr);
+		// Created browser loads latest URL, later ones are loaded in OnBrowserCreated
+		std::string URL = rPending.URL;
+		rPending.URL.clear();
 
-    // Fill maps with correlating Tab and CefBrowsre
-    _browsers.emplace(pTab, browser);
-    _tabs.emplace(browser->GetIdentifier(), pTab);
-    _pendingTab = NULL;
+		LogDebug("Mediator: Creating new CefBrowser, creation token = ", _creationToken);
+		LogDebug("Mediator::CreateNextBrowser: request_context == nullptr? ", rPending.requestContext == nullptr);
+		bool success = false;
+		if (setup::TAB_ASYNC_BROWSER_CREATION)
+		{
+			// Browser is assigned to Tab in OnBrowserCreated
+			success = CefBrowserHost::CreateBrowser(window_info, _handler.get(), URL, browser_settings, rPending.requestContext);
+		}
+		else
+		{
+			// Handler calls OnBrowserCreated before this returns
+			CefRefPtr<CefBrowser> browser = CefBrowserHost::CreateBrowserSync(
+				window_info, _handler.get(), URL, browser_settings, rPending.requestContext);
+			success = (browser != NULL);
+			if (browser && _creationToken >= 0) { OnBrowserCreated(browser); }
+		}
+
+		// Drop Tab whose browser cannot be created, so following Tabs are not blocked
+		if (!success)
+		{
+			LogError("Mediator: Failed to create CefBrowser, creation token = ", _creationToken);
+			_pendingTabs.erase(_creationToken);
+			_creationToken = -1;
+		}
+	}
+	_creatingBrowsers = false;
+}
+
+void Mediator::OnBrowserCreated(CefRefPtr<CefBrowser> browser)
+{
+	CEF_REQUIRE_UI_THREAD();
+
+	// Take Tab whose browser is being created
+	if (_tabs.find(browser->GetIdentifier()) != _tabs.end()) { return; }
+	auto iter = _pendingTabs.find(_creationToken);
+	if (iter == _pendingTabs.end())
+	{
+		LogDebug("Mediator: CefBrowser created without pending Tab.");
+		return;
+	}
+	PendingTab pending = iter->second;
+	_pendingTabs.erase(iter);
+	_creationToken = -1;
+
+	// Tab might be gone already
+	if (pending.unregistered)
+	{
+		LogDebug("Mediator: Closing CefBrowser of Tab which has been unregistered meanwhile.");
+		_handler->CloseBrowser(browser);
+		CreateNextBrowser();
+		return;
+	}
+
+	// Fill maps with correlating Tab and CefBrowser
+	bool first = _tabs.empty();
+	_browsers.emplace(pending.pTab, browser);
+	_tabs.emplace(browser->GetIdentifier(), pending.pTab);
+
+	// Catch up on what happened while pending
+	if (!pending.URL.empty())
+	{
+		_handler->LoadPage(browser, pending.URL);
+	}
+	browser->GetHost()->WasHidden(_activeTab != NULL && _activeTab != pending.pTab);
+	ApplyFrameRates();
+
+	// Measure latency until first paint, too
+	_firstPaintTimes[pending.pTab] = pending.registrationTime;
+	LogInfo("Mediator: CefBrowser ready ",
+		std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - pending.registrationTime).count(),
+		"ms after Tab registration", first ? " (startup)." : ".");
+
+	// Continue with next Tab
+	CreateNextBrowser();
+}
+
+TabCEFInterface* Mediator::GetPendingTab() const
+{
+	auto iter = _pendingTabs.find(_creationToken);
+	if (iter != _pendingTabs.end() && !iter->second.unregistered) { return iter->second.pTab; }
+	return NULL;
 }
 
 void Mediator::UnregisterTab(TabCEFInterface* pTab)
@@ -79,6 +185,19 @@ void Mediator::UnregisterTab(TabCEFInterface* pTab)
         _tabs.erase(browserID);
         _browsers.erase(pTab);
     }
+
+    // Close browser as soon as it is created, when creation is in progress. Otherwise it is never created
+    for (auto iter = _pendingTabs.begin(); iter != _pendingTabs.end();)
+    {
+        if (iter->second.pTab != pTab) { ++iter; }
+        else if (iter->first == _creationToken) { iter->second.unregistered = true; ++iter; }
+        else { iter = _pendingTabs.erase(iter); }
+    }
+    _frameRates.erase(pTab);
+    _firstPaintTimes.erase(pTab);
+
+    // Budget of removed Tab is free again
+    ApplyFrameRates();
 }
 
 void Mediator::LoadURLInTab(TabCEFInterface * pTab, std::string URL)
@@ -88,6 +207,14 @@ void Mediator::LoadURLInTab(TabCEFInterface * pTab, std::string URL)
         // Get Tab object and load Tab's URL in CefBrowser
         _handler->LoadPage(_browsers.at(pTab), URL);
     }
+    else
+    {
+        // Load URL as soon as browser is ready
+        for (auto& rPair : _pendingTabs)
+        {
+            if (rPair.second.pTab == pTab) { rPair.second.URL = URL; }
+        }
+    }
 }
 
 void Mediator::ReloadTab(TabCEFInterface * pTab)
@@ -132,9 +259,75 @@ void Mediator::ReplyJSDialog(TabCEFInterface* pTab, bool clicked_ok, std::string
 
 void Mediator::DoMessageLoopWork()
 {
+    // Consume scheduled work. Work scheduled by CEF from other thread meanwhile is kept
+    int64_t scheduled = _messageLoopWorkTime;
+    _messageLoopWorkTime.compare_exchange_strong(scheduled, -1);
+    ++_messageLoopWorkCount;
     CefDoMessageLoopWork();
 }
 
+void Mediator::ScheduleMessageLoopWork(int64 delayMs)
+{
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t time = now + std::max((int64_t)0, (int64_t)delayMs) * 1000;
+
+    // Keep earlier scheduled time
+    int64_t scheduled = _messageLoopWorkTime;
+    while ((scheduled < 0 || time < scheduled) && !_messageLoopWorkTime.compare_exchange_weak(scheduled, time)) {}
+
+    // Wake up Master when it waits for earlier work or none at all
+    if ((scheduled < 0 || time < scheduled) && _wakeUpOnSchedule)
+    {
+        glfwPostEmptyEvent();
+    }
+}
+
+void Mediator::FinishBrowserClosing(float timeout)
+{
+    // Closing happens asynchronously within message loop work, which is no longer done by Master
+    auto start = std::chrono::steady_clock::now();
+    while (_handler->GetOpenBrowserCount() > 0)
+    {
+        if (std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() > timeout)
+        {
+            LogInfo("Mediator: ", _handler->GetOpenBrowserCount(), " browsers did not close in time.");
+            return;
+        }
+        DoMessageLoopWork();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+double Mediator::GetTimeUntilScheduledMessageLoopWork() const
+{
+    int64_t scheduled = _messageLoopWorkTime;
+    if (scheduled < 0) { return -1.0; }
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return std::max((int64_t)0, scheduled - now) / 1000000.0;
+}
+
+void Mediator::ReceiveQueryLatencyProbe(double sentTime)
+{
+    double now = (double)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count() / 1000.0;
+    double latency = std::max(0.0, now - sentTime);
+    _queryLatencySum += latency;
+    _queryLatencyMax = std::max(_queryLatencyMax, latency);
+
+    // Log statistics from time to time
+    if (++_queryLatencyCount >= MEDIATOR_QUERY_LATENCY_SAMPLES)
+    {
+        LogInfo("Mediator: Latency of Javascript queries is ", _queryLatencySum / _queryLatencyCount,
+            "ms on average and ", _queryLatencyMax, "ms at maximum, ", _messageLoopWorkCount, " message loop works since last report.");
+        _queryLatencySum = 0;
+        _queryLatencyMax = 0;
+        _queryLatencyCount = 0;
+        _messageLoopWorkCount = 0;
+    }
+}
+
 void Mediator::EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed)
 {
     if(CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
@@ -270,31 +463,31 @@ bool Mediator::SendProcessMessageToRenderer(CefRefPtr<CefProcessMessage> msg, Ta
 	return false;
 }
 
-std::weak_ptr<DOMTextInput> Mediator::GetDOMTextInput(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMTextInput> Mediator::GetDOMTextInput(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (auto pTab = GetTab(browser))
 	{
 		return pTab->GetDOMTextInput(id);
 	}
-	return std::weak_ptr<DOMTextInput>();
+	return nullptr;
 }
 
-std::weak_ptr<DOMLink> Mediator::GetDOMLink(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMLink> Mediator::GetDOMLink(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (auto pTab = GetTab(browser))
 	{
 		return pTab->GetDOMLink(id);
 	}
-	return std::weak_ptr<DOMLink>();
+	return nullptr;
 }
 
-std::weak_ptr<DOMSelectField> Mediator::GetDOMSelectField(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMSelectField> Mediator::GetDOMSelectField(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (auto pTab = GetTab(browser))
 	{
 		return pTab->GetDOMSelectField(id);
 	}
-	return std::weak_ptr<DOMSelectField>();
+	return nullptr;
 }
 
 void Mediator::SetActiveTab(TabCEFInterface * pTab)
@@ -316,6 +509,9 @@ void Mediator::SetActiveTab(TabCEFInterface * pTab)
 			browser->GetHost()->WasHidden(true);
 		}
 	}
+
+	// Budget of frame rates is mostly spent on visible Tab
+	ApplyFrameRates();
 }
 
 
@@ -330,31 +526,31 @@ bool Mediator::SetLoadingStatus(CefRefPtr<CefBrowser> browser, bool isLoading, b
 	return false;	
 }
 
-std::weak_ptr<DOMOverflowElement> Mediator::GetDOMOverflowElement(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMOverflowElement> Mediator::GetDOMOverflowElement(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (TabCEFInterface* pTab = GetTab(browser))
 	{
 		return pTab->GetDOMOverflowElement(id);
 	}
-	return std::weak_ptr<DOMOverflowElement>();
+	return nullptr;
 }
 
-std::weak_ptr<DOMVideo> Mediator::GetDOMVideo(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMVideo> Mediator::GetDOMVideo(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (TabCEFInterface* pTab = GetTab(browser))
 	{
 		return pTab->GetDOMVideo(id);
 	}
-	return std::weak_ptr<DOMVideo>();
+	return nullptr;
 }
 
-std::weak_ptr<DOMCheckbox> Mediator::GetDOMCheckbox(CefRefPtr<CefBrowser> browser, int id)
+std::shared_ptr<DOMCheckbox> Mediator::GetDOMCheckbox(CefRefPtr<CefBrowser> browser, int id)
 {
 	if (TabCEFInterface* pTab = GetTab(browser))
 	{
 		return pTab->GetDOMCheckbox(id);
 	}
-	return std::weak_ptr<DOMCheckbox>();
+	return nullptr;
 }
 
 void Mediator::RemoveDOMOverflowElement(CefRefPtr<CefBrowser> browser, int id)
@@ -420,6 +616,41 @@ void Mediator::ResetScrolling(TabCEFInterface * pTab)
     }
 }
 
+void Mediator::SetScrolling(TabCEFInterface * pTab, double x, double y)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->SetMainFramesScrolling(browser, x, y);
+    }
+}
+
+void Mediator::FreezeTab(TabCEFInterface * pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        browser->GetHost()->WasHidden(true);
+        _handler->PauseMainFramesMedia(browser);
+    }
+}
+
+void Mediator::UnfreezeTab(TabCEFInterface * pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->ResumeMainFramesMedia(browser);
+    }
+}
+
+bool Mediator::GetNavigationURLs(TabCEFInterface * pTab, std::vector<std::string>& rURLs, int& rCurrentIndex)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        _handler->GetNavigationURLs(browser, rURLs, rCurrentIndex);
+        return !rURLs.empty() && rCurrentIndex >= 0;
+    }
+    return false;
+}
+
 void Mediator::SetURL(CefRefPtr<CefBrowser> browser)
 {
     if (TabCEFInterface* pTab = GetTab(browser))
@@ -444,13 +675,15 @@ void Mediator::SetCanGoForward(CefRefPtr<CefBrowser> browser, bool canGoForward)
     }
 }
 
-bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img)
+bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefString img_url, CefRefPtr<CefImage> img)
 {
 	if (const auto pTab = GetTab(browser))
 	{
 		if (!img)
 			return true;
 
+		TraceSpan span("Favicon bitmap");
+
 		int width, height;
 
 		auto binary_value = img->GetAsBitmap(1.0, CEF_COLOR_TYPE_RGBA_8888, CEF_ALPHA_TYPE_PREMULTIPLIED, width, height);
@@ -477,7 +710,7 @@ bool Mediator::ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefI
 		upData->resize(byte_size / sizeof(unsigned char));
 		binary_value->GetData(static_cast<void*>(upData->data()), byte_size, 0);
 
-		pTab->ReceiveFaviconBytes(std::move(upData), width, height);
+		pTab->ReceiveFaviconBytes(img_url.ToString(), std::move(upData), width, height);
 		return true;
 	}
 	LogInfo("Mediator: Forwarding favicon bytes to Tab failed. It might not exist anymore.");
@@ -540,8 +773,9 @@ void Mediator::ReceiveFixedElements(CefRefPtr<CefBrowser> browser, CefRefPtr<Cef
 {
     CefRefPtr<CefListValue> args = msg->GetArgumentList();
     int id = args->GetInt(0);
+    bool topmost = args->GetBool(1);
     std::vector<Rect> fixedCoords = {};
-    for (int i = 1; i < (int)args->GetSize(); i+=4)
+    for (int i = 2; i < (int)args->GetSize(); i+=4)
     {
         fixedCoords.push_back(
             Rect(
@@ -559,7 +793,7 @@ void Mediator::ReceiveFixedElements(CefRefPtr<CefBrowser> browser, CefRefPtr<Cef
         {
              LogDebug("\t-->", fixedCoords[i].top, ", ", fixedCoords[i].left, ", ", fixedCoords[i].bottom, ", ", fixedCoords[i].right);
         }*/
-        pTab->AddFixedElementsCoordinates(id, fixedCoords);
+        pTab->AddFixedElementsCoordinates(id, fixedCoords, topmost);
     }
 }
 
@@ -729,10 +963,10 @@ void Mediator::ClearClipboardText()
 
 TabCEFInterface* Mediator::GetTab(CefRefPtr<CefBrowser> browser) const
 {
-    int browserID = browser->GetIdentifier();
-    if (_tabs.find(browserID) != _tabs.end())
+    const auto iter = _tabs.find(browser->GetIdentifier());
+    if (iter != _tabs.end())
     {
-        return _tabs.at(browserID);
+        return iter->second;
     }
     LogDebug("Mediator: The given CefBrowser pointer is not contained in key in Browser->Tab map (anymore).");
     return nullptr;
@@ -755,10 +989,10 @@ std::weak_ptr<Texture> Mediator::GetTexture(CefRefPtr<CefBrowser> browser)
     {
         return pTab->GetWebViewTexture();
     }
-    else if (_pendingTab)
+    else if (TabCEFInterface* pPendingTab = GetPendingTab())
     {
         LogDebug("Mediator: Pending Tab used for GetTexture.");
-        return _pendingTab->GetWebViewTexture();
+        return pPendingTab->GetWebViewTexture();
     }
     else
     {
@@ -783,10 +1017,10 @@ void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& hei
     {
         pTab->GetWebRenderResolution(width, height);
     }
-    else if (_pendingTab)
+    else if (TabCEFInterface* pPendingTab = GetPendingTab())
     {
-        LogDebug("Mediator: Getting resolution from Tab _pendingTab.");
-        _pendingTab->GetWebRenderResolution(width, height);
+        LogDebug("Mediator: Getting resolution from pending Tab.");
+        pPendingTab->GetWebRenderResolution(width, height);
     }
     else
     {
@@ -796,6 +1030,153 @@ void Mediator::GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& hei
     }
 }
 
+float Mediator::GetScaleFactor(CefRefPtr<CefBrowser> browser) const
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        return pTab->GetWebRenderScaleFactor();
+    }
+    else if (TabCEFInterface* pPendingTab = GetPendingTab())
+    {
+        return pPendingTab->GetWebRenderScaleFactor();
+    }
+    return 1.f;
+}
+
+void Mediator::ForwardDetailPaint(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer, const CefRenderHandler::RectList& rDirtyRects)
+{
+    if (TabCEFInterface* pTab = GetTab(browser))
+    {
+        std::vector<Rect> dirtyRects;
+        for (const auto& rRect : rDirtyRects)
+        {
+            dirtyRects.push_back(Rect((float)rRect.y, (float)rRect.x, (float)(rRect.y + rRect.height), (float)(rRect.x + rRect.width)));
+        }
+        pTab->ReceiveDetailPaint(width, height, pBuffer, dirtyRects);
+    }
+}
+
+bool Mediator::StagePaint(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer, const CefRenderHandler::RectList& rDirtyRects)
+{
+    // Only active Tab is composited every frame
+    TabCEFInterface* pTab = GetTab(browser);
+    if (!setup::WEB_VIEW_FRAME_SYNCHRONIZED_UPLOAD || !pTab || pTab != _activeTab) { return false; }
+
+    std::vector<Rect> dirtyRects;
+    dirtyRects.reserve(rDirtyRects.size());
+    for (const auto& rRect : rDirtyRects)
+    {
+        dirtyRects.push_back(Rect((float)rRect.y, (float)rRect.x, (float)(rRect.y + rRect.height), (float)(rRect.x + rRect.width)));
+    }
+    pTab->ReceivePaint(width, height, pBuffer, dirtyRects);
+    return true;
+}
+
+void Mediator::NotifyScreenInfoChanged(TabCEFInterface* pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        browser->GetHost()->NotifyScreenInfoChanged();
+    }
+}
+
+void Mediator::InvalidateTab(TabCEFInterface* pTab)
+{
+    if (CefRefPtr<CefBrowser> browser = GetBrowser(pTab))
+    {
+        browser->GetHost()->Invalidate(PET_VIEW);
+    }
+}
+
+void Mediator::RequestFrameRate(TabCEFInterface* pTab, int frameRate)
+{
+	auto iter = _frameRates.find(pTab);
+	if (iter != _frameRates.end() && iter->second.requested != frameRate)
+	{
+		iter->second.requested = frameRate;
+		ApplyFrameRates();
+	}
+}
+
+int Mediator::GetFrameRate(TabCEFInterface* pTab) const
+{
+	auto iter = _frameRates.find(pTab);
+	return (iter != _frameRates.end()) ? iter->second.applied : 0;
+}
+
+unsigned int Mediator::GetPaintCount(TabCEFInterface* pTab) const
+{
+	auto iter = _frameRates.find(pTab);
+	return (iter != _frameRates.end()) ? iter->second.paintCount : 0;
+}
+
+void Mediator::CountPaint(CefRefPtr<CefBrowser> browser)
+{
+	if (TabCEFInterface* pTab = GetTab(browser))
+	{
+		auto iter = _frameRates.find(pTab);
+		if (iter != _frameRates.end()) { iter->second.paintCount++; }
+
+		// Latency from registration until first paint
+		auto firstPaintIter = _firstPaintTimes.find(pTab);
+		if (firstPaintIter != _firstPaintTimes.end())
+		{
+			LogInfo("Mediator: First paint of Tab ",
+				std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - firstPaintIter->second).count(),
+				"ms after its registration.");
+			_firstPaintTimes.erase(firstPaintIter);
+		}
+	}
+}
+
+void Mediator::ApplyFrameRates()
+{
+	if (!setup::WEB_VIEW_FRAME_RATE_GOVERNOR) { return; }
+
+	// Hidden Tabs render with paused frame rate and take their share of the budget first
+	int hiddenSum = 0;
+	int visibleSum = 0;
+	for (const auto& rPair : _frameRates)
+	{
+		if (_activeTab == NULL || rPair.first == _activeTab)
+		{
+			visibleSum += glm::max(setup::WEB_VIEW_PAUSED_FRAME_RATE, rPair.second.requested);
+		}
+		else
+		{
+			hiddenSum += setup::WEB_VIEW_PAUSED_FRAME_RATE;
+		}
+	}
+
+	// Scale requests of visible Tabs down when remaining budget is exceeded, e.g. by animating pages
+	// while many Tabs are open. Visible Tabs keep at least the idle frame rate
+	float budgetScale = 1.f;
+	int remainingBudget = setup::WEB_VIEW_FRAME_RATE_BUDGET - hiddenSum;
+	if (visibleSum > remainingBudget)
+	{
+		budgetScale = (float)glm::max(0, remainingBudget) / (float)visibleSum;
+	}
+
+	// Tell CEF about changed frame rates
+	for (auto& rPair : _frameRates)
+	{
+		int frameRate = setup::WEB_VIEW_PAUSED_FRAME_RATE; // hidden Tabs
+		if (_activeTab == NULL || rPair.first == _activeTab)
+		{
+			int requested = glm::max(setup::WEB_VIEW_PAUSED_FRAME_RATE, rPair.second.requested);
+			frameRate = glm::max(glm::min(requested, setup::WEB_VIEW_IDLE_FRAME_RATE), (int)(budgetScale * requested));
+		}
+		if (frameRate != rPair.second.applied)
+		{
+			if (CefRefPtr<CefBrowser> browser = GetBrowser(rPair.first))
+			{
+				browser->GetHost()->SetWindowlessFrameRate(frameRate);
+				rPair.second.applied = frameRate;
+			}
+		}
+	}
+}
+
 void Mediator::ResizeTabs()
 {
     _handler->ResizeBrowsers();
@@ -9,6 +9,7 @@
 
 #include "src/Master/MasterNotificationInterface.h"
 #include "include/cef_browser.h"
+#include "include/cef_render_handler.h"
 #include "src/CEF/Handler.h"
 #include "src/CEF/DevToolsHandler.h"
 #include "src/CEF/JavaScriptDialogType.h"
@@ -17,6 +18,9 @@
 #include <memory>
 #include <queue>
 #include <functional>
+#include <atomic>
+#include <cstdint>
+#include <chrono>
 #include "include\cef_base.h"
 
 /**
@@ -45,9 +49,15 @@ public:
 	// Setter for master pointer (MUST be called before usage)
 	void SetMaster(MasterNotificationInterface* pMaster);
 
-    // Receive tab specific commands
+    // Receive tab specific commands. Registration returns before the CefBrowser is ready
     void RegisterTab(TabCEFInterface* pTab, std::string URL, CefRefPtr<CefRequestContext> request_context = nullptr);
     void UnregisterTab(TabCEFInterface* pClosing);
+
+    // Called by Handler when CefBrowser has been created. Assigns it to Tab whose creation token is in progress
+    void OnBrowserCreated(CefRefPtr<CefBrowser> browser);
+
+    // Whether CefBrowser of Tab is ready. Until then, Tab shows placeholder
+    bool IsTabReady(TabCEFInterface* pTab) const { return _browsers.find(pTab) != _browsers.end(); }
     void LoadURLInTab(TabCEFInterface* pTab, std::string URL);
     void ReloadTab(TabCEFInterface* pTab);
     void GoBack(TabCEFInterface* pTab);
@@ -66,12 +76,52 @@ public:
     // Get resolution of rendering
     void GetResolution(CefRefPtr<CefBrowser> browser, int& width, int& height) const;
 
+    // Get device scale factor of rendering
+    float GetScaleFactor(CefRefPtr<CefBrowser> browser) const;
+
+    // Renderer::OnPaint calls this method with paints of higher resolution than view rect
+    void ForwardDetailPaint(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer, const CefRenderHandler::RectList& rDirtyRects);
+
+    // Tell CEF that device scale factor of Tab has changed
+    void NotifyScreenInfoChanged(TabCEFInterface* pTab);
+
+    // Request new paint of Tab's web view
+    void InvalidateTab(TabCEFInterface* pTab);
+
+    // Request frame rate for rendering of Tab, which is applied while Tab is visible
+    void RequestFrameRate(TabCEFInterface* pTab, int frameRate);
+
+    // Get frame rate applied to rendering of Tab and count of paints received so far
+    int GetFrameRate(TabCEFInterface* pTab) const;
+    unsigned int GetPaintCount(TabCEFInterface* pTab) const;
+
+    // Called by Renderer at each paint
+    void CountPaint(CefRefPtr<CefBrowser> browser);
+
+    // Called by Renderer to stage paint of active Tab for upload right before composition. Returns false if not staged
+    bool StagePaint(CefRefPtr<CefBrowser> browser, int width, int height, const unsigned char* pBuffer, const CefRenderHandler::RectList& rDirtyRects);
+
     // Called by Master when window resize happens
     void ResizeTabs();
 
     // Call from Master to do message loop work
     void DoMessageLoopWork();
 
+    // Called by CEF on arbitrary thread when it wants message loop work to be done after delay
+    void ScheduleMessageLoopWork(int64 delayMs);
+
+    // Seconds until scheduled message loop work is due. Zero when due, negative when nothing is scheduled
+    double GetTimeUntilScheduledMessageLoopWork() const;
+
+    // Set by Master while it waits for events, so newly scheduled work wakes it up with an empty event
+    void SetWakeUpOnSchedule(bool wakeUp) { _wakeUpOnSchedule = wakeUp; }
+
+    // Do message loop work until all browsers are closed or timeout in seconds is reached. Call before CEF shutdown
+    void FinishBrowserClosing(float timeout);
+
+    // Receive time in milliseconds since epoch at which Javascript sent query, for latency measurement
+    void ReceiveQueryLatencyProbe(double sentTime);
+
     // Emulation of left mouse button press and release in specific Tab
     void EmulateMouseCursor(TabCEFInterface* pTab, double x, double y, bool leftButtonPressed); // leftButtonPressed seems necessary
 																								// between mouse button down and up during text selection
@@ -89,6 +139,16 @@ public:
 	bool EmulateSelectAll(TabCEFInterface* pTab);
 
     void ResetScrolling(TabCEFInterface* pTab);
+    void SetScrolling(TabCEFInterface* pTab, double x, double y);
+
+    // Freeze Tab in background by pausing its media (rendering is already hidden)
+    void FreezeTab(TabCEFInterface* pTab);
+
+    // Resume media paused by freezing of Tab
+    void UnfreezeTab(TabCEFInterface* pTab);
+
+    // Get URLs of Tab's navigation history, e.g. to keep them while Tab is discarded. Returns whether successful
+    bool GetNavigationURLs(TabCEFInterface* pTab, std::vector<std::string>& rURLs, int& rCurrentIndex);
 
     // Sets Tab's URL attribute, called by Handler when main frame starts loading a page
     void SetURL(CefRefPtr<CefBrowser> browser);
@@ -106,7 +166,7 @@ public:
 	void ResetFavicon(CefRefPtr<CefBrowser> browser);
 
 	// Get byte code from CefImage and send it to corresponding Tab
-	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefRefPtr<CefImage> img);
+	bool ForwardFaviconBytes(CefRefPtr<CefBrowser> browser, CefString img_url, CefRefPtr<CefImage> img);
 
 	// Check if favicon was already loaded before new image is also loaded
 	bool IsFaviconAlreadyAvailable(CefRefPtr<CefBrowser> browser, CefString img_url);
@@ -163,12 +223,12 @@ public:
 
 
 	// Receive weak_ptr, only perform Initialize(objMsg) and Update(attr) operations
-	std::weak_ptr<DOMTextInput> GetDOMTextInput(CefRefPtr<CefBrowser> browser, int id);
-	std::weak_ptr<DOMLink> GetDOMLink(CefRefPtr<CefBrowser> browser, int id);
-	std::weak_ptr<DOMSelectField> GetDOMSelectField(CefRefPtr<CefBrowser> browser, int id);
-	std::weak_ptr<DOMOverflowElement> GetDOMOverflowElement(CefRefPtr<CefBrowser> browser, int id);
-	std::weak_ptr<DOMVideo> GetDOMVideo(CefRefPtr<CefBrowser> browser, int id);
-	std::weak_ptr<DOMCheckbox> GetDOMCheckbox(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMTextInput> GetDOMTextInput(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMLink> GetDOMLink(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMSelectField> GetDOMSelectField(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMOverflowElement> GetDOMOverflowElement(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMVideo> GetDOMVideo(CefRefPtr<CefBrowser> browser, int id);
+	std::shared_ptr<DOMCheckbox> GetDOMCheckbox(CefRefPtr<CefBrowser> browser, int id);
 
 	// DOM node objects can directly send interaction messages to Renderer
 	bool SendProcessMessageToRenderer(CefRefPtr<CefProcessMessage> msg, TabCEFInterface* pTab);
@@ -212,11 +272,57 @@ protected:
 
 	TabCEFInterface* _activeTab = NULL;
 
-    TabCEFInterface* _pendingTab = NULL; // Used in Tab registration progress (at first, Renderer works to fast for map access)
+	// Tabs waiting for their CefBrowser, keyed by creation token
+	struct PendingTab
+	{
+		TabCEFInterface* pTab = NULL;
+		std::string URL; // URL to load once browser is ready
+		CefRefPtr<CefRequestContext> requestContext;
+		bool unregistered = false; // Tab was unregistered before browser was ready
+		std::chrono::steady_clock::time_point registrationTime;
+	};
+	std::map<int, PendingTab> _pendingTabs;
+	int _nextCreationToken = 0;
+	int _creationToken = -1; // token of Tab whose browser is being created, negative when none
+	bool _creatingBrowsers = false; // guards against recursion through OnBrowserCreated
+
+	// Create browser for oldest pending Tab unless creation is in progress. Browser creation callback
+	// cannot carry the token with this CEF version, so only one creation happens at a time. Synchronous
+	// creation continues with further pending Tabs in a loop, failed creations drop their pending Tab
+	void CreateNextBrowser();
+
+	// Tab whose browser is being created, used by Renderer callbacks which arrive before browser is assigned.
+	// NULL when that Tab has been unregistered meanwhile
+	TabCEFInterface* GetPendingTab() const;
+
+	// Tabs waiting for first paint, for latency measurement
+	std::map<TabCEFInterface*, std::chrono::steady_clock::time_point> _firstPaintTimes;
 
 	// Simple internal clipboard
 	std::string _clipboard = "";
 
+	// Frame rate requested by Tab, the one applied to its browser and count of paints
+	struct FrameRate
+	{
+		int requested = 0;
+		int applied = 0;
+		unsigned int paintCount = 0;
+	};
+	std::map<TabCEFInterface*, FrameRate> _frameRates;
+
+	// Apply requested frame rate of visible Tab within budget, hidden ones render with paused frame rate
+	void ApplyFrameRates();
+
+	// Time in microseconds of steady clock at which message loop work is scheduled
+	std::atomic<int64_t> _messageLoopWorkTime{ -1 }; // negative when nothing is scheduled
+	std::atomic<bool> _wakeUpOnSchedule{ false };
+
+	// Latency between query in Javascript and its handling
+	double _queryLatencySum = 0;
+	double _queryLatencyMax = 0;
+	int _queryLatencyCount = 0;
+	int _messageLoopWorkCount = 0;
+
     // Use these methods for less coding overhead by checking if key exists in map
     TabCEFInterface* GetTab(CefRefPtr<CefBrowser> browser) const;
     CefRefPtr<CefBrowser> GetBrowser(TabCEFInterface* pTab) const;
@@ -66,6 +66,22 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 	}
 
 
+	// Probe of latency between query in Javascript and its handling here
+	if (split_request.size() == 2 && split_request[0].compare("latency") == 0)
+	{
+		try
+		{
+			_pMediator->ReceiveQueryLatencyProbe(std::stod(split_request[1]));
+		}
+		catch (const std::exception& e)
+		{
+			LogInfo("MsgRouter: Received wrongly typed latency probe!");
+			LogInfo("Caught exception: ", e.what());
+		}
+		callback->Success("Received latency probe");
+		return true;
+	}
+
 	// ###############
 	// ### Favicon ###
 	// ###############
@@ -201,7 +217,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 			const int& type = std::stoi(typeStr);
 			const DOMAttribute& attr = static_cast<DOMAttribute>(std::stoi(attrStr));
 
-			std::weak_ptr<DOMNode> target;
+			std::shared_ptr<DOMNode> target;
 			switch (type)
 			{
 			case(0): {target = _pMediator->GetDOMTextInput(browser, id); break; }
@@ -214,7 +230,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 			}
 			}
 
-			if (auto node = target.lock())
+			if (auto node = target)
 			{
 				node->PrintAttribute(attr);
 			}
@@ -303,7 +319,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 			// UPDATE DOMNODE
 			if (op.compare("upd") == 0)
 			{
-				std::weak_ptr<DOMNode> target;
+				std::shared_ptr<DOMNode> target;
 				switch (type)
 				{
 					case(0): {target = _pMediator->GetDOMTextInput(browser, id); break; }
@@ -326,7 +342,7 @@ bool DefaultMsgHandler::OnQuery(CefRefPtr<CefBrowser> browser,
 
 					// Perform node update
 					bool success = false;
-					if (auto node = target.lock())
+					if (auto node = target)
 					{
 						success = node->Update(
 							(DOMAttribute) attr,
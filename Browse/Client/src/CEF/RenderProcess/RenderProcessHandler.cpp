@@ -213,6 +213,9 @@ bool RenderProcessHandler::OnProcessMessageReceived(
 			int index = 0;
 			args->SetInt(index++, fixedId);
 
+			// Whether fixed element is on top of page, so it occludes everything below its rects
+			args->SetBool(index++, fixedObj->GetValue("isTopmost")->ExecuteFunction(fixedObj, {})->GetBoolValue());
+
 			// Get V8 list of floats, representing all Rect coordinates of the given fixedObj
 			CefRefPtr<CefV8Value> rectList = fixedObj->GetValue("getRects")->ExecuteFunction(fixedObj, {});
 
@@ -8,7 +8,9 @@
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Texture.h"
 #include "src/Utils/Logger.h"
+#include "src/Singletons/Tracer.h"
 #include "include/wrapper/cef_helpers.h"
+#include <cmath>
 
 Renderer::Renderer(Mediator* pMediator)
 {
@@ -27,6 +29,15 @@ bool Renderer::GetViewRect(CefRefPtr<CefBrowser> browser, CefRect &rect)
     return true;
 }
 
+bool Renderer::GetScreenInfo(CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info)
+{
+    // Screen rects are left empty, so CEF takes view rect instead
+    screen_info.device_scale_factor = _mediator->GetScaleFactor(browser);
+    screen_info.depth = 24;
+    screen_info.depth_per_component = 8;
+    return true;
+}
+
 void Renderer::OnPaint(
     CefRefPtr<CefBrowser> browser,
     PaintElementType type,
@@ -35,11 +46,48 @@ void Renderer::OnPaint(
     int width,
     int height)
 {
+    TraceSpan span("OnPaint");
+
+    // Count paints for frame rate statistics
+    _mediator->CountPaint(browser);
+
+    const unsigned char* pBuffer = (const unsigned char*) buffer;
+
+    // Paint with higher resolution than view rect contains detail for zoomed region
+    if (type == PET_VIEW)
+    {
+        int viewWidth = 0, viewHeight = 0;
+        _mediator->GetResolution(browser, viewWidth, viewHeight);
+        if (width > viewWidth || height > viewHeight)
+        {
+            // Drop late paint of previous device scale factor, it does not fit any texture
+            float scaleFactor = _mediator->GetScaleFactor(browser);
+            if (scaleFactor <= 1.f
+                || std::abs(width - (int)std::ceil(viewWidth * scaleFactor)) > 1
+                || std::abs(height - (int)std::ceil(viewHeight * scaleFactor)) > 1)
+            {
+                LogDebug("Renderer: Dropped paint not matching device scale factor.");
+                return;
+            }
+
+            // Standard resolution texture is still shown outside of detail region. Tab keeps it up to date
+            // from the detail paint on the GPU, since downsampling on this thread would delay input handling
+            _mediator->ForwardDetailPaint(browser, width, height, pBuffer, dirtyRects);
+            return;
+        }
+    }
+
+    // Paint of active Tab is uploaded right before composition, so several paints within one frame share an upload
+    if (type == PET_VIEW && _mediator->StagePaint(browser, width, height, pBuffer, dirtyRects))
+    {
+        return;
+    }
+
     // Look up corresponding texture
     if (auto spTexture = _mediator->GetTexture(browser).lock())
     {
         // Fill texture with rendered website
-        spTexture->Fill(width, height, GL_BGRA, (const unsigned char*) buffer);
+        spTexture->Fill(width, height, GL_BGRA, pBuffer);
 
 
 		// TESTING
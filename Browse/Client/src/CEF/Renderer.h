@@ -27,6 +27,9 @@ public:
     // Called by CEF to determine render size
     bool GetViewRect(CefRefPtr<CefBrowser> browser, CefRect &rect) OVERRIDE;
 
+    // Called by CEF to determine device scale factor, which is raised while zoomed in
+    bool GetScreenInfo(CefRefPtr<CefBrowser> browser, CefScreenInfo& screen_info) OVERRIDE;
+
     // Called when paint happens, copy pixels over RAM to texture
     void OnPaint(
         CefRefPtr<CefBrowser> browser,
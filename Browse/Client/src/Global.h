@@ -33,15 +33,44 @@ static const glm::vec2 TAB_TRIGGER_BADGE_OFFSET = glm::vec2(0.05f, 0.05f);
 static const float TAB_LOADING_ICON_FRAME_DURATION = 0.25f;
 static const float TAB_GET_PAGE_RES_INTERVAL = 1.0f;
 static const int TAB_DEBUGGING_GAZE_COUNT = 10;
+static const float TAB_FRAME_RATE_IDLE_TIME = 2.f; // seconds without activity until frame rate is lowered
+static const float TAB_FRAME_RATE_GAZE_MOVEMENT = 64.f; // pixels of gaze movement per frame counted as activity
+static const float TAB_FRAME_RATE_MEASUREMENT_INTERVAL = 1.f; // seconds over which paints are counted
+static const float TAB_FRAME_RATE_ANIMATION_RATIO = 0.8f; // ratio of paints to frame rate that indicates animation
+static const float TAB_DETAIL_INVALIDATION_INTERVAL = 0.25f; // seconds between requests of paint for zoomed region
+static const int TAB_OCCLUSION_GRID_CELL_SIZE = 16; // pixels covered by single cell of occlusion grid
+static const int TAB_OCCLUSION_STATISTICS_FRAMES = 600; // frames between logging of occlusion statistics
 static const float MASTER_PAUSE_ALPHA = 0.35f;
+static const int MASTER_MESSAGE_LOOP_MAX_WORK = 8; // due CEF message loop works done at most in a row
+static const double MASTER_MESSAGE_LOOP_WAIT_MARGIN = 0.002; // seconds kept free before estimated start of frame work
+static const double MASTER_DEFAULT_FRAME_PERIOD = 1.0 / 60.0; // seconds, used when refresh rate of monitor is unknown
+static const int MEDIATOR_QUERY_LATENCY_SAMPLES = 30; // latency probes of Javascript queries between logging
+static const float MEDIATOR_BROWSER_CLOSE_TIMEOUT = 5.f; // seconds given to browsers to close at exit
 static const float EYEINPUT_MOUSE_OVERRIDE_INIT_FRAME_DURATION = 0.25f; // duration between mouse movement is expected. Triggered by initial movement
 static const float EYEINPUT_MOUSE_OVERRIDE_INIT_DISTANCE = 100.f; // pixels on screen (not best but works)
 static const float EYEINPUT_MOUSE_OVERRIDE_STOP_DURATION = 1.5f; // duration until override is stopped when no mouse movement done
+static const int EYEINPUT_THREAD_PERIOD = 1; // milliseconds between fetching samples on input thread
+static const int EYEINPUT_EVENT_QUEUE_SIZE = 1024; // gaze events buffered between input thread and main thread
+static const float EYEINPUT_STATISTICS_PERIOD = 10.f; // seconds between logging of input thread statistics
+static const double EYEINPUT_SACCADE_VELOCITY = 1000.0; // pixels per second above which gaze is moving in saccade
+static const double EYEINPUT_VELOCITY_INTERVAL = 0.01; // seconds over which velocity of gaze is measured
+static const double EYEINPUT_FIXATION_DISPERSION = 60.0; // pixels of horizontal plus vertical spread allowed within fixation
+static const double EYEINPUT_FIXATION_MIN_DURATION = 0.1; // seconds of low dispersion until fixation is reported
+static const float EYEINPUT_BLINK_MIN_DURATION = 0.05f; // seconds of invalid samples counted as blink
+static const float EYEINPUT_BLINK_MAX_DURATION = 0.5f; // longer runs of invalid samples are tracking loss
+static const int TRACER_RING_SIZE = 1 << 16; // spans kept per thread
+static const float TRACER_SUMMARY_PERIOD = 1.f; // seconds between updates of percentile summary
+static const float TRACER_SUMMARY_WINDOW = 10.f; // seconds of spans considered by percentile summary
+static const std::string TRACER_FILE_NAME = "trace.json";
+static const int JOB_POOL_WORKER_COUNT = 2;
+static const int JOB_POOL_TELEMETRY_CAPACITY = 256; // queued telemetry jobs, oldest are dropped beyond
+static const float JOB_POOL_SHUTDOWN_TIMEOUT = 10.f; // seconds given to queued jobs at exit
 static const std::string LOG_FILE_NAME = "log";
 static const std::string INTERACTION_FILE_NAME = "interaction";
 static const int LOG_FILE_MAX_SIZE = 1024 * 1024;
 static const int LOG_FILE_COUNT = 5;
 static const float MOUSE_CURSOR_RELATIVE_SIZE = 0.1f;
+static const int DOM_NODE_SLOT_MAP_DIRECT_IDS = 1 << 16; // larger ids are mapped through hash map instead of slot array
 static const glm::vec3 DOM_TRIGGER_DEBUG_COLOR = glm::vec3(0, 1, 0);
 static const glm::vec3 DOM_TEXT_LINKS_DEBUG_COLOR = glm::vec3(0, 0, 1);
 static const glm::vec3 DOM_SELECT_FIELD_DEBUG_COLOR = glm::vec3(0, 1, 1);
@@ -51,9 +80,10 @@ static const float BLUR_PERIPHERY_MULTIPLIER = 0.7f;
 static const std::string BOOKMARKS_FILE = "bookmarks.xml";
 static const std::string HISTORY_FILE = "history.xml";
 static const std::string SETTINGS_FILE = "settings.xml";
+static const std::string FAVICONS_FILE = "favicons.cache";
+static const long long FAVICONS_FILE_MAX_SIZE = 8 * 1024 * 1024; // cache file is cleared at startup when larger
 static const int URL_INPUT_BOOKMARKS_ROWS_ON_SCREEN = 6;
 static const int HISTORY_ROWS_ON_SCREEN = 6;
-static const int HISTORY_DISPLAY_COUNT = 20;
 static const int SELECT_FIELD_OPTIONS_ON_SCREEN = 6;
 static const float NOTIFICATION_WIDTH = 0.75f;
 static const float NOTIFICATION_Y = 0.0075f;
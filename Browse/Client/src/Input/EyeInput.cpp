@@ -6,6 +6,7 @@
 #include "EyeInput.h"
 #include "src/Utils/Logger.h"
 #include "src/Setup.h"
+#include "src/Singletons/Tracer.h"
 #include "src/Input/Filters/WeightedAverageFilter.h"
 #include <cmath>
 #include <functional>
@@ -15,7 +16,8 @@ EyeInput::EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, Eyetr
 		new WeightedAverageFilter(
 			setup::FILTER_KERNEL,
 			setup::FILTER_WINDOW_TIME,
-			setup::FILTER_USE_OUTLIER_REMOVAL)))
+			setup::FILTER_USE_OUTLIER_REMOVAL))),
+	_eventDetector([this](const GazeEvent& rEvent) { _gazeEvents.Push(rEvent); })
 {
 	// Create thread for connection to eye tracker
 	_upConnectionThread = std::unique_ptr<std::thread>(new std::thread([this, _pMasterThreadsafeInterface, geometry]()
@@ -154,6 +156,15 @@ EyeInput::EyeInput(MasterThreadsafeInterface* _pMasterThreadsafeInterface, Eyetr
 			{
 				_procPauseLabStream(); // pause streaming immediatelly
 			}
+
+			// Fetch samples at rate of eye tracker instead of once per frame
+			if (setup::EYEINPUT_THREAD)
+			{
+				_upInputThread = std::unique_ptr<std::thread>(new std::thread([this]() { RunInputThread(); }));
+			}
+
+			// Publish connection to main thread, mode of fetching samples is decided now
+			_connected = true;
 		}
 #endif // _WIN32
 	}));
@@ -165,6 +176,18 @@ EyeInput::~EyeInput()
 	LogInfo("EyeInput: Make sure that eye tracker connection thread is joined.");
 	_upConnectionThread->join();
 
+	// Stop input thread before eye tracker is disconnected
+	if (_upInputThread)
+	{
+		{
+			// Set under mutex, so paused thread cannot miss it between check and wait
+			std::lock_guard<std::mutex> lock(_pauseMutex);
+			_inputThreadExit = true;
+		}
+		_pauseChanged.notify_all();
+		_upInputThread->join();
+	}
+
 #ifdef _WIN32
 
 	// Check whether necessary to disconnect
@@ -222,53 +245,38 @@ std::shared_ptr<Input> EyeInput::Update(
 
 #ifdef _WIN32
 
-	if (_info.connected && _procFetchGazeSamples != NULL && _procIsTracking != NULL)
+	if (_connected && _procFetchGazeSamples != NULL && _procIsTracking != NULL)
 	{
-		
-		// Prepare queue to fill
-		SampleQueue spSamples = SampleQueue(new std::deque<SampleData>);
-
-		// Fetch samples
-		_procFetchGazeSamples(spSamples); // shared pointered vector is filled by fetch procedure
-
-		/*
-		// Expecting in screen pixel space
-		for (auto& sample : *spSamples)
+		// Window geometry used to bring samples into window space
+		_windowX = windowX;
+		_windowY = windowY;
+		_windowWidth = windowWidth;
+		_windowHeight = windowHeight;
+
+		// Without input thread, samples are fetched once per frame
+		if (!setup::EYEINPUT_THREAD)
 		{
-			switch (sample.system)
-			{
-			case SampleDataCoordinateSystem::SCREEN_PIXELS:
-				// everything ok
-				break;
-			case SampleDataCoordinateSystem::SCREEN_RELATIVE:
-				// TODO: this is hacky for multiple monitors... on which is the eye trackers / window displayed?
-				break;
-			}
+			TraceSpan fetchSpan("Fetch samples");
+			ProcessSamples(FetchSamples());
 		}
-		*/
 
-		// Convert parameters to double (use same values for all samples,
-		double windowXDouble = (double)windowX;
-		double windowYDouble = (double)windowY;
-		double windowWidthDouble = (double)windowWidth;
-		double windowHeightDouble = (double)windowHeight;
+		// Take over samples which arrived since last frame
+		SampleQueue spSamples = SampleQueue(new std::deque<SampleData>);
+		{
+			std::lock_guard<std::mutex> lock(_pendingSamplesMutex);
+			std::swap(spSamples, _spPendingSamples);
+		}
 
-		// Go over available samples and bring into window space
-		for (auto& sample : *spSamples)
+		// Newest sample is start of gaze to swap latency
+		if (setup::TRACING && !spSamples->empty())
 		{
-			// Do some clamping according to window coordinates for gaze x
-			sample.x = sample.x - windowXDouble;
-			sample.x = sample.x > 0.0 ? sample.x : 0.0;
-			sample.x = sample.x < windowWidthDouble ? sample.x : windowWidthDouble;
-
-			// Do some clamping according to window coordinates for gaze y
-			sample.y = sample.y - windowYDouble;
-			sample.y = sample.y > 0.0 ? sample.y : 0.0;
-			sample.y = sample.y < windowHeightDouble ? sample.y : windowHeightDouble;
+			Tracer::instance().SetFrameSample(spSamples->back().timestamp);
 		}
 
 		// Update filter algorithm and provide local variables as reference
+		TraceSpan filterSpan("Filter");
 		_spFilter->Update(spSamples, _info.samplerate);
+		filterSpan.End();
 
 		// Check, whether eye tracker is tracking
 		isTracking = _procIsTracking();
@@ -342,7 +350,7 @@ std::shared_ptr<Input> EyeInput::Update(
 
 	// Bool to indicate mouse usage for gaze coordinates
 	bool gazeEmulated =
-		!_info.connected // eye tracker not connected
+		!_connected // eye tracker not connected
 		|| _mouseOverride // eye tracker overriden by mouse
 		|| !isTracking; // eye tracker not available
 
@@ -393,6 +401,31 @@ std::shared_ptr<Input> EyeInput::Update(
 		false, // instantInteraction,
 		_spFilter->GetFixationDuration()); // fixationDuration
 
+	// Hand over gaze events detected since last frame
+	GazeEvent event;
+	auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+	while (_gazeEvents.Pop(event))
+	{
+		_statisticsEventLatency += (double)(now - event.timestamp).count();
+		_statisticsEventCount++;
+		spInput->gazeEvents.push_back(event);
+	}
+
+	// Report latency of events
+	_statisticsTime += tpf;
+	if (_statisticsTime >= EYEINPUT_STATISTICS_PERIOD)
+	{
+		if (_statisticsEventCount > 0)
+		{
+			LogDebug("EyeInput: Gaze events per second: ", (float)_statisticsEventCount / _statisticsTime,
+				", latency until frame: ", _statisticsEventLatency / _statisticsEventCount, "ms",
+				", dropped: ", _gazeEvents.GetDropCount());
+		}
+		_statisticsTime = 0;
+		_statisticsEventCount = 0;
+		_statisticsEventLatency = 0;
+	}
+
 	// Return whether gaze coordinates comes from eye tracker
 	return spInput;
 }
@@ -401,9 +434,22 @@ CalibrationResult EyeInput::Calibrate(std::shared_ptr<CalibrationInfo>& rspCalib
 {
 	CalibrationResult result = CALIBRATION_NOT_SUPPORTED;
 #ifdef _WIN32
-	if (_info.connected && _procCalibrate != NULL)
+	if (_connected && _procCalibrate != NULL)
 	{
+		// Do not fetch samples while calibrating, wait until input thread has finished current fetch
+		if (_upInputThread)
+		{
+			std::unique_lock<std::mutex> lock(_pauseMutex);
+			_inputThreadPaused = true;
+			_pauseChanged.wait(lock, [this] { return _inputThreadPauseAcknowledged; });
+		}
 		result = _procCalibrate(rspCalibrationInfo);
+		if (_upInputThread)
+		{
+			std::lock_guard<std::mutex> lock(_pauseMutex);
+			_inputThreadPaused = false;
+		}
+		_pauseChanged.notify_all();
 	}
 #endif // _WIN32
 	return result;
@@ -413,7 +459,7 @@ TrackboxInfo EyeInput::GetTrackboxInfo()
 {
 	TrackboxInfo info;
 #ifdef _WIN32
-	if (_info.connected && _procGetTrackboxInfo != NULL)
+	if (_connected && _procGetTrackboxInfo != NULL)
 	{
 		info = _procGetTrackboxInfo();
 	}
@@ -430,7 +476,7 @@ bool EyeInput::SamplesReceived() const
 void EyeInput::ContinueLabStream()
 {
 #ifdef _WIN32
-	if (_info.connected && _procContinueLabStream != NULL)
+	if (_connected && _procContinueLabStream != NULL)
 	{
 		_procContinueLabStream();
 	}
@@ -440,7 +486,7 @@ void EyeInput::ContinueLabStream()
 void EyeInput::PauseLabStream()
 {
 #ifdef _WIN32
-	if (_info.connected && _procPauseLabStream != NULL)
+	if (_connected && _procPauseLabStream != NULL)
 	{
 		_procPauseLabStream();
 	}
@@ -451,3 +497,113 @@ std::weak_ptr<CustomTransformationInterface> EyeInput::GetCustomTransformationIn
 {
 	return _spFilter;
 }
+
+SampleQueue EyeInput::FetchSamples()
+{
+	// Prepare queue to fill
+	SampleQueue spSamples = SampleQueue(new std::deque<SampleData>);
+
+#ifdef _WIN32
+
+	// Fetch samples
+	_procFetchGazeSamples(spSamples); // shared pointered vector is filled by fetch procedure
+
+	// Convert parameters to double (use same values for all samples)
+	double windowXDouble = (double)_windowX;
+	double windowYDouble = (double)_windowY;
+	double windowWidthDouble = (double)_windowWidth;
+	double windowHeightDouble = (double)_windowHeight;
+
+	// Go over available samples and bring into window space
+	for (auto& sample : *spSamples)
+	{
+		// Do some clamping according to window coordinates for gaze x
+		sample.x = sample.x - windowXDouble;
+		sample.x = sample.x > 0.0 ? sample.x : 0.0;
+		sample.x = sample.x < windowWidthDouble ? sample.x : windowWidthDouble;
+
+		// Do some clamping according to window coordinates for gaze y
+		sample.y = sample.y - windowYDouble;
+		sample.y = sample.y > 0.0 ? sample.y : 0.0;
+		sample.y = sample.y < windowHeightDouble ? sample.y : windowHeightDouble;
+	}
+
+#endif // _WIN32
+
+	return spSamples;
+}
+
+void EyeInput::ProcessSamples(const SampleQueue& rspSamples)
+{
+	if (rspSamples->empty()) { return; }
+
+	// Detect gaze events at rate of samples
+	for (const auto& rSample : *rspSamples)
+	{
+		_eventDetector.Update(rSample);
+	}
+
+	// Store samples until main thread filters them
+	std::lock_guard<std::mutex> lock(_pendingSamplesMutex);
+	_spPendingSamples->insert(_spPendingSamples->end(), rspSamples->begin(), rspSamples->end());
+}
+
+void EyeInput::RunInputThread()
+{
+	LogInfo("EyeInput: Input thread started.");
+	_statisticsStart = std::chrono::steady_clock::now();
+	while (!_inputThreadExit)
+	{
+		// Acknowledge pause and wait until it is over
+		{
+			std::unique_lock<std::mutex> lock(_pauseMutex);
+			if (_inputThreadPaused)
+			{
+				_inputThreadPauseAcknowledged = true;
+				_pauseChanged.notify_all();
+				_pauseChanged.wait(lock, [this] { return !_inputThreadPaused || _inputThreadExit; });
+				_inputThreadPauseAcknowledged = false;
+				continue;
+			}
+		}
+
+		// Fetch and process samples
+		auto start = std::chrono::steady_clock::now();
+		SampleQueue spSamples = FetchSamples();
+		ProcessSamples(spSamples);
+		auto end = std::chrono::steady_clock::now();
+		if (setup::TRACING && !spSamples->empty())
+		{
+			Tracer::instance().Record("Fetch samples", start, end);
+		}
+
+		// Collect statistics
+		auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+		for (const auto& rSample : *spSamples)
+		{
+			_statisticsSampleLatency += (double)(now - rSample.timestamp).count();
+		}
+		_statisticsSampleCount += (int)spSamples->size();
+		_statisticsBusyTime += std::chrono::duration<double, std::milli>(end - start).count();
+
+		// Report rate, latency and load of input thread
+		double period = std::chrono::duration<double>(end - _statisticsStart).count();
+		if (period >= EYEINPUT_STATISTICS_PERIOD)
+		{
+			if (_statisticsSampleCount > 0)
+			{
+				LogDebug("EyeInput: Samples per second: ", _statisticsSampleCount / period,
+					", latency until processed: ", _statisticsSampleLatency / _statisticsSampleCount, "ms",
+					", busy: ", (_statisticsBusyTime / 10.0) / period, "%");
+			}
+			_statisticsSampleCount = 0;
+			_statisticsSampleLatency = 0;
+			_statisticsBusyTime = 0;
+			_statisticsStart = end;
+		}
+
+		// Samples are buffered by plugin, so polling faster than eye tracker rate is sufficient
+		std::this_thread::sleep_for(std::chrono::milliseconds(EYEINPUT_THREAD_PERIOD));
+	}
+	LogInfo("EyeInput: Input thread stopped.");
+}
@@ -4,7 +4,8 @@
 //============================================================================
 // Abstracts input from eyetracker and mouse into general eye input. Does fallback
 // to mouse cursor input provided by GLFW when no eyetracker available. Handles
-// override of eyetracking input when mouse is moved.
+// override of eyetracking input when mouse is moved. Samples are fetched and
+// gaze events are detected on an own thread at the rate of the eye tracker.
 
 #ifndef EYEINPUT_H_
 #define EYEINPUT_H_
@@ -14,12 +15,17 @@
 #include "src/Input/EyeTrackerStatus.h"
 #include "src/Input/Filters/Filter.h"
 #include "src/Input/Input.h"
+#include "src/Input/GazeEventDetector.h"
+#include "src/Utils/LockFreeQueue.h"
 #include "plugins/Eyetracker/Interface/EyetrackerSample.h"
 #include "plugins/Eyetracker/Interface/EyetrackerInfo.h"
 #include "plugins/Eyetracker/Interface/EyetrackerGeometry.h"
 #include <memory>
 #include <vector>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 // Necessary for dynamic DLL loading in Windows
 #ifdef _WIN32
@@ -73,9 +79,56 @@ public:
 
 private:
 
+	// Fetch samples from eye tracker and bring them into window pixels
+	SampleQueue FetchSamples();
+
+	// Detect gaze events in samples and hand both over to main thread
+	void ProcessSamples(const SampleQueue& rspSamples);
+
+	// Loop of input thread
+	void RunInputThread();
+
 	// Thread that connects to eye tracking device
 	std::unique_ptr<std::thread> _upConnectionThread;
 
+	// Thread that fetches samples, started by connection thread after successful connection
+	std::unique_ptr<std::thread> _upInputThread;
+	std::atomic<bool> _inputThreadExit{ false };
+
+	// Pause of input thread while eye tracker is calibrated, acknowledged by input thread
+	std::mutex _pauseMutex; // guards both bools below
+	std::condition_variable _pauseChanged;
+	bool _inputThreadPaused = false;
+	bool _inputThreadPauseAcknowledged = false;
+
+	// Set by connection thread after everything else, including input thread, is set up
+	std::atomic<bool> _connected{ false };
+
+	// Window geometry to transform samples, written by main thread
+	std::atomic<int> _windowX{ 0 };
+	std::atomic<int> _windowY{ 0 };
+	std::atomic<int> _windowWidth{ 0 };
+	std::atomic<int> _windowHeight{ 0 };
+
+	// Samples fetched since last frame, filtered on main thread
+	std::mutex _pendingSamplesMutex;
+	SampleQueue _spPendingSamples = SampleQueue(new std::deque<SampleData>);
+
+	// Detection of gaze events, used by thread which fetches samples
+	GazeEventDetector _eventDetector;
+	LockFreeQueue<GazeEvent> _gazeEvents{ (size_t)EYEINPUT_EVENT_QUEUE_SIZE };
+
+	// Statistics of input thread
+	int _statisticsSampleCount = 0;
+	double _statisticsSampleLatency = 0; // sum in milliseconds from timestamp of sample until processing
+	double _statisticsBusyTime = 0; // sum in milliseconds spent fetching and processing
+	std::chrono::steady_clock::time_point _statisticsStart;
+
+	// Statistics of main thread
+	int _statisticsEventCount = 0;
+	double _statisticsEventLatency = 0; // sum in milliseconds from timestamp of event until handed over to frame
+	float _statisticsTime = 0;
+
 	// ###################################
 	// ### Variables written by thread ###
 	// ###################################
@@ -0,0 +1,154 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "GazeEventDetector.h"
+#include "src/Global.h"
+#include <algorithm>
+#include <cmath>
+
+GazeEventDetector::GazeEventDetector(std::function<void(const GazeEvent&)> callback) : _callback(callback)
+{
+	// Nothing to do
+}
+
+void GazeEventDetector::Update(const SampleData& rSample)
+{
+	// ### INVALID SAMPLES ###
+
+	// Run of invalid samples ends fixation and is later reported as blink or tracking loss
+	if (!rSample.valid)
+	{
+		if (!_invalid)
+		{
+			_invalid = true;
+			_invalidStart = rSample.timestamp;
+			EndFixation(rSample.timestamp);
+			_saccade = false;
+			_count = 0;
+		}
+		return;
+	}
+	if (_invalid)
+	{
+		_invalid = false;
+		const float duration = (float)(rSample.timestamp - _invalidStart).count() / 1000.f;
+		const bool blink = duration >= EYEINPUT_BLINK_MIN_DURATION && duration <= EYEINPUT_BLINK_MAX_DURATION;
+		Emit(blink ? GazeEvent::Type::BLINK : GazeEvent::Type::INVALID, (float)rSample.x, (float)rSample.y, duration, rSample.timestamp);
+		_hasPrevious = false; // no velocity across gap
+		_moving = false;
+	}
+
+	// ### VELOCITY THRESHOLD ###
+
+	// Velocity is measured over fixed interval, because noise between single samples of fast eye trackers
+	// and timestamps with millisecond resolution would make every sample look like saccade
+	if (!_hasPrevious)
+	{
+		_hasPrevious = true;
+		_previousX = rSample.x;
+		_previousY = rSample.y;
+		_previousTimestamp = rSample.timestamp;
+	}
+	else
+	{
+		const double delta = (double)(rSample.timestamp - _previousTimestamp).count() / 1000.0;
+		if (delta >= EYEINPUT_VELOCITY_INTERVAL)
+		{
+			const double distance = std::sqrt(
+				(rSample.x - _previousX) * (rSample.x - _previousX)
+				+ (rSample.y - _previousY) * (rSample.y - _previousY));
+			_moving = (distance / delta) > EYEINPUT_SACCADE_VELOCITY;
+			_previousX = rSample.x;
+			_previousY = rSample.y;
+			_previousTimestamp = rSample.timestamp;
+		}
+	}
+
+	if (_moving)
+	{
+		EndFixation(rSample.timestamp);
+		if (!_saccade)
+		{
+			_saccade = true;
+			_saccadeStart = rSample.timestamp;
+		}
+		_count = 0;
+		return;
+	}
+
+	// ### DISPERSION THRESHOLD ###
+
+	// Start new window or check whether sample keeps window within dispersion threshold
+	if (_count == 0)
+	{
+		ResetWindow(rSample);
+	}
+	else
+	{
+		const double minX = std::min(_minX, rSample.x);
+		const double maxX = std::max(_maxX, rSample.x);
+		const double minY = std::min(_minY, rSample.y);
+		const double maxY = std::max(_maxY, rSample.y);
+		if ((maxX - minX) + (maxY - minY) > EYEINPUT_FIXATION_DISPERSION)
+		{
+			// Gaze drifted away without saccade, start over
+			EndFixation(rSample.timestamp);
+			ResetWindow(rSample);
+			return;
+		}
+		_minX = minX;
+		_maxX = maxX;
+		_minY = minY;
+		_maxY = maxY;
+		_sumX += rSample.x;
+		_sumY += rSample.y;
+		_count++;
+	}
+
+	// Window which lasted long enough is fixation
+	const double windowDuration = (double)(rSample.timestamp - _windowStart).count() / 1000.0;
+	if (!_fixation && windowDuration >= EYEINPUT_FIXATION_MIN_DURATION)
+	{
+		_fixation = true;
+		const float x = (float)(_sumX / _count);
+		const float y = (float)(_sumY / _count);
+		if (_saccade)
+		{
+			_saccade = false;
+			Emit(GazeEvent::Type::SACCADE, x, y, (float)(_windowStart - _saccadeStart).count() / 1000.f, _windowStart);
+		}
+		Emit(GazeEvent::Type::FIXATION_START, x, y, 0.f, rSample.timestamp);
+	}
+}
+
+void GazeEventDetector::Emit(GazeEvent::Type type, float x, float y, float duration, std::chrono::milliseconds timestamp)
+{
+	GazeEvent event;
+	event.type = type;
+	event.x = x;
+	event.y = y;
+	event.duration = duration;
+	event.timestamp = timestamp;
+	_callback(event);
+}
+
+void GazeEventDetector::EndFixation(std::chrono::milliseconds timestamp)
+{
+	if (!_fixation) { return; }
+	_fixation = false;
+	Emit(
+		GazeEvent::Type::FIXATION_END,
+		(float)(_sumX / _count),
+		(float)(_sumY / _count),
+		(float)(timestamp - _windowStart).count() / 1000.f,
+		timestamp);
+}
+
+void GazeEventDetector::ResetWindow(const SampleData& rSample)
+{
+	_minX = _maxX = _sumX = rSample.x;
+	_minY = _maxY = _sumY = rSample.y;
+	_count = 1;
+	_windowStart = rSample.timestamp;
+}
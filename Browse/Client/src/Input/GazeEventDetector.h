@@ -0,0 +1,78 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Detects fixations, saccades and blinks in stream of gaze samples. Velocity
+// threshold (I-VT) separates saccades, dispersion threshold (I-DT) over a
+// minimum duration confirms fixations. Runs once per sample.
+
+#ifndef GAZEEVENTDETECTOR_H_
+#define GAZEEVENTDETECTOR_H_
+
+#include "plugins/Eyetracker/Interface/EyetrackerSample.h"
+#include <chrono>
+#include <functional>
+
+// Event in gaze stream
+struct GazeEvent
+{
+	// Types of events
+	enum class Type { FIXATION_START, FIXATION_END, SACCADE, BLINK, INVALID };
+
+	// Fields
+	Type type = Type::INVALID;
+	float x = 0; // fixation centroid, saccade target or last valid gaze. Window pixels
+	float y = 0;
+	float duration = 0; // seconds. Duration of ended fixation, saccade, blink or tracking loss
+	std::chrono::milliseconds timestamp{ 0 }; // timestamp of sample which caused event
+};
+
+class GazeEventDetector
+{
+public:
+
+	// Constructor. Callback is called for every detected event
+	GazeEventDetector(std::function<void(const GazeEvent&)> callback);
+
+	// Feed single sample in window pixels
+	void Update(const SampleData& rSample);
+
+private:
+
+	// Emit event
+	void Emit(GazeEvent::Type type, float x, float y, float duration, std::chrono::milliseconds timestamp);
+
+	// End current fixation, if any
+	void EndFixation(std::chrono::milliseconds timestamp);
+
+	// Restart dispersion window at given sample
+	void ResetWindow(const SampleData& rSample);
+
+	// Callback for events
+	std::function<void(const GazeEvent&)> _callback;
+
+	// Valid sample at start of current velocity interval
+	bool _hasPrevious = false;
+	double _previousX = 0;
+	double _previousY = 0;
+	std::chrono::milliseconds _previousTimestamp{ 0 };
+	bool _moving = false; // velocity of last interval was above saccade threshold
+
+	// Dispersion window of fixation candidate
+	double _minX = 0, _maxX = 0, _minY = 0, _maxY = 0;
+	double _sumX = 0, _sumY = 0;
+	int _count = 0;
+	std::chrono::milliseconds _windowStart{ 0 };
+
+	// Whether window has been confirmed as fixation
+	bool _fixation = false;
+
+	// Saccade in progress since end of last fixation
+	bool _saccade = false;
+	std::chrono::milliseconds _saccadeStart{ 0 };
+
+	// Run of invalid samples
+	bool _invalid = false;
+	std::chrono::milliseconds _invalidStart{ 0 };
+};
+
+#endif // GAZEEVENTDETECTOR_H_
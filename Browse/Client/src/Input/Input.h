@@ -7,7 +7,9 @@
 #ifndef INPUT_H_
 #define INPUT_H_
 
+#include "src/Input/GazeEventDetector.h"
 #include <memory>
+#include <vector>
 
 class Input
 {
@@ -46,6 +48,8 @@ public:
     bool gazeUponGUI;
 	bool instantInteraction;
 	float fixationDuration; // duration of current fixation (zero if currently saccade happening)
+	bool manualInput = false; // keyboard or mouse has been used since last frame
+	std::vector<GazeEvent> gazeEvents; // events detected since last frame, in window pixels
 };
 
 class TabInput
@@ -71,6 +75,7 @@ public:
 		gazeUponGUI(spInput->gazeUponGUI),
 		instantInteraction(spInput->instantInteraction),
 		fixationDuration(spInput->fixationDuration),
+		gazeEvents(spInput->gazeEvents),
 
 		// TabInput fields
 		webViewPixelGazeX(spInput->gazeX - (float)webViewX),
@@ -118,6 +123,7 @@ public:
 	const bool& gazeUponGUI;
 	const bool& instantInteraction;
 	const float& fixationDuration;
+	const std::vector<GazeEvent>& gazeEvents;
 };
 
 #endif // INPUT_H_
@@ -8,6 +8,7 @@
 #include "src/Utils/Logger.h"
 #include "src/Arguments.h"
 #include "src/ContentPath.h"
+#include "src/Singletons/Tracer.h"
 #include "submodules/glfw/include/GLFW/glfw3.h"
 #include "submodules/text-csv/include/text/csv/ostream.hpp"
 #include <functional>
@@ -111,6 +112,9 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     _pCefMediator = pCefMediator;
 	_userDirectory = userDirectory;
 
+	// Workers for asynchronous jobs
+	_upJobPool = std::unique_ptr<JobPool>(new JobPool(JOB_POOL_WORKER_COUNT, JOB_POOL_TELEMETRY_CAPACITY));
+
     // ### GLFW AND OPENGL ###
 
     // Create OpenGL context
@@ -178,6 +182,10 @@ Master::Master(Mediator* pCefMediator, std::string userDirectory)
     static std::function<void(int, int)> fC = [&](int w, int h) { this->GLFWResizeCallback(w, h); };
     glfwSetFramebufferSizeCallback(_pWindow, [](GLFWwindow* window, int w, int h) { fC(w, h); });
 
+    static std::function<void(int, int)> pC = [&](int x, int y) { this->GLFWWindowPosCallback(x, y); };
+    glfwSetWindowPosCallback(_pWindow, [](GLFWwindow* window, int x, int y) { pC(x, y); });
+    UpdateFramePeriod();
+
 	// ### CONTENT PATH ###
 
 	eyegui::setRootFilepath(RUNTIME_CONTENT_PATH);
@@ -555,8 +563,8 @@ Master::~Master()
     // Manual destruction of Web. Otherwise there are errors in CEF at shutdown (TODO: understand why)
     _upWeb.reset();
 
-	// Wait for all async jobs to finish
-	UpdateAsyncJobs(true);
+	// Give async jobs time to finish, remaining ones are cancelled
+	_upJobPool->Shutdown(JOB_POOL_SHUTDOWN_TIMEOUT);
 
     // Terminate eyeGUI
     eyegui::terminateGUI(_pSuperGUI);
@@ -564,6 +572,12 @@ Master::~Master()
 
     // Terminate GLFW
     glfwTerminate();
+
+	// Store spans for chrome://tracing
+	if (setup::TRACING)
+	{
+		Tracer::instance().Export(_userDirectory + TRACER_FILE_NAME);
+	}
 }
 
 bool Master::Run()
@@ -658,12 +672,10 @@ std::weak_ptr<CustomTransformationInterface> Master::GetCustomTransformationInte
 	return _upEyeInput->GetCustomTransformationInterface();
 }
 
-void Master::PushBackAsyncJob(std::function<bool()> job)
+void Master::PushBackAsyncJob(std::function<bool()> job, JobLane lane, std::string mergeKey)
 {
-	// Delegate job into thread
-	_asyncJobs.push_back(std::async(
-		std::launch::async, // do it asynchronously
-		job));
+	// Delegate job to workers
+	_upJobPool->Push(job, lane, mergeKey);
 }
 
 void Master::SimplePushBackAsyncJob(FirebaseIntegerKey countKey, FirebaseJSONKey recordKey, nlohmann::json record)
@@ -684,7 +696,8 @@ void Master::SimplePushBackAsyncJob(FirebaseIntegerKey countKey, FirebaseJSONKey
 
 		// Return some value (not used)
 		return true;
-	});
+	},
+		JobLane::TELEMETRY);
 }
 
 eyegui::Layout* Master::AddLayout(std::string filepath, int layer, bool visible)
@@ -761,8 +774,8 @@ void Master::Loop()
 {
 	while (!_exit)
 	{
-		// Update the async computations
-		UpdateAsyncJobs(false); // do not wait until finished
+		// Spans recorded from now on belong to this frame
+		if (setup::TRACING) { Tracer::instance().BeginFrame(); }
 
 		// Call exit when window should close
 		if (glfwWindowShouldClose(_pWindow))
@@ -875,6 +888,7 @@ void Master::Loop()
 			windowY,
 			_width,
 			_height); // returns whether gaze was used (or emulated by mouse)
+		spInput->manualInput = _manualInput;
 
 		// Record how long super calibration layout has been visible
 		if (eyegui::isLayoutVisible(_pSuperCalibrationLayout))
@@ -1001,6 +1015,7 @@ void Master::Loop()
 		eyeGUIInput.gazeUsed = spInput->gazeUponGUI;
 
         // Update super GUI, including pause button
+		TraceSpan guiSpan("eyeGUI update");
 		eyeGUIInput = eyegui::updateGUI(_pSuperGUI, tpf, eyeGUIInput); // update super GUI with pause button
         if(_paused)
         {
@@ -1008,9 +1023,12 @@ void Master::Loop()
 			eyeGUIInput.gazeUsed = true; // TODO: null pointer would be nicer
         }
 		eyeGUIInput = eyegui::updateGUI(_pGUI, tpf, eyeGUIInput); // update GUI
+		guiSpan.End();
 
         // Do message loop of CEF
+		TraceSpan messageLoopSpan("CEF message loop");
         _pCefMediator->DoMessageLoopWork(); // TODO: Breaks randomly after sometime in debug mode?
+		messageLoopSpan.End();
 
         // Update our input structure
 		spInput->gazeUponGUI = eyeGUIInput.gazeUsed;
@@ -1033,14 +1051,24 @@ void Master::Loop()
         switch (_currentState)
         {
         case StateType::WEB:
+        {
+            TraceSpan updateSpan("State update");
             nextState = _upWeb->Update(tpf, spInput);
+            updateSpan.End();
+            TraceSpan drawSpan("State draw");
             _upWeb->Draw();
             break;
+        }
         case StateType::SETTINGS:
+        {
+            TraceSpan updateSpan("State update");
             nextState = _upSettings->Update(tpf, spInput);
+            updateSpan.End();
+            TraceSpan drawSpan("State draw");
             _upSettings->Draw();
             break;
         }
+        }
 
         // Check next state
         if (_currentState != nextState)
@@ -1075,6 +1103,7 @@ void Master::Loop()
 		glEnable(GL_DEPTH_TEST);
 
         // Draw eyeGUI on top
+        TraceSpan compositionSpan("eyeGUI draw and composition");
         eyegui::drawGUI(_pGUI);
         eyegui::drawGUI(_pSuperGUI);
 
@@ -1094,51 +1123,103 @@ void Master::Loop()
         // Fill uniforms when necessary
         if(setup::BLUR_PERIPHERY)
         {
-            _upScreenFillingQuad->GetShader()->UpdateValue("focusPixelPosition", glm::vec2(spInput->gazeX, _height - spInput->gazeY)); // OpenGL coordinate system
-            _upScreenFillingQuad->GetShader()->UpdateValue("focusPixelRadius", (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS);
-            _upScreenFillingQuad->GetShader()->UpdateValue("peripheryMultiplier", BLUR_PERIPHERY_MULTIPLIER);
+            _upScreenFillingQuad->GetShader()->UpdateValue(Shader::Uniform::FOCUS_PIXEL_POSITION, glm::vec2(spInput->gazeX, _height - spInput->gazeY)); // OpenGL coordinate system
+            _upScreenFillingQuad->GetShader()->UpdateValue(Shader::Uniform::FOCUS_PIXEL_RADIUS, (float)glm::min(_width, _height) * BLUR_FOCUS_RELATIVE_RADIUS);
+            _upScreenFillingQuad->GetShader()->UpdateValue(Shader::Uniform::PERIPHERY_MULTIPLIER, BLUR_PERIPHERY_MULTIPLIER);
         }
 
          _upScreenFillingQuad->Draw(GL_POINTS);
+         compositionSpan.End();
 
         // Reset reminder BEFORE POLLING
         _leftMouseButtonPressed = false;
         _enterKeyPressed = false;
+        _manualInput = false;
+
+        // Estimate time of frame work for waiting on CEF message loop work. Adapt fast to longer frames and slowly to shorter ones
+        if (_frameStartTime > 0)
+        {
+            double frameWorkTime = std::min(glfwGetTime() - _frameStartTime, _framePeriod);
+            _frameWorkTime = frameWorkTime > _frameWorkTime ? frameWorkTime : 0.95 * _frameWorkTime + 0.05 * frameWorkTime;
+        }
 
         // Swap front and back buffers and poll events
+        TraceSpan swapSpan("Swap");
         glfwSwapBuffers(_pWindow);
+        swapSpan.End();
+        if (setup::TRACING) { Tracer::instance().EndFrame(); }
+        _lastSwapTime = glfwGetTime();
         glfwPollEvents();
+
+        // Do message loop work of CEF which is due or becomes due before next frame has to be started
+        if (setup::CEF_EXTERNAL_MESSAGE_PUMP)
+        {
+            TraceSpan scheduledSpan("CEF scheduled message loop");
+            DoScheduledMessageLoopWork();
+        }
     }
 }
 
-void Master::UpdateAsyncJobs(bool wait)
+void Master::DoScheduledMessageLoopWork()
 {
-	// Check asynchronous jobs
-	int startIndex = _asyncJobs.size() - 1;
-	for (int i = startIndex; i >= 0; i--) // do it from the back
-	{
-		// Retrieve whether asynchronous call is done
-		bool remove = false;
-		if (wait)
-		{
-			_asyncJobs.at(i).wait();
-			remove = true; // waited until it is done, so remove it
-		}
-		else
-		{
-			// We have no time, so wait for nothing and just check
-			if (std::future_status::ready == _asyncJobs.at(i).wait_for(std::chrono::seconds(0)))
-			{
-				remove = true; // done by now, so remove it
-			}
-		}
+    // Frame work must start early enough to reach next vertical sync. Input arriving while waiting is
+    // dispatched to the callbacks and handled by that frame, so no latency is added
+    const double deadline = _lastSwapTime + _framePeriod - _frameWorkTime - MASTER_MESSAGE_LOOP_WAIT_MARGIN;
+    int workCount = 0;
+    _pCefMediator->SetWakeUpOnSchedule(true); // before reading scheduled time, so no wake up gets lost
+    while (true)
+    {
+        // Do what is due, bounded since work may schedule further immediate work
+        double timeUntilWork = _pCefMediator->GetTimeUntilScheduledMessageLoopWork();
+        if (timeUntilWork == 0)
+        {
+            if (++workCount > MASTER_MESSAGE_LOOP_MAX_WORK) { break; }
+            _pCefMediator->DoMessageLoopWork();
+            continue;
+        }
 
-		// Remove future from list when job is done
-		if (remove)
-		{
-			_asyncJobs.erase(_asyncJobs.begin() + i);
-		}
-	}
+        // Wait only for work which becomes due before the deadline
+        double remaining = deadline - glfwGetTime();
+        if (timeUntilWork < 0 || timeUntilWork > remaining) { break; }
+        glfwWaitEventsTimeout(timeUntilWork);
+    }
+    _pCefMediator->SetWakeUpOnSchedule(false);
+
+    // Frame work is measured from here until swap
+    _frameStartTime = glfwGetTime();
+}
+
+void Master::UpdateFramePeriod()
+{
+    // Fullscreen window has its monitor, otherwise take monitor which contains window center
+    GLFWmonitor* pMonitor = glfwGetWindowMonitor(_pWindow);
+    if (pMonitor == NULL)
+    {
+        int x = 0, y = 0, width = 0, height = 0;
+        glfwGetWindowPos(_pWindow, &x, &y);
+        glfwGetWindowSize(_pWindow, &width, &height);
+        const int centerX = x + width / 2;
+        const int centerY = y + height / 2;
+        int count = 0;
+        GLFWmonitor** ppMonitors = glfwGetMonitors(&count);
+        for (int i = 0; i < count; i++)
+        {
+            int monitorX = 0, monitorY = 0;
+            glfwGetMonitorPos(ppMonitors[i], &monitorX, &monitorY);
+            const GLFWvidmode* pMode = glfwGetVideoMode(ppMonitors[i]);
+            if (pMode != NULL
+                && centerX >= monitorX && centerX < monitorX + pMode->width
+                && centerY >= monitorY && centerY < monitorY + pMode->height)
+            {
+                pMonitor = ppMonitors[i];
+                break;
+            }
+        }
+    }
+    if (pMonitor == NULL) { pMonitor = glfwGetPrimaryMonitor(); }
+
+    const GLFWvidmode* pMode = pMonitor != NULL ? glfwGetVideoMode(pMonitor) : NULL;
+    _framePeriod = (pMode != NULL && pMode->refreshRate > 0) ? 1.0 / pMode->refreshRate : MASTER_DEFAULT_FRAME_PERIOD;
 }
 
 void Master::ShowSuperCalibrationLayout()
@@ -1201,12 +1282,15 @@ void Master::PersistDriftGrid(PersistDriftGridReason reason)
 			bool pushedBack = FirebaseMailer::Instance().PushBack_Transform(FirebaseIntegerKey::GENERAL_DRIFT_GRID_COUNT, 1, &promise); // adds one to the count
 			if (pushedBack) { FirebaseMailer::Instance().PushBack_Put(FirebaseJSONKey::GENERAL_DRIFT_GRID, gridJSON, std::to_string(future.get() - 1)); } // send JSON to database
 			return true; // give the future some value
-		});
+		},
+			JobLane::TELEMETRY,
+			"driftGrid" + strReason); // queued grid with same reason is outdated
 	}
 }
 
 void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 {
+    _manualInput = true;
     if (action == GLFW_PRESS)
     {
         switch (key)
@@ -1235,6 +1319,7 @@ void Master::GLFWKeyCallback(int key, int scancode, int action, int mods)
 
 void Master::GLFWMouseButtonCallback(int button, int action, int mods)
 {
+    _manualInput = true;
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS)
     {
         _leftMouseButtonPressed = true;
@@ -1243,7 +1328,13 @@ void Master::GLFWMouseButtonCallback(int button, int action, int mods)
 
 void Master::GLFWCursorPosCallback(double xpos, double ypos)
 {
-    // Nothing to do, yet
+    _manualInput = true;
+}
+
+void Master::GLFWWindowPosCallback(int x, int y)
+{
+    // Window may have moved to other monitor
+    UpdateFramePeriod();
 }
 
 void Master::GLFWResizeCallback(int width, int height)
@@ -22,6 +22,7 @@
 #include "src/Setup.h"
 #include "src/Utils/LerpValue.h"
 #include "src/Utils/Framebuffer.h"
+#include "src/Utils/JobPool.h"
 #include "src/Utils/RenderItem.h"
 #include "src/Input/Filters/CustomTransformationInteface.h"
 #include "externals/OGL/gl_core_3_3.h"
@@ -101,8 +102,8 @@ public:
 		return DashboardParameters(_upSettings->GetFirebaseEmail(), _upSettings->GetFirebasePassword(), setup::FIREBASE_API_KEY, setup::FIREBASE_PROJECT_ID);
 	}
 
-	// Push back async job. Only provide threadsafe calls to the job!!!
-	void PushBackAsyncJob(std::function<bool()> job);
+	// Push back async job. Only provide threadsafe calls to the job!!! Telemetry jobs may be dropped or merged by key
+	void PushBackAsyncJob(std::function<bool()> job, JobLane lane = JobLane::INTERACTIVE, std::string mergeKey = "");
 	void SimplePushBackAsyncJob(FirebaseIntegerKey countKey, FirebaseJSONKey recordKey, nlohmann::json record = nlohmann::json()); // automatically adds start index and date
 
     // ### EYEGUI DELEGATION ###
@@ -277,8 +278,11 @@ private:
     // Loop of master
     void Loop();
 
-	// Update async jobs
-	void UpdateAsyncJobs(bool wait); // wait indicates that it should block the thread until all async jobs are finished
+	// Do message loop work of CEF which is due. Waits for work scheduled before next frame has to be started
+	void DoScheduledMessageLoopWork();
+
+	// Update frame period from refresh rate of monitor which contains the window center
+	void UpdateFramePeriod();
 
 	// Show super calibration layout
 	void ShowSuperCalibrationLayout();
@@ -292,6 +296,7 @@ private:
     void GLFWMouseButtonCallback(int button, int action, int mods);
     void GLFWCursorPosCallback(double xpos, double ypos);
     void GLFWResizeCallback(int width, int height);
+    void GLFWWindowPosCallback(int x, int y);
     void GUIResizeCallback(int width, int height);
     void GUIPrintCallback(std::string message) const;
 
@@ -312,6 +317,12 @@ private:
     // Time
     double _lastTime;
 
+    // Frame timing to wait for CEF message loop work between frames
+    double _framePeriod = 0; // seconds between vertical syncs, set in UpdateFramePeriod
+    double _lastSwapTime = 0; // time at which last swap returned
+    double _frameStartTime = 0; // time at which frame work started after waiting
+    double _frameWorkTime = 0; // estimated seconds from start of frame until swap
+
     // Window resolution
     int _width = setup::INITIAL_WINDOW_WIDTH;
     int _height = setup::INITIAL_WINDOW_HEIGHT;
@@ -319,6 +330,7 @@ private:
     // GLFW callback reminder
     bool _leftMouseButtonPressed = false;
     bool _enterKeyPressed = false;
+    bool _manualInput = false; // any keyboard or mouse input since last frame
 
     // Current state
     StateType _currentState;
@@ -396,8 +408,8 @@ private:
 	// Bool to control data transfer (set by Web as there is the placed the button)
 	bool _dataTransfer = true;
 
-	// Asyncronous calls, e.g. persist Firebase entries
-	std::vector<std::future<bool> > _asyncJobs; // abuse async calls since it is easier to determine whether finished or not
+	// Workers for asyncronous calls, e.g. persist Firebase entries
+	std::unique_ptr<JobPool> _upJobPool;
 
 	// Indicator whether computer should shut down at exit
 	bool _shouldShutdownAtExit = false;
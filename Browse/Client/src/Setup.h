@@ -56,6 +56,9 @@ namespace setup
 	static const float	FILTER_WINDOW_TIME = 1.f; // in seconds, limits the fixation duration in the input structure !!!
 	static const bool	FILTER_USE_OUTLIER_REMOVAL = true;
 
+	// Input thread
+	static const bool	EYEINPUT_THREAD = true; // fetch samples and detect gaze events on own thread at rate of eye tracker
+
 	// Distortion
 	static const bool	EYEINPUT_DISTORT_GAZE = false && !DEPLOYMENT;
 	static const float	EYEINPUT_DISTORT_GAZE_BIAS_X = 64.f; // pixels
@@ -83,10 +86,32 @@ namespace setup
 	static const bool	ENABLE_WEBGL = false; // only on Windows
 	static const bool	BLUR_PERIPHERY = false;
 	static const float	WEB_VIEW_RESOLUTION_SCALE = 1.f;
+	static const bool	WEB_VIEW_DETAIL_RENDERING = true; // render zoomed region of web view with higher device scale factor
+	static const float	WEB_VIEW_DETAIL_SCALE = 2.f; // device scale factor while zoomed in
+	static const float	WEB_VIEW_DETAIL_ZOOM_THRESHOLD = 0.75f; // zoom value below which detail rendering is used (smaller is more zoomed)
+	static const float	WEB_VIEW_DETAIL_MARGIN = 0.25f; // margin around visible region that is uploaded, relative to its size
+	static const bool	WEB_VIEW_FRAME_RATE_GOVERNOR = true; // adapt frame rate of web view rendering to activity
+	static const int	WEB_VIEW_MAX_FRAME_RATE = 60; // while user interacts, page loads or video plays
+	static const int	WEB_VIEW_ANIMATION_FRAME_RATE = 30; // while page animates by itself
+	static const int	WEB_VIEW_IDLE_FRAME_RATE = 10; // while page is static
+	static const int	WEB_VIEW_PAUSED_FRAME_RATE = 2; // while paused, window not focused or Tab hidden
+	static const int	WEB_VIEW_FRAME_RATE_BUDGET = 90; // sum of frame rates over all Tabs, hidden ones included
+	static const bool	WEB_VIEW_FRAME_SYNCHRONIZED_UPLOAD = true; // upload paints of active Tab once per frame, right before composition
+	static const bool	WEB_VIEW_GPU_TIMER_QUERIES = DEBUG_MODE; // measure GPU time of drawing passes of web view
+	static const bool	TRACING = DEBUG_MODE; // trace stages from gaze sample until swap, exported at exit
+	static const bool	TAB_LIFECYCLE_MANAGEMENT = true; // freeze and discard Tabs in background to save memory
+	static const float	TAB_FREEZE_TIME = 60.f; // seconds in background until Tab is frozen
+	static const float	TAB_DISCARD_TIME = 60.f * 15.f; // seconds in background until Tab is discarded
+	static const int	TAB_MAX_LIVE_BACKGROUND_COUNT = 4; // background Tabs beyond that count are discarded, longest idle first
+	static const bool	TAB_ASYNC_BROWSER_CREATION = true; // do not block while renderer process of new Tab starts
 	static const unsigned int	HISTORY_MAX_PAGE_COUNT = 100; // maximal length of history
 	static const bool	USE_DOM_NODE_POLLING = !DEBUG_MODE;
 	static const float	DOM_POLLING_FREQUENCY = 1.0f; // times per second
 	static const int	DOM_POLLING_PARTITION_NUMBER = 8;
+	static const bool	CEF_EXTERNAL_MESSAGE_PUMP = true; // do CEF work when scheduled by CEF, in between frames
+	static const bool	CEF_QUERY_LATENCY_PROBE = false; // let Javascript send time with each poll to measure latency of queries
+	static const bool	DOM_OCCLUSION_GRID = true; // decide occlusion of DOM nodes against fixed elements on browser side
+	static const bool	DOM_OCCLUSION_VALIDATION = false; // let Javascript probe all DOM nodes anyway and log disagreement
 }
 
 #endif // SETUP_H_
@@ -0,0 +1,170 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "Tracer.h"
+#include "src/Global.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+Tracer::Ring::Ring(int threadIndex) : events(TRACER_RING_SIZE), threadIndex(threadIndex)
+{
+	// Nothing to do
+}
+
+Tracer::Tracer()
+{
+	_start = std::chrono::steady_clock::now();
+	_lastSummaryTime = _start;
+}
+
+void Tracer::BeginFrame()
+{
+	_frame++;
+	_frameSample = std::chrono::milliseconds(0);
+}
+
+void Tracer::SetFrameSample(std::chrono::milliseconds timestamp)
+{
+	_frameSample = std::max(_frameSample, timestamp);
+}
+
+void Tracer::EndFrame()
+{
+	auto now = std::chrono::steady_clock::now();
+
+	// Sample timestamps come from system clock, so go back by age of sample
+	if (_frameSample.count() > 0)
+	{
+		auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()) - _frameSample;
+		Record("Gaze to swap", now - age, now);
+	}
+
+	// Summary is not computed every frame
+	if (std::chrono::duration<float>(now - _lastSummaryTime).count() >= TRACER_SUMMARY_PERIOD)
+	{
+		UpdateSummary();
+		_lastSummaryTime = now;
+	}
+}
+
+void Tracer::Record(const char* pName, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+{
+	Ring& rRing = GetRing();
+	const unsigned long long written = rRing.written.load(std::memory_order_relaxed);
+	TraceEvent& rEvent = rRing.events[written % rRing.events.size()];
+	rEvent.pName = pName;
+	rEvent.begin = ToMicroseconds(begin);
+	rEvent.end = ToMicroseconds(end);
+	rEvent.frame = _frame.load(std::memory_order_relaxed);
+	rRing.written.store(written + 1, std::memory_order_release);
+}
+
+bool Tracer::Export(std::string filepath) const
+{
+	std::ofstream file(filepath);
+	if (!file.is_open())
+	{
+		LogError("Tracer: Failed to export trace to ", filepath);
+		return false;
+	}
+
+	// One complete event per span, thread index as thread id
+	file << "{\"traceEvents\":[";
+	bool first = true;
+	int count = 0;
+	{
+		std::lock_guard<std::mutex> lock(_ringsMutex);
+		for (const auto& rupRing : _rings)
+		{
+			for (const auto& rEvent : Snapshot(*rupRing))
+			{
+				file << (first ? "" : ",") << "\n{\"name\":\"" << rEvent.pName
+					<< "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << rupRing->threadIndex
+					<< ",\"ts\":" << rEvent.begin
+					<< ",\"dur\":" << (rEvent.end - rEvent.begin)
+					<< ",\"args\":{\"frame\":" << rEvent.frame << "}}";
+				first = false;
+				count++;
+			}
+		}
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	LogInfo("Tracer: Exported ", count, " spans to ", filepath);
+	return true;
+}
+
+std::vector<TraceEvent> Tracer::Snapshot(const Ring& rRing)
+{
+	const unsigned long long size = rRing.events.size();
+	const unsigned long long written = rRing.written.load(std::memory_order_acquire);
+	const unsigned long long first = written > size ? written - size : 0;
+	std::vector<TraceEvent> events;
+	events.reserve((size_t)(written - first));
+	for (unsigned long long i = first; i < written; i++)
+	{
+		events.push_back(rRing.events[i % size]);
+	}
+
+	// Drop events which owning thread has overwritten or is writing in the meantime
+	const unsigned long long safe = rRing.written.load(std::memory_order_acquire) + 1;
+	if (safe > size + first)
+	{
+		events.erase(events.begin(), events.begin() + (size_t)std::min<unsigned long long>(safe - size - first, events.size()));
+	}
+	return events;
+}
+
+Tracer::Ring& Tracer::GetRing()
+{
+	thread_local Ring* pRing = nullptr;
+	if (pRing == nullptr)
+	{
+		std::lock_guard<std::mutex> lock(_ringsMutex);
+		_rings.push_back(std::unique_ptr<Ring>(new Ring((int)_rings.size())));
+		pRing = _rings.back().get();
+	}
+	return *pRing;
+}
+
+void Tracer::UpdateSummary()
+{
+	// Collect durations of spans which ended within summary window
+	const long long windowStart = ToMicroseconds(std::chrono::steady_clock::now()) - (long long)(TRACER_SUMMARY_WINDOW * 1000000.f);
+	std::map<std::string, std::vector<float> > durations;
+	{
+		std::lock_guard<std::mutex> lock(_ringsMutex);
+		for (const auto& rupRing : _rings)
+		{
+			for (const auto& rEvent : Snapshot(*rupRing))
+			{
+				if (rEvent.end >= windowStart)
+				{
+					durations[rEvent.pName].push_back((float)(rEvent.end - rEvent.begin) / 1000.f);
+				}
+			}
+		}
+	}
+
+	// Percentiles per stage in milliseconds
+	std::ostringstream stream;
+	stream.precision(1);
+	stream << std::fixed << "p50 / p95 / p99 in ms";
+	for (auto& rPair : durations)
+	{
+		auto& rValues = rPair.second;
+		std::sort(rValues.begin(), rValues.end());
+		auto percentile = [&](float p) { return rValues[(size_t)(p * (float)(rValues.size() - 1))]; };
+		stream << "\n" << rPair.first << ": " << percentile(0.5f) << " / " << percentile(0.95f) << " / " << percentile(0.99f);
+	}
+	_summary = stream.str();
+}
+
+long long Tracer::ToMicroseconds(std::chrono::steady_clock::time_point time) const
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(time - _start).count();
+}
@@ -0,0 +1,135 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Singleton to trace duration of stages from arrival of gaze sample until
+// swap of buffers. Each thread writes spans into its own ring buffer without
+// locking. Spans are exported in Chrome trace event format (chrome://tracing)
+// and summarized as percentiles for the debug layout. When disabled in setup,
+// spans compile to nothing.
+
+#ifndef TRACER_H_
+#define TRACER_H_
+
+#include "src/Setup.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Span written into ring buffer of thread
+struct TraceEvent
+{
+	const char* pName = nullptr; // must be string literal
+	long long begin = 0; // microseconds since start of tracer
+	long long end = 0;
+	unsigned int frame = 0;
+};
+
+// Acutal class
+class Tracer
+{
+public:
+
+	// Get instance
+	static Tracer& instance()
+	{
+		static Tracer _instance;
+		return _instance;
+	}
+
+	// Destructor
+	~Tracer() {}
+
+	// Start new frame. Called by master before anything of frame is done
+	void BeginFrame();
+
+	// Remember timestamp of newest gaze sample which contributes to current frame. Timestamp of system clock like in samples
+	void SetFrameSample(std::chrono::milliseconds timestamp);
+
+	// End frame after buffers have been swapped. Records latency from sample to swap
+	void EndFrame();
+
+	// Record span of calling thread
+	void Record(const char* pName, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end);
+
+	// Percentiles of recorded spans, updated periodically by EndFrame
+	std::string GetSummary() const { return _summary; }
+
+	// Export spans in rings as Chrome trace event JSON. Returns whether successful
+	bool Export(std::string filepath) const;
+
+private:
+
+	// Ring buffer of one thread. Written only by that thread
+	struct Ring
+	{
+		Ring(int threadIndex);
+		std::vector<TraceEvent> events;
+		std::atomic<unsigned long long> written{ 0 }; // count of events ever written
+		int threadIndex;
+	};
+
+	// Constructor
+	Tracer();
+
+	// Copy of events currently in ring. Events overwritten while copying are skipped
+	static std::vector<TraceEvent> Snapshot(const Ring& rRing);
+
+	// Get ring of calling thread, created at first call
+	Ring& GetRing();
+
+	// Compute percentiles of span durations
+	void UpdateSummary();
+
+	// Convert time point to microseconds since start
+	long long ToMicroseconds(std::chrono::steady_clock::time_point time) const;
+
+	// Members
+	std::chrono::steady_clock::time_point _start;
+	std::atomic<unsigned int> _frame{ 0 };
+	std::chrono::milliseconds _frameSample{ 0 };
+	std::chrono::steady_clock::time_point _lastSummaryTime;
+	std::string _summary;
+	mutable std::mutex _ringsMutex; // only locked when thread registers its ring and for export
+	std::vector<std::unique_ptr<Ring> > _rings;
+
+	// Disable copy and assignment
+	Tracer(Tracer const&) = delete;
+	void operator=(Tracer const&) = delete;
+};
+
+// Records span from construction until destruction
+class TraceSpan
+{
+public:
+
+	// Constructor. Name must be string literal
+	TraceSpan(const char* pName) : _pName(pName)
+	{
+		if (setup::TRACING) { _begin = std::chrono::steady_clock::now(); }
+	}
+
+	// Destructor
+	~TraceSpan() { End(); }
+
+	// End span before destruction, so linear code needs no extra scope
+	void End()
+	{
+		if (setup::TRACING && !_ended)
+		{
+			_ended = true;
+			Tracer::instance().Record(_pName, _begin, std::chrono::steady_clock::now());
+		}
+	}
+
+private:
+
+	// Members
+	const char* _pName;
+	std::chrono::steady_clock::time_point _begin;
+	bool _ended = false;
+};
+
+#endif // TRACER_H_
@@ -16,6 +16,7 @@ Settings::Settings(Master* pMaster) : State(pMaster)
 {
 	// Initialize members
 	_fullpathSettings = pMaster->GetUserDirectory() + SETTINGS_FILE;
+	_upSettingsWriter = std::unique_ptr<FileWriter>(new FileWriter(_fullpathSettings));
 
 	// Load settings and apply them
 	bool saveSettings = false;
@@ -104,8 +105,8 @@ void Settings::Deactivate()
 	eyegui::setVisibilityOfLayout(_pSettingsLayout, false, false, true);
 }
 
-// Save settings to hard disk. Returns whether successful
-bool Settings::SaveSettings() const
+// Save settings to hard disk in background if they changed since last save
+void Settings::SaveSettings()
 {
 	// Create document
 	tinyxml2::XMLDocument doc;
@@ -178,11 +179,13 @@ bool Settings::SaveSettings() const
 	pHomepage->SetAttribute("url", _webSetup.homepage.c_str());
 	pWeb->InsertFirstChild(pHomepage);
 	
-	// Try to save file
-	tinyxml2::XMLError result = doc.SaveFile(_fullpathSettings.c_str());
+	// Serialize document
+	tinyxml2::XMLPrinter printer;
+	doc.Print(&printer);
+	std::string settings(printer.CStr());
 
-	// Return whether successful
-	return (result == tinyxml2::XMLError::XML_SUCCESS);
+	// Let writer save it, skipped when it equals last successful save
+	_upSettingsWriter->Write(settings);
 }
 
 void Settings::ApplySettings(bool save)
@@ -196,19 +199,21 @@ void Settings::ApplySettings(bool save)
 	// Save it
 	if (save)
 	{
-		if (!SaveSettings()) { LogInfo("Settings: Failed to save settings"); }
+		SaveSettings();
 	}
 }
 
 // Load settings from hard disk. Returns whether successful
 bool Settings::LoadSettings()
 {
-	// Open document
+	// Read last good copy of file, which must be parseable
+	std::string settings;
 	tinyxml2::XMLDocument doc;
-	tinyxml2::XMLError result = doc.LoadFile(_fullpathSettings.c_str());
-
-	// Check result of opening 
-	if (result != tinyxml2::XMLError::XML_SUCCESS) { return false; }
+	if (!FileWriter::Read(_fullpathSettings, settings, [&doc](const std::string& rContent)
+		{ return doc.Parse(rContent.c_str(), rContent.size()) == tinyxml2::XMLError::XML_SUCCESS; }))
+	{
+		return false;
+	}
 
 	// Fetch root
 	tinyxml2::XMLNode* pRoot = doc.FirstChild();
@@ -8,7 +8,9 @@
 #define SETTINGS_H_
 
 #include "src/State/State.h"
+#include "src/Utils/FileWriter.h"
 #include "plugins/Eyetracker/Interface/EyetrackerGeometry.h"
+#include <memory>
 
 class Settings : public State
 {
@@ -59,8 +61,8 @@ private:
 	// Apply and maybe save settings
 	void ApplySettings(bool save = true);
 
-	// Save settings to hard disk. Returns whether successful
-	bool SaveSettings() const;
+	// Save settings to hard disk in background if they changed since last save
+	void SaveSettings();
 
 	// Load settings from hard disk. Returns whether successful
 	bool LoadSettings();
@@ -124,6 +126,9 @@ private:
 
 	// Fullpath to settings file
 	std::string _fullpathSettings;
+
+	// Writer of settings file
+	std::unique_ptr<FileWriter> _upSettingsWriter;
 };
 
 #endif // SETTINGS_H_
@@ -0,0 +1,252 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "FaviconManager.h"
+#include "src/Global.h"
+#include "src/Utils/Logger.h"
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+
+FaviconManager::FaviconManager(std::string userDirectory)
+{
+	// Fill fullpath to cache file
+	_fullpathFavicons = userDirectory + FAVICONS_FILE;
+
+	// Start worker, which loads cache file first
+	_worker = std::thread(&FaviconManager::Work, this);
+}
+
+FaviconManager::~FaviconManager()
+{
+	// Favicons not processed yet are just not cached
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_shutdown = true;
+	}
+	_jobAvailable.notify_all();
+	_worker.join();
+
+	LogInfo("FaviconManager: ", _hitCount, " hits, ", _missCount, " misses, ", _processingTime, "ms processing in background");
+}
+
+FaviconManager::State FaviconManager::GetFavicon(std::string URL, std::shared_ptr<const Favicon>& rspFavicon)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _favicons.find(URL);
+	if (it != _favicons.end())
+	{
+		_hitCount++;
+		rspFavicon = it->second;
+		return State::AVAILABLE;
+	}
+	if (_pendingURLs.find(URL) != _pendingURLs.end())
+	{
+		return State::PENDING;
+	}
+	_missCount++;
+	return State::UNKNOWN;
+}
+
+void FaviconManager::AddFavicon(std::string URL, std::unique_ptr<std::vector<unsigned char> > upData, int width, int height)
+{
+	// Take over pixels without copying
+	Job job;
+	job.URL = URL;
+	job.spFavicon = std::make_shared<Favicon>();
+	job.spFavicon->width = width;
+	job.spFavicon->height = height;
+	job.spFavicon->pixels = std::move(*upData);
+	job.spFavicon->pixels.resize(width * height * 4); // bitmap might be padded
+
+	// Delegate to worker
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_pendingURLs.insert(URL);
+		_jobs.push_back(job);
+	}
+	_jobAvailable.notify_one();
+}
+
+void FaviconManager::Work()
+{
+	// Favicons of earlier sessions
+	LoadFavicons();
+
+	while (true)
+	{
+		// Take next job
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_jobAvailable.wait(lock, [this] { return _shutdown || !_jobs.empty(); });
+			if (_shutdown)
+			{
+				return;
+			}
+			job = _jobs.front();
+			_jobs.pop_front();
+		}
+
+		// Process and store favicon
+		auto start = std::chrono::steady_clock::now();
+		ExtractAccent(*job.spFavicon);
+		SaveFavicon(job.URL, *job.spFavicon);
+		double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		// Make it available. Favicon with more pixels replaces former one
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto& rspFavicon = _favicons[job.URL];
+		if (!rspFavicon || rspFavicon->pixels.size() < job.spFavicon->pixels.size())
+		{
+			rspFavicon = job.spFavicon;
+		}
+		_pendingURLs.erase(job.URL);
+		_processingTime += duration;
+	}
+}
+
+void FaviconManager::ExtractAccent(Favicon& rFavicon)
+{
+	// Sample pixels and take most saturated one which is not transparent
+	const unsigned char* pData = rFavicon.pixels.data();
+	const int size = (int)rFavicon.pixels.size();
+	const int steps = glm::max(1, (rFavicon.width * rFavicon.height) / TAB_ACCENT_COLOR_SAMPLING_POINTS);
+	int maxIndex = -1;
+	float maxSaturation = -1.f;
+	for (int i = 0; i + 3 < size; i += steps * 4)
+	{
+		// Discard pixels that are transparent
+		if (pData[i + 3] < 200)
+		{
+			continue;
+		}
+
+		// Calculate saturation like in HSV color space
+		float r = pData[i];
+		float g = pData[i + 1];
+		float b = pData[i + 2];
+		float max = glm::max(r, glm::max(g, b));
+		float saturation = 0;
+		if (max != 0)
+		{
+			saturation = (max - glm::min(r, glm::min(g, b))) / max;
+		}
+
+		// Is it maximum?
+		if (maxSaturation < saturation)
+		{
+			maxSaturation = saturation;
+			maxIndex = i;
+		}
+	}
+
+	// No opaque pixel found
+	rFavicon.hasAccent = false;
+	if (maxIndex < 0)
+	{
+		return;
+	}
+
+	// Extract accent color
+	glm::vec4 accent(pData[maxIndex] / 255.f, pData[maxIndex + 1] / 255.f, pData[maxIndex + 2] / 255.f, 1.f);
+
+	// Check, whether accent is too much white or too dark
+	float sum = accent.r + accent.g + accent.b; // maximal 3
+	float whiteBorder = 2.0;
+	if (sum >= whiteBorder)
+	{
+		// Too bright, darken it
+		float multiplier = (1.f - ((sum - whiteBorder) / 3.f));
+		accent.r *= multiplier;
+		accent.g *= multiplier;
+		accent.b *= multiplier;
+	}
+	else if (sum <= 0.3f)
+	{
+		// Too dark, use default instead
+		return;
+	}
+	rFavicon.accent = accent;
+	rFavicon.hasAccent = true;
+}
+
+bool FaviconManager::LoadFavicons()
+{
+	std::ifstream file(_fullpathFavicons, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		LogInfo("FaviconManager: No favicons cached yet");
+		return false;
+	}
+
+	// Start over when file became too large
+	if ((long long)file.tellg() > FAVICONS_FILE_MAX_SIZE)
+	{
+		file.close();
+		std::ofstream(_fullpathFavicons, std::ios::binary | std::ios::trunc);
+		LogInfo("FaviconManager: Cleared favicon cache since it became too large");
+		return false;
+	}
+	file.seekg(0);
+
+	// Read records until end of file. Later records replace earlier ones
+	std::map<std::string, std::shared_ptr<const Favicon> > favicons;
+	while (true)
+	{
+		uint32_t length = 0;
+		if (!file.read((char*)&length, sizeof(length)) || length > 4096) { break; }
+		std::string URL(length, '\0');
+		auto spFavicon = std::make_shared<Favicon>();
+		int32_t width = 0, height = 0;
+		uint8_t hasAccent = 0;
+		float accent[4];
+		if (!file.read(&URL[0], length)
+			|| !file.read((char*)&width, sizeof(width))
+			|| !file.read((char*)&height, sizeof(height))
+			|| !file.read((char*)&hasAccent, sizeof(hasAccent))
+			|| !file.read((char*)accent, sizeof(accent))
+			|| width <= 0 || height <= 0 || width > 1024 || height > 1024)
+		{
+			break;
+		}
+		spFavicon->width = width;
+		spFavicon->height = height;
+		spFavicon->hasAccent = hasAccent != 0;
+		spFavicon->accent = glm::vec4(accent[0], accent[1], accent[2], accent[3]);
+		spFavicon->pixels.resize(width * height * 4);
+		if (!file.read((char*)spFavicon->pixels.data(), spFavicon->pixels.size())) { break; }
+		favicons[URL] = spFavicon;
+	}
+
+	// Make them available
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::swap(favicons, _favicons);
+	LogInfo("FaviconManager: Loaded ", _favicons.size(), " cached favicons");
+	return true;
+}
+
+bool FaviconManager::SaveFavicon(const std::string& rURL, const Favicon& rFavicon) const
+{
+	std::ofstream file(_fullpathFavicons, std::ios::binary | std::ios::app);
+	if (!file.is_open())
+	{
+		LogError("FaviconManager: Failed to open ", _fullpathFavicons);
+		return false;
+	}
+
+	// Append record
+	uint32_t length = (uint32_t)rURL.size();
+	int32_t width = rFavicon.width, height = rFavicon.height;
+	uint8_t hasAccent = rFavicon.hasAccent ? 1 : 0;
+	float accent[4] = { rFavicon.accent.r, rFavicon.accent.g, rFavicon.accent.b, rFavicon.accent.a };
+	file.write((const char*)&length, sizeof(length));
+	file.write(rURL.data(), length);
+	file.write((const char*)&width, sizeof(width));
+	file.write((const char*)&height, sizeof(height));
+	file.write((const char*)&hasAccent, sizeof(hasAccent));
+	file.write((const char*)accent, sizeof(accent));
+	file.write((const char*)rFavicon.pixels.data(), rFavicon.pixels.size());
+	return file.good();
+}
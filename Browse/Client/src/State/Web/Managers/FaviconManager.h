@@ -0,0 +1,91 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Manager of favicons, keyed by URL of icon. Accent color is extracted by a
+// worker thread, which also appends favicons to a cache file on hard disk.
+// Favicons of earlier sessions are loaded from there at startup, so Tabs
+// showing same site do not need to download and process icon again.
+
+#ifndef FAVICONMANAGER_H_
+#define FAVICONMANAGER_H_
+
+#include "src/Utils/glmWrapper.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+class FaviconManager
+{
+public:
+
+	// Decoded favicon with precomputed accent color
+	struct Favicon
+	{
+		int width = 0;
+		int height = 0;
+		std::vector<unsigned char> pixels; // RGBA
+		bool hasAccent = false; // otherwise default accent should be used
+		glm::vec4 accent;
+	};
+
+	// State of favicon
+	enum class State { UNKNOWN, PENDING, AVAILABLE };
+
+	// Constructor
+	FaviconManager(std::string userDirectory);
+
+	// Destructor
+	virtual ~FaviconManager();
+
+	// Get favicon of URL. Available favicon is written into shared pointer. Unknown favicons should be downloaded
+	State GetFavicon(std::string URL, std::shared_ptr<const Favicon>& rspFavicon);
+
+	// Add downloaded favicon. It is processed in background and available later
+	void AddFavicon(std::string URL, std::unique_ptr<std::vector<unsigned char> > upData, int width, int height);
+
+private:
+
+	// Downloaded favicon waiting for worker
+	struct Job
+	{
+		std::string URL;
+		std::shared_ptr<Favicon> spFavicon;
+	};
+
+	// Loop of worker
+	void Work();
+
+	// Extract most saturated color which is not too dark as accent
+	static void ExtractAccent(Favicon& rFavicon);
+
+	// Load cache file. Returns whether successful
+	bool LoadFavicons();
+
+	// Append favicon to cache file. Returns whether successful
+	bool SaveFavicon(const std::string& rURL, const Favicon& rFavicon) const;
+
+	// Fullpath to cache file
+	std::string _fullpathFavicons;
+
+	// Worker
+	std::thread _worker;
+	std::mutex _mutex; // guards everything below
+	std::condition_variable _jobAvailable;
+	std::deque<Job> _jobs;
+	bool _shutdown = false;
+	std::map<std::string, std::shared_ptr<const Favicon> > _favicons;
+	std::set<std::string> _pendingURLs;
+
+	// Statistics
+	int _hitCount = 0;
+	int _missCount = 0;
+	double _processingTime = 0; // milliseconds spent by worker
+};
+
+#endif // FAVICONMANAGER_H_
@@ -18,9 +18,34 @@ History::History(Master* pMaster, HistoryManager const * pHistoryManager)
 	// Create layouts
 	_pLayout = _pMaster->AddLayout("layouts/History.xeyegui", EYEGUI_WEB_HISTORY_LAYER, false);
 
+	// Create list of pages, one row is left for title
+	_upList = std::unique_ptr<PagedList>(new PagedList(
+		_pLayout,
+		"history_flow", // same id used in brick
+		"bricks/HistoryFlow.beyegui",
+		"history_stack",
+		"bricks/History.beyegui",
+		{ "grid", "url", "title", "select" },
+		HISTORY_ROWS_ON_SCREEN - 1,
+		"previous_page",
+		"next_page",
+		[this](int row, int entry)
+	{
+		// Fill row with page or leave it empty
+		eyegui::setContentOfTextBlock(_pLayout, PagedList::GetRowId("url", row), entry >= 0 ? _spPages->at(entry)->GetURL() : "");
+		eyegui::setContentOfTextBlock(_pLayout, PagedList::GetRowId("title", row), entry >= 0 ? _spPages->at(entry)->GetTitle() : "");
+		eyegui::setElementActivity(_pLayout, PagedList::GetRowId("select", row), entry >= 0, false);
+	}));
+
 	// Create listener
 	_spHistoryButtonListener = std::shared_ptr<HistoryButtonListener>(new HistoryButtonListener(this));
 	eyegui::registerButtonListener(_pLayout, "close", _spHistoryButtonListener);
+	eyegui::registerButtonListener(_pLayout, "previous_page", _spHistoryButtonListener);
+	eyegui::registerButtonListener(_pLayout, "next_page", _spHistoryButtonListener);
+	for (int row = 0; row < _upList->GetRowCount(); row++)
+	{
+		eyegui::registerButtonListener(_pLayout, PagedList::GetRowId("select", row), _spHistoryButtonListener);
+	}
 }
 
 History::~History()
@@ -52,66 +77,9 @@ void History::Activate(int tabId)
 		// Remember activation
 		_active = true;
 
-		// Fetch history
-		auto spPages = _pHistoryManager->GetHistory();
-
-		// Replace stack in layout with fresh one
-		eyegui::replaceElementWithBrick(
-			_pLayout,
-			"history_flow", // same id used in brick, so no replacement necessary
-			"bricks/HistoryFlow.beyegui",
-			false);
-
-		// Prepare adding of history pages to layout
-		std::string brickId;
-		std::map<std::string, std::string> idMapper;
-
-		// Page count
-		int pageCount = glm::min(HISTORY_DISPLAY_COUNT, (int)spPages->size());
-
-		// Set space of flow
-		float space = ((float)(pageCount + 1) / (float)HISTORY_ROWS_ON_SCREEN); // size + 1 for title
-		space = space < 1.f ? 1.f : space;
-		eyegui::setSpaceOfFlow(_pLayout, "history_flow", space);
-
-		// Go over available pages but maximum the desired count to display
-		for (int i = 0; i < pageCount; i++)
-		{
-			// Brick id
-			brickId = "history_" + std::to_string(i);
-
-			// URL id
-			std::string URLId = "url_" + std::to_string(i);
-
-			// Title id
-			std::string titleId = "title_" + std::to_string(i);
-
-			// Select id
-			std::string selectId = "select_" + std::to_string(i);
-
-			// Id mapper
-			idMapper.clear();
-			idMapper.emplace("grid", brickId);
-			idMapper.emplace("url", URLId);
-			idMapper.emplace("title", titleId);
-			idMapper.emplace("select", selectId);
-
-			// Add brick to stack, which was added by flow brick
-			eyegui::addBrickToStack(
-				_pLayout,
-				"history_stack",
-				"bricks/History.beyegui",
-				idMapper);
-
-			// Set content of displayed URL
-			eyegui::setContentOfTextBlock(_pLayout, URLId, spPages->at(i)->GetURL());
-
-			// Set content of display title
-			eyegui::setContentOfTextBlock(_pLayout, titleId, spPages->at(i)->GetTitle());
-
-			// Register button listener for select buttons
-			eyegui::registerButtonListener(_pLayout, selectId, _spHistoryButtonListener);
-		}
+		// Fetch history and show first page of it
+		_spPages = _pHistoryManager->GetHistory();
+		_upList->Show((int)_spPages->size());
 	}
 }
 
@@ -143,6 +111,14 @@ void History::HistoryButtonListener::down(eyegui::Layout* pLayout, std::string i
 		_pHistory->_collectedURL = u"";
 		_pHistory->_finished = true;
 	}
+	else if (id == "previous_page")
+	{
+		_pHistory->_upList->PreviousPage();
+	}
+	else if (id == "next_page")
+	{
+		_pHistory->_upList->NextPage();
+	}
 	else // some history page has been selected
 	{
 		// Split id by underscore
@@ -152,9 +128,13 @@ void History::HistoryButtonListener::down(eyegui::Layout* pLayout, std::string i
 		// Check for keyword "select"
 		if (((pos = id.find(delimiter)) != std::string::npos) && id.substr(0, pos) == "select")
 		{
-			// Get URL of selected history entry
-			auto spPages = _pHistory->_pHistoryManager->GetHistory();
-			std::string URL = spPages->at((int)(StringToFloat(id.substr(pos + 1, id.length() - 1))))->GetURL();
+			// Get URL of history entry shown in row
+			int entry = _pHistory->_upList->GetEntry((int)(StringToFloat(id.substr(pos + 1, id.length() - 1))));
+			if (entry < 0)
+			{
+				return;
+			}
+			std::string URL = _pHistory->_spPages->at(entry)->GetURL();
 			std::u16string URL16;
 			eyegui_helper::convertUTF8ToUTF16(URL, URL16);
 			_pHistory->_collectedURL = URL16;
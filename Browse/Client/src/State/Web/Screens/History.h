@@ -9,7 +9,9 @@
 #define HISTORY_H_
 
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Screens/PagedList.h"
 #include "submodules/eyeGUI/include/eyeGUI.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -77,6 +79,12 @@ private:
 	// Pointer to layout
 	eyegui::Layout* _pLayout;
 
+	// List of pages in layout
+	std::unique_ptr<PagedList> _upList;
+
+	// Pages of history, obtained at every activation from history manager
+	std::shared_ptr<const std::deque<std::shared_ptr<HistoryManager::Page> > > _spPages;
+
 	// Collected url
 	std::u16string _collectedURL = u"";
 
@@ -0,0 +1,85 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "PagedList.h"
+#include <map>
+
+PagedList::PagedList(
+	eyegui::Layout* pLayout,
+	std::string flowId,
+	std::string flowBrick,
+	std::string stackId,
+	std::string rowBrick,
+	std::vector<std::string> rowIds,
+	int rowCount,
+	std::string previousId,
+	std::string nextId,
+	BindCallback bind)
+{
+	// Fill members
+	_pLayout = pLayout;
+	_rowCount = rowCount;
+	_previousId = previousId;
+	_nextId = nextId;
+	_bind = bind;
+
+	// Replace element with flow containing empty stack
+	eyegui::replaceElementWithBrick(_pLayout, flowId, flowBrick, false);
+
+	// Add rows once, they are filled anew for each page
+	std::map<std::string, std::string> idMapper;
+	for (int row = 0; row < _rowCount; row++)
+	{
+		idMapper.clear();
+		for (const std::string& rId : rowIds)
+		{
+			idMapper.emplace(rId, GetRowId(rId, row));
+		}
+		eyegui::addBrickToStack(_pLayout, stackId, rowBrick, idMapper);
+	}
+}
+
+void PagedList::Show(int entryCount)
+{
+	_entryCount = entryCount;
+	_page = 0;
+	Bind();
+}
+
+void PagedList::NextPage()
+{
+	if ((_page + 1) * _rowCount < _entryCount)
+	{
+		_page++;
+		Bind();
+	}
+}
+
+void PagedList::PreviousPage()
+{
+	if (_page > 0)
+	{
+		_page--;
+		Bind();
+	}
+}
+
+int PagedList::GetEntry(int row) const
+{
+	int entry = _page * _rowCount + row;
+	return (row >= 0 && row < _rowCount && entry < _entryCount) ? entry : -1;
+}
+
+void PagedList::Bind()
+{
+	// Fill rows
+	for (int row = 0; row < _rowCount; row++)
+	{
+		_bind(row, GetEntry(row));
+	}
+
+	// Paging is only possible when there are further entries
+	eyegui::setElementActivity(_pLayout, _previousId, _page > 0, true);
+	eyegui::setElementActivity(_pLayout, _nextId, (_page + 1) * _rowCount < _entryCount, true);
+}
@@ -0,0 +1,70 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// List of rows in stack of layout, showing one page of entries at a time.
+// Row bricks are added only once, so showing or paging costs the same for
+// any count of entries. Rows are filled through callback.
+
+#ifndef PAGEDLIST_H_
+#define PAGEDLIST_H_
+
+#include "submodules/eyeGUI/include/eyeGUI.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+class PagedList
+{
+public:
+
+	// Callback to fill row with entry. Entry is -1 for rows left empty on last page
+	typedef std::function<void(int row, int entry)> BindCallback;
+
+	// Constructor. Flow brick replaces element with flow id and contains stack for rows.
+	// Ids in row brick are suffixed with row, including root element of row brick
+	PagedList(
+		eyegui::Layout* pLayout,
+		std::string flowId,
+		std::string flowBrick,
+		std::string stackId,
+		std::string rowBrick,
+		std::vector<std::string> rowIds,
+		int rowCount,
+		std::string previousId,
+		std::string nextId,
+		BindCallback bind);
+
+	// Show first page of entries
+	void Show(int entryCount);
+
+	// Show next page
+	void NextPage();
+
+	// Show previous page
+	void PreviousPage();
+
+	// Get entry shown in row. Returns -1 if row is empty
+	int GetEntry(int row) const;
+
+	// Get count of rows
+	int GetRowCount() const { return _rowCount; }
+
+	// Get id of element in row, as used in row brick
+	static std::string GetRowId(std::string id, int row) { return id + "_" + std::to_string(row); }
+
+private:
+
+	// Fill rows with entries of current page
+	void Bind();
+
+	// Members
+	eyegui::Layout* _pLayout;
+	int _rowCount;
+	std::string _previousId;
+	std::string _nextId;
+	BindCallback _bind;
+	int _entryCount = 0;
+	int _page = 0;
+};
+
+#endif // PAGEDLIST_H_
@@ -44,6 +44,32 @@ URLInput::URLInput(Master* pMaster, BookmarkManager* pBookmarkManager)
 	eyegui::registerButtonListener(_pLayout, "layout_israel_hebrew", _spURLButtonListener);
 	eyegui::registerButtonListener(_pLayout, "layout_greece_greek", _spURLButtonListener);
 	eyegui::registerButtonListener(_pBookmarksLayout, "back", _spURLButtonListener);
+	eyegui::registerButtonListener(_pBookmarksLayout, "previous_page", _spURLButtonListener);
+	eyegui::registerButtonListener(_pBookmarksLayout, "next_page", _spURLButtonListener);
+
+	// Create list of bookmarks, one row is left for title
+	_upBookmarksList = std::unique_ptr<PagedList>(new PagedList(
+		_pBookmarksLayout,
+		"bookmarks_flow", // same id used in brick
+		"bricks/URLInputBookmarksFlow.beyegui",
+		"bookmark_stack",
+		"bricks/URLInputBookmark.beyegui",
+		{ "grid", "url", "select", "remove" },
+		URL_INPUT_BOOKMARKS_ROWS_ON_SCREEN - 1,
+		"previous_page",
+		"next_page",
+		[this](int row, int entry)
+	{
+		// Fill row with bookmark or leave it empty
+		eyegui::setContentOfTextBlock(_pBookmarksLayout, PagedList::GetRowId("url", row), entry >= 0 ? _bookmarks.at(entry) : "");
+		eyegui::setElementActivity(_pBookmarksLayout, PagedList::GetRowId("select", row), entry >= 0, false);
+		eyegui::setElementActivity(_pBookmarksLayout, PagedList::GetRowId("remove", row), entry >= 0, false);
+	}));
+	for (int row = 0; row < _upBookmarksList->GetRowCount(); row++)
+	{
+		eyegui::registerButtonListener(_pBookmarksLayout, PagedList::GetRowId("remove", row), _spURLButtonListener);
+		eyegui::registerButtonListener(_pBookmarksLayout, PagedList::GetRowId("select", row), _spURLButtonListener);
+	}
 }
 
 URLInput::~URLInput()
@@ -121,61 +147,8 @@ void URLInput::ShowBookmarks()
 	// Get current bookmarks
 	_bookmarks = _pBookmarkManager->GetSortedBookmarks();
 
-	// Prepare adding of bricks
-	std::string brickId;
-	std::map<std::string, std::string> idMapper;
-
-	// Add brick to stack.
-	// Necessary because layout cannot be reset and it is easier
-	// to reset the bookmarks list by replacing the current stack
-	// with an empty one from a brick
-	eyegui::replaceElementWithBrick(
-		_pBookmarksLayout,
-		"bookmarks_flow", // same id used in brick, so no replacement necessary
-		"bricks/URLInputBookmarksFlow.beyegui",
-		false);
-
-	// Set space of flow
-	float space = ((float)(_bookmarks.size() + 1) / (float)URL_INPUT_BOOKMARKS_ROWS_ON_SCREEN); // size + 1 for title
-	space = space < 1.f ? 1.f : space;
-	eyegui::setSpaceOfFlow(_pBookmarksLayout, "bookmarks_flow", space);
-
-	// Go over available bookmarks
-	for (int i = 0; i < (int)_bookmarks.size(); i++)
-	{
-		// Brick id
-		brickId = "bookmark_" + std::to_string(i);
-
-		// URL id
-		std::string URLId = "url_" + std::to_string(i);
-
-		// Bookmark selection id
-		std::string selectId = "select_" + std::to_string(i);
-
-		// Bookmark remove id
-		std::string removeId = "remove_" + std::to_string(i);
-
-		// Id mapper
-		idMapper.clear();
-		idMapper.emplace("grid", brickId);
-		idMapper.emplace("url", URLId);
-		idMapper.emplace("select", selectId);
-		idMapper.emplace("remove", removeId);
-
-		// Add brick to stack, which was added by flow brick
-		eyegui::addBrickToStack(
-			_pBookmarksLayout,
-			"bookmark_stack",
-			"bricks/URLInputBookmark.beyegui",
-			idMapper);
-
-		// Set content of displayed URL
-		eyegui::setContentOfTextBlock(_pBookmarksLayout, URLId, _bookmarks.at(i));
-
-		// Register button listener for remove and select button
-		eyegui::registerButtonListener(_pBookmarksLayout, removeId, _spURLButtonListener);
-		eyegui::registerButtonListener(_pBookmarksLayout, selectId, _spURLButtonListener);
-	}
+	// Show first page of them
+	_upBookmarksList->Show((int)_bookmarks.size());
 
 	// Make layout visible
 	eyegui::setVisibilityOfLayout(_pBookmarksLayout, true, true, true);
@@ -313,18 +286,32 @@ void URLInput::URLButtonListener::down(eyegui::Layout* pLayout, std::string id)
 			eyegui::setVisibilityOfLayout(_pURLInput->_pBookmarksLayout, false, false, true);
 			LabStreamMailer::instance().Send("Hide bookmarks");
 		}
+		else if (id == "previous_page")
+		{
+			_pURLInput->_upBookmarksList->PreviousPage();
+		}
+		else if (id == "next_page")
+		{
+			_pURLInput->_upBookmarksList->NextPage();
+		}
 		else
 		{
 			// Split id by underscore
 			std::string delimiter = "_";
 			size_t pos = 0;
+			int entry = -1;
 			if ((pos = id.find(delimiter)) != std::string::npos)
+			{
+				// Bookmark shown in row
+				entry = _pURLInput->_upBookmarksList->GetEntry((int)(StringToFloat(id.substr(pos + 1, id.length() - 1))));
+			}
+			if (entry >= 0)
 			{
 				// Check for keyword "remove"
 				if (id.substr(0, pos) == "remove")
 				{
 					// Extract URL of chosen bookmark from local cache
-					std::string URL = _pURLInput->_bookmarks.at((int)(StringToFloat(id.substr(pos + 1, id.length() - 1))));
+					std::string URL = _pURLInput->_bookmarks.at(entry);
 
 					// Remove bookmark from manager
 					_pURLInput->_pBookmarkManager->RemoveBookmark(URL); // remove the bookmark
@@ -340,8 +327,8 @@ void URLInput::URLButtonListener::down(eyegui::Layout* pLayout, std::string id)
 				}
 				else if (id.substr(0, pos) == "select") // "select"
 				{
-					// Extract number of bookmark which should be used
-					std::string URL = _pURLInput->_bookmarks.at((int)(StringToFloat(id.substr(pos + 1, id.length() - 1))));
+					// Extract bookmark which should be used
+					std::string URL = _pURLInput->_bookmarks.at(entry);
 					std::u16string URL16;
 					eyegui_helper::convertUTF8ToUTF16(URL, URL16);
 					_pURLInput->_collectedURL = URL16;
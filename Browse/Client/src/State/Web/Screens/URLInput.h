@@ -7,7 +7,9 @@
 #ifndef URLINPUT_H_
 #define URLINPUT_H_
 
+#include "src/State/Web/Screens/PagedList.h"
 #include "submodules/eyeGUI/include/eyeGUI.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -100,6 +102,9 @@ private:
     eyegui::Layout* _pLayout;
 	eyegui::Layout* _pBookmarksLayout;
 
+	// List of bookmarks in bookmarks layout
+	std::unique_ptr<PagedList> _upBookmarksList;
+
     // Collected url
     std::u16string _collectedURL = u"";
 
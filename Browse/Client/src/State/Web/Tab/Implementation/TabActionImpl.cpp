@@ -8,6 +8,7 @@
 #include "src/CEF/Mediator.h"
 #include "src/Utils/Texture.h"
 #include "src/Singletons/LabStreamMailer.h"
+#include "src/Singletons/Tracer.h"
 #include "src/Master/Master.h"
 #include "src/State/Web/Tab/SocialRecord.h"
 #include <locale>
@@ -56,11 +57,14 @@ void Tab::EmulateLeftMouseButtonClick(double x, double y, bool visualize, bool i
 	_userTriggeredClick = userTriggered;
 
 	// Tell mediator about the click
+	TraceSpan span("Mouse emulation");
 	_pCefMediator->EmulateLeftMouseButtonClick(this, x, y);
 }
 
 void Tab::EmulateMouseCursor(double x, double y, bool leftButtonPressed, bool isWebViewPixelCoordinate, double xOffset, double yOffset)
 {
+	TraceSpan span("Mouse emulation");
+
 	// To CEFPixel coordinates
 	if (isWebViewPixelCoordinate)
 	{
@@ -125,10 +129,10 @@ std::weak_ptr<const DOMNode> Tab::GetNearestLink(glm::vec2 pagePixelCoordinate,
         std::weak_ptr<const DOMNode> wpResult;
 
         // Go over links
-        for(const auto& idLinkPair : _TextLinkMap)
+        for(const auto& rspLink : _TextLinkMap)
         {
             // Go over rectangles of that link
-            for(const auto& rRect : idLinkPair.second->GetRects())
+            for(const auto& rRect : rspLink->GetRects())
             {
                 // Distance
                 float dx = glm::max(glm::abs(pagePixelCoordinate.x - rRect.Center().x) - (rRect.Width() / 2.f), 0.f);
@@ -139,7 +143,7 @@ std::weak_ptr<const DOMNode> Tab::GetNearestLink(glm::vec2 pagePixelCoordinate,
                 if(distance < minDistance)
                 {
                     minDistance = distance;
-                    wpResult = idLinkPair.second;
+                    wpResult = rspLink;
                 }
             }
         }
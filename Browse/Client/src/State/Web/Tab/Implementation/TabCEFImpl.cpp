@@ -12,6 +12,7 @@
 #include "src/Singletons/LabStreamMailer.h"
 #include "src/Singletons/FirebaseMailer.h"
 #include "src/CEF/Mediator.h"
+#include "src/Singletons/Tracer.h"
 #include <algorithm>
 
 #define SendRenderMessage [this](CefRefPtr<CefProcessMessage> msg) { return _pCefMediator->SendProcessMessageToRenderer(msg, this); }
@@ -26,11 +27,51 @@ void Tab::GetWebRenderResolution(int& rWidth, int& rHeight) const
 	rHeight = webViewInGUI.height * setup::WEB_VIEW_RESOLUTION_SCALE;
 }
 
+void Tab::ReceiveDetailPaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects)
+{
+	_upWebView->FillDetail(width, height, pBuffer);
+
+	// Staged paint is older than this one, so upload it before standard resolution texture is updated
+	UploadStagedPaint();
+	int targetWidth = 0, targetHeight = 0;
+	GetWebRenderResolution(targetWidth, targetHeight);
+	_upWebView->FillDownsampled(width, height, pBuffer, rDirtyRects, targetWidth, targetHeight);
+}
+
+void Tab::ReceivePaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects)
+{
+	if (!_paintStaged)
+	{
+		_firstStagedPaintTime = std::chrono::steady_clock::now();
+		_paintStaged = true;
+	}
+	_upWebView->StagePaint(width, height, pBuffer, rDirtyRects);
+}
+
 void Tab::SetURL(std::string URL)
 {
 	// Set URL
 	_url = URL;
 
+	// Keep history kept over discarding up to date
+	if (!_restoredHistory.empty())
+	{
+		if (_restoredHistoryNavigationIndex >= 0)
+		{
+			// Going back or forward keeps the entry, even when redirected to another URL
+			_restoredHistory.at(_restoredHistoryNavigationIndex).URL = _url;
+			_restoredHistoryNavigationCommitted = true;
+		}
+		else if (_restoredHistory.at(_restoredHistoryIndex).URL != _url)
+		{
+			// Extend by newly visited page, drops pages in front of current one
+			_restoredHistory.resize(_restoredHistoryIndex + 1);
+			_restoredHistory.push_back(RestoredHistoryEntry());
+			_restoredHistory.back().URL = _url;
+			_restoredHistoryIndex++;
+		}
+	}
+
 	// Reset title
 	_title = "";
 
@@ -45,100 +86,39 @@ void Tab::SetURL(std::string URL)
 	}
 }
 
-void Tab::ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height)
+void Tab::ReceiveFaviconBytes(std::string URL, std::unique_ptr< std::vector<unsigned char> > upData, int width, int height)
 {
-	// Go over colors and get most colorful as accent (should be always RGBA)
-	int size; // width * height * 4
-	if (upData != NULL && ((size = (int)upData->size()) >= 4) && width > 0 && height == width) // only accept square icons
+	// Accent color is extracted by favicon manager in background (bitmap should be always RGBA)
+	if (upData != NULL && width > 0 && height == width && (int)upData->size() >= width * height * 4) // only accept square icons
 	{
-		if (size <= _current_favicon_bytes)
+		TraceSpan span("Favicon handover");
+		if ((width * height * 4) <= _current_favicon_bytes)
 			return;
 
 		LogInfo("Tab: Current favicon resolution -- ", width, " x ", height);
-		_current_favicon_bytes = size;
-
-		// Load icon into eyeGUI
-		eyegui::fetchImage(_pPanelLayout, GetFaviconIdentifier(), width, height, eyegui::ColorFormat::RGBA, upData->data(), true);
-		_faviconLoaded = true;
-
-		// Prepare loop
-		int steps = (width * height) / TAB_ACCENT_COLOR_SAMPLING_POINTS;
-		steps = glm::max(1, steps);
-		int maxIndex = 0;
-		int maxSaturation = 0;
-		bool foundColor = false;
-		for (int i = 0; i < size; i += steps * 4)
-		{
-			// Discard pixels that are transparent
-			if (upData->at(i + 3) < 200)
-			{
-				continue;
-			}
-			else
-			{
-				foundColor = true;
-			}
-
-			// Extract colors
-			float r = upData->at(i);
-			float g = upData->at(i + 1);
-			float b = upData->at(i + 2);
-			// float a = upData->at(i + 3); // not used
-
-			// Calculate saturation like in HSV color space
-			float max = glm::max(r, glm::max(g, b));
-			float saturation = 0;
-			if (max != 0)
-			{
-				float delta = max - glm::min(r, glm::min(g, b));
-				saturation = delta / max;
-				// saturation *= a; // Are values already premultiplied?
-			}
-
-			// Is it maximum?
-			if (maxSaturation < saturation)
-			{
-				maxSaturation = saturation;
-				maxIndex = i;
-			}
-		}
+		_pWeb->AddFavicon(URL, std::move(upData), width, height);
+		_pendingFaviconURLs.insert(URL);
+	}
+	// else: do nothing
+}
 
-		if (foundColor)
-		{
-			// Extract accent color
-			_targetColorAccent = glm::vec4(
-				((float)upData->at(maxIndex) / 255.f),
-				((float)upData->at(maxIndex + 1) / 255.f),
-				((float)upData->at(maxIndex + 2) / 255.f),
-				1.f);
-
-			// Check, whether new target color is too much white
-			float sum = _targetColorAccent.r + _targetColorAccent.g + _targetColorAccent.b; // maximal 3
-			float whiteBorder = 2.0;
-			if (sum >= whiteBorder)
-			{
-				// Too bright, darken it
-				float multiplier = (1.f - ((sum - whiteBorder)/3.f));
-				_targetColorAccent.r *= multiplier;
-				_targetColorAccent.g *= multiplier;
-				_targetColorAccent.b *= multiplier;
-			}
-			else if (sum <= 0.3f)
-			{
-				// Too dark, use default instead
-				_targetColorAccent = TAB_DEFAULT_COLOR_ACCENT;
-			}
-		}
-		else
-		{
-			_targetColorAccent = TAB_DEFAULT_COLOR_ACCENT;
-		}
+void Tab::ApplyFavicon(std::shared_ptr<const FaviconManager::Favicon> spFavicon)
+{
+	TraceSpan span("Favicon upload");
+	int size = (int)spFavicon->pixels.size();
+	if (size <= _current_favicon_bytes)
+		return;
+	_current_favicon_bytes = size;
 
-        // Start color accent interpolation
-        _colorInterpolation = 0;
+	// Load icon into eyeGUI
+	eyegui::fetchImage(_pPanelLayout, GetFaviconIdentifier(), spFavicon->width, spFavicon->height, eyegui::ColorFormat::RGBA, spFavicon->pixels.data(), true);
+	_faviconLoaded = true;
 
-	}
-    // else: do nothing
+	// Use accent color of favicon
+	_targetColorAccent = spFavicon->hasAccent ? spFavicon->accent : TAB_DEFAULT_COLOR_ACCENT;
+
+	// Start color accent interpolation
+	_colorInterpolation = 0;
 }
 
 void Tab::ResetFaviconBytes()
@@ -147,24 +127,39 @@ void Tab::ResetFaviconBytes()
     _faviconLoaded = false;
 	_current_favicon_bytes = 0;
 	_loaded_favicon_urls.clear();
+	_pendingFaviconURLs.clear();
 }
 
 bool Tab::IsFaviconAlreadyAvailable(std::string img_url)
 {
-	if (std::find(_loaded_favicon_urls.begin(), _loaded_favicon_urls.end(), img_url) == _loaded_favicon_urls.end())
+	if (std::find(_loaded_favicon_urls.begin(), _loaded_favicon_urls.end(), img_url) != _loaded_favicon_urls.end())
+	{
+		return true;
+	}
+	_loaded_favicon_urls.push_back(img_url);
+
+	// Favicon might be known from other Tab or earlier session, so no download is necessary
+	std::shared_ptr<const FaviconManager::Favicon> spFavicon;
+	switch (_pWeb->GetFavicon(img_url, spFavicon))
 	{
-		_loaded_favicon_urls.push_back(img_url);
+	case FaviconManager::State::AVAILABLE:
+		ApplyFavicon(spFavicon);
+		return true;
+	case FaviconManager::State::PENDING:
+		_pendingFaviconURLs.insert(img_url);
+		return true;
+	default:
 		return false;
 	}
-	return true;
 }
 
 void Tab::AddDOMTextInput(int id)
 {
 	std::shared_ptr<DOMTextInput> spNode = std::make_shared<DOMTextInput>(id, this);
+	spNode->SetRectStore(_spRectStore);
 
 	// Add node to ID->node map
-	_TextInputMap.emplace(id, spNode);
+	_TextInputMap.Emplace(id, spNode);
 
 	// Create DOMTrigger
 	std::unique_ptr<TextInputTrigger> upDOMTrigger = std::unique_ptr<TextInputTrigger>(new TextInputTrigger(this, _triggers, spNode));
@@ -175,21 +170,24 @@ void Tab::AddDOMTextInput(int id)
 		upDOMTrigger->Activate();
 	}
 
-	// Place trigger in map
-	_textInputTriggers.emplace(id, std::move(upDOMTrigger));
+	// Place trigger in map, replacing trigger of node which has been stored with same id
+	_textInputTriggers[id] = std::move(upDOMTrigger);
 }
 
 void Tab::AddDOMLink(int id)
 {
-	_TextLinkMap.emplace(id, std::make_shared<DOMLink>(id));
+	std::shared_ptr<DOMLink> spNode = std::make_shared<DOMLink>(id);
+	spNode->SetRectStore(_spRectStore);
+	_TextLinkMap.Emplace(id, spNode);
 }
 
 void Tab::AddDOMSelectField(int id)
 {
 	std::shared_ptr<DOMSelectField> spNode = std::make_shared<DOMSelectField>(id, this);
+	spNode->SetRectStore(_spRectStore);
 
 	// Add node to ID->node map
-	_SelectFieldMap.emplace(id, spNode);
+	_SelectFieldMap.Emplace(id, spNode);
 
 	// Create DOMTrigger
 	std::unique_ptr<SelectFieldTrigger> upDOMTrigger = std::unique_ptr<SelectFieldTrigger>(new SelectFieldTrigger(this, _triggers, spNode));
@@ -200,21 +198,24 @@ void Tab::AddDOMSelectField(int id)
 		upDOMTrigger->Activate();
 	}
 
-	// Place trigger in map
-	_selectFieldTriggers.emplace(id, std::move(upDOMTrigger));
+	// Place trigger in map, replacing trigger of node which has been stored with same id
+	_selectFieldTriggers[id] = std::move(upDOMTrigger);
 }
 
 void Tab::AddDOMOverflowElement(int id)
 {
-	_OverflowElementMap.emplace(id, std::make_shared<DOMOverflowElement>(id, this));
+	std::shared_ptr<DOMOverflowElement> spNode = std::make_shared<DOMOverflowElement>(id, this);
+	spNode->SetRectStore(_spRectStore);
+	_OverflowElementMap.Emplace(id, spNode);
 }
 
 void Tab::AddDOMVideo(int id)
 {
 	std::shared_ptr<DOMVideo> spNode = std::make_shared<DOMVideo>(id, this);
+	spNode->SetRectStore(_spRectStore);
 
 	// Add node to ID->node map
-	_VideoMap.emplace(id, spNode);
+	_VideoMap.Emplace(id, spNode);
 
 	// Create DOMTrigger
 	std::unique_ptr<VideoModeTrigger> upDOMTrigger = std::unique_ptr<VideoModeTrigger>(new VideoModeTrigger(this, _triggers, spNode,
@@ -229,49 +230,56 @@ void Tab::AddDOMVideo(int id)
 		upDOMTrigger->Activate();
 	}
 
-	// Place trigger in map
-	_videoModeTriggers.emplace(id, std::move(upDOMTrigger));
+	// Place trigger in map, replacing trigger of node which has been stored with same id
+	_videoModeTriggers[id] = std::move(upDOMTrigger);
 }
 
 void Tab::AddDOMCheckbox(int id)
 {
-	_CheckboxMap.emplace(id, std::make_shared<DOMCheckbox>(id, this));
+	std::shared_ptr<DOMCheckbox> spNode = std::make_shared<DOMCheckbox>(id, this);
+	spNode->SetRectStore(_spRectStore);
+	_CheckboxMap.Emplace(id, spNode);
 }
 
 
-std::weak_ptr<DOMTextInput> Tab::GetDOMTextInput(int id)
+std::shared_ptr<DOMTextInput> Tab::GetDOMTextInput(int id)
 {
-	return (_TextInputMap.find(id) != _TextInputMap.end()) ? _TextInputMap.at(id) : std::weak_ptr<DOMTextInput>();
+	return _TextInputMap.Find(id);
 }
 
-std::weak_ptr<DOMLink> Tab::GetDOMLink(int id)
+std::shared_ptr<DOMLink> Tab::GetDOMLink(int id)
 {
-	return (_TextLinkMap.find(id) != _TextLinkMap.end()) ? _TextLinkMap.at(id) : std::weak_ptr<DOMLink>();
+	return _TextLinkMap.Find(id);
 }
 
-std::weak_ptr<DOMSelectField> Tab::GetDOMSelectField(int id)
+std::shared_ptr<DOMSelectField> Tab::GetDOMSelectField(int id)
 {
-	return (_SelectFieldMap.find(id) != _SelectFieldMap.end()) ? _SelectFieldMap.at(id) : std::weak_ptr<DOMSelectField>();
+	return _SelectFieldMap.Find(id);
 }
 
-std::weak_ptr<DOMOverflowElement> Tab::GetDOMOverflowElement(int id)
+std::shared_ptr<DOMOverflowElement> Tab::GetDOMOverflowElement(int id)
 {
-	return (_OverflowElementMap.find(id) != _OverflowElementMap.end()) ? _OverflowElementMap.at(id) : std::weak_ptr<DOMOverflowElement>();
+	return _OverflowElementMap.Find(id);
 }
 
-std::weak_ptr<DOMVideo> Tab::GetDOMVideo(int id)
+std::shared_ptr<DOMVideo> Tab::GetDOMVideo(int id)
 {
-	return (_VideoMap.find(id) != _VideoMap.end()) ? _VideoMap.at(id) : std::weak_ptr<DOMVideo>();
+	return _VideoMap.Find(id);
 }
 
-std::weak_ptr<DOMCheckbox> Tab::GetDOMCheckbox(int id)
+std::shared_ptr<DOMCheckbox> Tab::GetDOMCheckbox(int id)
 {
-	return (_CheckboxMap.find(id) != _CheckboxMap.end()) ? _CheckboxMap.at(id) : std::weak_ptr<DOMCheckbox>();
+	return _CheckboxMap.Find(id);
 }
 
 
 void Tab::ClearDOMNodes()
 {
+	// Report size of DOM node storage of page which is left
+	LogDebug("Tab: Clearing DOM nodes -- links: ", _TextLinkMap.size(), ", text inputs: ", _TextInputMap.size(),
+		", select fields: ", _SelectFieldMap.size(), ", overflow elements: ", _OverflowElementMap.size(),
+		", videos: ", _VideoMap.size(), ", checkboxes: ", _CheckboxMap.size());
+
 	// Deactivate all triggers
 	for (auto pTrigger : _triggers)
 	{
@@ -284,56 +292,57 @@ void Tab::ClearDOMNodes()
 	_videoModeTriggers.clear();
 
 	// Clear ID->node maps
-	_TextLinkMap.clear();
-	_TextInputMap.clear();
-	_SelectFieldMap.clear();
-	_VideoMap.clear();
-	_CheckboxMap.clear();
+	_TextLinkMap.Clear();
+	_TextInputMap.Clear();
+	_SelectFieldMap.Clear();
+	_VideoMap.Clear();
+	_CheckboxMap.Clear();
 
 	// Clear fixed elements
 	_fixedElements.clear();
+	_fixedElementsTopmost.clear();
 
 	// Clear overflow elements
-	_OverflowElementMap.clear();
+	_OverflowElementMap.Clear();
 }
 
 void Tab::RemoveDOMTextInput(int id)
 {
 	if (_textInputTriggers.find(id) != _textInputTriggers.end()) { _textInputTriggers.erase(id); }
-	if (_TextInputMap.find(id) != _TextInputMap.end()) { _TextInputMap.erase(id); }
+	_TextInputMap.Erase(id);
 }
 
 void Tab::RemoveDOMLink(int id)
 {
-	if (_TextLinkMap.find(id) != _TextLinkMap.end()) { _TextLinkMap.erase(id); }
+	_TextLinkMap.Erase(id);
 }
 
 void Tab::RemoveDOMSelectField(int id)
 {
 	if (_selectFieldTriggers.find(id) != _selectFieldTriggers.end()) { _selectFieldTriggers.erase(id); }
-	if (_SelectFieldMap.find(id) != _SelectFieldMap.end()) { _SelectFieldMap.erase(id); }
+	_SelectFieldMap.Erase(id);
 }
 
 void Tab::RemoveDOMOverflowElement(int id)
 {
-	if (_OverflowElementMap.find(id) != _OverflowElementMap.end()) { _OverflowElementMap.erase(id); }
+	_OverflowElementMap.Erase(id);
 }
 
 void Tab::RemoveDOMVideo(int id)
 {
 	// Exit video mode if currently showing the video
-	if (id == _videoModeId)
+	if (id == _videoModeHandle.id)
 	{
 		ExitVideoMode();
 	}
 
 	if (_videoModeTriggers.find(id) != _videoModeTriggers.end()) { _videoModeTriggers.erase(id); }
-	if (_VideoMap.find(id) != _VideoMap.end()) { _VideoMap.erase(id); }
+	_VideoMap.Erase(id);
 }
 
 void Tab::RemoveDOMCheckbox(int id)
 {
-	if (_CheckboxMap.find(id) != _CheckboxMap.end()) { _CheckboxMap.erase(id); }
+	_CheckboxMap.Erase(id);
 }
 
 
@@ -342,6 +351,13 @@ void Tab::SetScrollingOffset(double x, double y)
 {
 	_scrollingOffsetX = x;
 	_scrollingOffsetY = y;
+
+	// Remember scrolling of current page for going back or forward to it, but not while navigating there
+	if (!_restoredHistory.empty() && _restoredHistoryNavigationIndex < 0)
+	{
+		_restoredHistory.at(_restoredHistoryIndex).scrollingOffsetX = x;
+		_restoredHistory.at(_restoredHistoryIndex).scrollingOffsetY = y;
+	}
 }
 
 void Tab::SetPageResolution(double width, double height)
@@ -354,14 +370,16 @@ void Tab::SetPageResolution(double width, double height)
 	}
 }
 
-void Tab::AddFixedElementsCoordinates(int id, std::vector<Rect> elements)
+void Tab::AddFixedElementsCoordinates(int id, std::vector<Rect> elements, bool topmost)
 {
 	// Assign list of fixed element coordinates to given position
 	if ((int)_fixedElements.size() <= id)
 	{
 		_fixedElements.resize(id + 1);
+		_fixedElementsTopmost.resize(id + 1, false);
 	}
 	_fixedElements[id] = elements;
+	_fixedElementsTopmost[id] = topmost;
 
 }
 
@@ -373,6 +391,7 @@ void Tab::RemoveFixedElement(int id)
 	if ((int)_fixedElements.size() > id)
 	{
 		_fixedElements[id].clear();
+		_fixedElementsTopmost[id] = false;
 	}
 	//else
 	//{
@@ -410,6 +429,23 @@ void Tab::SetLoadingStatus(bool isLoading, bool isMainFrame)
     }
     else
     {
+		// Restore scrolling of restored Tab
+		if (_restoreScrolling)
+		{
+			_restoreScrolling = false;
+			_pCefMediator->SetScrolling(this, _restoreScrollingOffsetX, _restoreScrollingOffsetY);
+			LogInfo("Tab: Restored ", _url, " in ",
+				std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _restoreStartTime).count(), " ms.");
+		}
+
+		// Restore scrolling of page reached by going back or forward through history kept over discarding
+		if (_restoredHistoryNavigationIndex >= 0 && _restoredHistoryNavigationCommitted)
+		{
+			const RestoredHistoryEntry& rEntry = _restoredHistory.at(_restoredHistoryNavigationIndex);
+			_pCefMediator->SetScrolling(this, rEntry.scrollingOffsetX, rEntry.scrollingOffsetY);
+			_restoredHistoryNavigationIndex = -1;
+		}
+
         // Main frame is done with loading
         if (_faviconLoaded)
         {
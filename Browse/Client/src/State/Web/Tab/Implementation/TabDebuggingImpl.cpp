@@ -100,7 +100,7 @@ void Tab::DrawDebuggingOverlay() const
 			matrix = projection * model;
 
 			// Fill uniform with matrix (no need for Bind() since bound in called context)
-			_upDebugLineQuad->GetShader()->UpdateValue("matrix", matrix);
+			_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::MATRIX, matrix);
 
 			// Render rectangle
 			_upDebugLineQuad->Draw(GL_LINES);
@@ -112,7 +112,7 @@ void Tab::DrawDebuggingOverlay() const
 		// ### DOMTRIGGER ###
 
 		// Set rendering up for DOMTrigger
-		_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_TRIGGER_DEBUG_COLOR);
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, DOM_TRIGGER_DEBUG_COLOR);
 
 		// TODO: also implement for select fields
 
@@ -132,10 +132,10 @@ void Tab::DrawDebuggingOverlay() const
 				}
 				else */
 				{
-					_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(0.0f, 1.f, 1.f));
+					_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(0.0f, 1.f, 1.f));
 					renderRect(rRect, rDOMTrigger->GetDOMFixed());
 				
-					_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_TRIGGER_DEBUG_COLOR);
+					_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, DOM_TRIGGER_DEBUG_COLOR);
 				}
 			}
 		}
@@ -144,12 +144,11 @@ void Tab::DrawDebuggingOverlay() const
 		// ### DOMTEXTLINKS ###
 
 		// Set rendering up for DOMTextLink
-		_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_TEXT_LINKS_DEBUG_COLOR);
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, DOM_TEXT_LINKS_DEBUG_COLOR);
 
 		// Go over all DOMTextLinks
-		for (const auto& rIdNodePair : _TextLinkMap)
+		for (const auto& rDOMTextLink : _TextLinkMap)
 		{
-			const auto& rDOMTextLink = rIdNodePair.second;
 			// Render rects
 			for (const auto rRect : rDOMTextLink->GetRects())
 			{
@@ -162,9 +161,9 @@ void Tab::DrawDebuggingOverlay() const
 					);
 				else
 				{
-					_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(0.2, 0.2, 0.2));
+					_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(0.2, 0.2, 0.2));
 					renderRect(rRect, rDOMTextLink->IsFixed());
-					_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_TEXT_LINKS_DEBUG_COLOR);
+					_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, DOM_TEXT_LINKS_DEBUG_COLOR);
 				}
 				// else
 				//	LogInfo("TabDebuggingImpl: Hiding DOMTextLink with id=", rDOMTextLink->GetId());
@@ -172,10 +171,9 @@ void Tab::DrawDebuggingOverlay() const
 		}
 
 		// DEBUG - links containing line break are shown in another color
-		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(1.f, 0.f, 1.f));
-		for (const auto& rIdNodePair : _TextLinkMap)
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(1.f, 0.f, 1.f));
+		for (const auto& rDOMTextLink : _TextLinkMap)
 		{
-			const auto& rDOMTextLink = rIdNodePair.second;
 			if (rDOMTextLink->GetRects().size() > 1)
 				renderRect(
 					rDOMTextLink->GetRects()[1], 
@@ -185,10 +183,9 @@ void Tab::DrawDebuggingOverlay() const
 
 		// ### SELECT FIELDS ###
 		// Set rendering up for DOMSelectFields
-		_upDebugLineQuad->GetShader()->UpdateValue("color", DOM_SELECT_FIELD_DEBUG_COLOR);
-		for (const auto& rIdNodePair : _SelectFieldMap)
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, DOM_SELECT_FIELD_DEBUG_COLOR);
+		for (const auto& rDOMSelectField : _SelectFieldMap)
 		{
-			const auto& rDOMSelectField = rIdNodePair.second;
 			// Render rects
 			for (const auto rRect : rDOMSelectField->GetRects())
 			{
@@ -202,7 +199,7 @@ void Tab::DrawDebuggingOverlay() const
 		// ### FIXED ELEMENTS ###
 
 		// Set rendering up for fixed element
-		_upDebugLineQuad->GetShader()->UpdateValue("color", FIXED_ELEMENT_DEBUG_COLOR);
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, FIXED_ELEMENT_DEBUG_COLOR);
 
 		// Go over all fixed elements vectors
 		for (const auto& rFixedElements : _fixedElements)
@@ -217,11 +214,10 @@ void Tab::DrawDebuggingOverlay() const
 		}
 
 		// ### OVERFLOW ELEMENTS ###
-		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(255.f / 255.f, 127.f / 255.f, 35.f / 255.f));
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(255.f / 255.f, 127.f / 255.f, 35.f / 255.f));
 
-		for (const auto& rIdNodePair : _OverflowElementMap)
+		for (const auto& rOverflowElement : _OverflowElementMap)
 		{
-			const auto& rOverflowElement = rIdNodePair.second;
 			for (const auto& rect : rOverflowElement->GetRects())
 			{
 				renderRect(
@@ -232,11 +228,10 @@ void Tab::DrawDebuggingOverlay() const
 		}
 
 		// ### DOM VIDEO ELEMENTS ### 
-		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(255.f / 255.f, 255.f / 255.f, 60.f / 255.f));
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(255.f / 255.f, 255.f / 255.f, 60.f / 255.f));
 
-		for (const auto& rIdNodePair : _VideoMap)
+		for (const auto& rVideoNode : _VideoMap)
 		{
-			const auto& rVideoNode = rIdNodePair.second;
 			for (const auto& rect : rVideoNode->GetRects())
 			{
 				renderRect(
@@ -247,11 +242,10 @@ void Tab::DrawDebuggingOverlay() const
 		}
 
 		// ### DOM CHECKBOX ELEMENTS ### 
-		_upDebugLineQuad->GetShader()->UpdateValue("color", glm::vec3(120.f / 255.f, 0.f / 255.f, 255.f / 255.f));
+		_upDebugLineQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(120.f / 255.f, 0.f / 255.f, 255.f / 255.f));
 
-		for (const auto& rIdNodePair : _CheckboxMap)
+		for (const auto& rCheckboxNode : _CheckboxMap)
 		{
-			const auto& rCheckboxNode = rIdNodePair.second;
 			for (const auto& rect : rCheckboxNode->GetRects())
 			{
 				renderRect(
@@ -268,7 +262,7 @@ void Tab::DrawDebuggingOverlay() const
 
 	// Bind render item and set color
 	_upDebugFillQuad->Bind();
-	_upDebugFillQuad->GetShader()->UpdateValue("color", glm::vec3(255.f / 255.f, 127.f / 255.f, 35.f / 255.f));
+	_upDebugFillQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, glm::vec3(255.f / 255.f, 127.f / 255.f, 35.f / 255.f));
 
 	// Do it for each gaze sample
 	for (const glm::vec2& rGaze : _gazeDebuggingQueue)
@@ -283,7 +277,7 @@ void Tab::DrawDebuggingOverlay() const
 		matrix = projection * model;
 
 		// Fill uniform with matrix
-		_upDebugFillQuad->GetShader()->UpdateValue("matrix", matrix);
+		_upDebugFillQuad->GetShader()->UpdateValue(Shader::Uniform::MATRIX, matrix);
 
 		// Render rectangle
 		_upDebugFillQuad->Draw(GL_TRIANGLES);
@@ -296,7 +290,7 @@ void Tab::Debug_DrawRectangle(glm::vec2 coordinate, glm::vec2 size, glm::vec3 co
 {
 	// Bind render item and set color
 	_upDebugFillQuad->Bind();
-	_upDebugFillQuad->GetShader()->UpdateValue("color", color);
+	_upDebugFillQuad->GetShader()->UpdateValue(Shader::Uniform::COLOR, color);
 
 	// Projection
 	glm::mat4 projection = glm::ortho(0, 1, 0, 1);
@@ -314,7 +308,7 @@ void Tab::Debug_DrawRectangle(glm::vec2 coordinate, glm::vec2 size, glm::vec3 co
 	auto matrix = projection * model;
 
 	// Fill uniform with matrix
-	_upDebugFillQuad->GetShader()->UpdateValue("matrix", matrix);
+	_upDebugFillQuad->GetShader()->UpdateValue(Shader::Uniform::MATRIX, matrix);
 
 	// Render rectangle
 	_upDebugFillQuad->Draw(GL_TRIANGLES);
@@ -324,7 +318,7 @@ void Tab::Debug_DrawLine(glm::vec2 originCoordinate, glm::vec2 targetCoordinate,
 {
 	// Bind render item and set color
 	_upDebugLine->Bind();
-	_upDebugLine->GetShader()->UpdateValue("color", color);
+	_upDebugLine->GetShader()->UpdateValue(Shader::Uniform::COLOR, color);
 
 	// Projection
 	glm::mat4 projection = glm::ortho(0, 1, 0, 1);
@@ -343,7 +337,7 @@ void Tab::Debug_DrawLine(glm::vec2 originCoordinate, glm::vec2 targetCoordinate,
 	auto matrix = projection * model;
 
 	// Fill uniform with matrix
-	_upDebugLine->GetShader()->UpdateValue("matrix", matrix);
+	_upDebugLine->GetShader()->UpdateValue(Shader::Uniform::MATRIX, matrix);
 
 	// Render line
 	_upDebugLine->Draw(GL_LINES);
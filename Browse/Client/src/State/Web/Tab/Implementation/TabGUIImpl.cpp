@@ -82,46 +82,41 @@ void Tab::TabButtonListener::down(eyegui::Layout* pLayout, std::string id)
 		// ### Vide mode layout ###
 		if (id == "play")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SetPlaying(true);
+				rspVideo->SetPlaying(true);
 				eyegui::setVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, false, false, true); // hide pause overlay
 			}
 		}
 		else if (id == "pause")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SetPlaying(false);
+				rspVideo->SetPlaying(false);
 				eyegui::setVisibilityOfLayout(_pTab->_pVideoModePauseOverlayLayout, true, true, true); // show pause overlay
 			}
 		}
 		else if (id == "volume_up")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SetMuted(false);
-				iter->second->ChangeVolume(0.25f);
+				rspVideo->SetMuted(false);
+				rspVideo->ChangeVolume(0.25f);
 			}
 		}
 		else if (id == "volume_down")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SetMuted(false);
-				iter->second->ChangeVolume(-0.25f);
+				rspVideo->SetMuted(false);
+				rspVideo->ChangeVolume(-0.25f);
 			}
 		}
 		else if (id == "mute")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->ToggleMuted();
+				rspVideo->ToggleMuted();
 			}
 		}
 		else if (id == "exit")
@@ -134,18 +129,16 @@ void Tab::TabButtonListener::down(eyegui::Layout* pLayout, std::string id)
 		// ### Vide mode pause overlay layout ###
 		if (id == "skip-10")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SkipSeconds(-10);
+				rspVideo->SkipSeconds(-10);
 			}
 		}
 		if (id == "skip+30")
 		{
-			auto iter = _pTab->_VideoMap.find(_pTab->_videoModeId);
-			if (iter != _pTab->_VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+			if (const auto& rspVideo = _pTab->_VideoMap.Get(_pTab->_videoModeHandle)) // DOMVideo shown in video mode
 			{
-				iter->second->SkipSeconds(30);
+				rspVideo->SkipSeconds(30);
 			}
 		}
 	}
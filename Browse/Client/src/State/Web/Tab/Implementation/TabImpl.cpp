@@ -9,6 +9,8 @@
 #include "src/Setup.h"
 #include "src/Utils/Helper.h"
 #include "src/Utils/Logger.h"
+#include "src/Utils/Texture.h"
+#include "src/Singletons/Tracer.h"
 #include "src/State/Web/Tab/SocialRecord.h"
 #include <algorithm>
 
@@ -23,6 +25,7 @@ Tab::Tab(
 	_pMaster = pMaster;
 	_pCefMediator = pCefMediator;
 	_pWeb = pWeb;
+	_requestContext = request_context;
 	// URL etc. is set by meditator
 
 	// Create layouts for Tab (overlay at first, because behind other layouts)
@@ -105,6 +108,11 @@ Tab::Tab(
 	auto webViewInGUI = eyegui::getAbsolutePositionAndSizeOfElement(_pPanelLayout, "web_view");
     _upWebView = std::unique_ptr<WebView>(new WebView(webViewInGUI.x, webViewInGUI.y, webViewInGUI.width, webViewInGUI.height));
 
+	// Show loading icon as placeholder until browser is ready
+	eyegui::setImageOfPicture(_pPanelLayout, "icon", "icons/TabLoading_0.png");
+	_timeUntilNextLoadingIconFrame = TAB_LOADING_ICON_FRAME_DURATION;
+	_iconState = IconState::LOADING;
+
 	// Register itself and painted texture in mediator to receive DOMNodes
 	_pCefMediator->RegisterTab(this, url, request_context);
 
@@ -136,6 +144,8 @@ Tab::~Tab()
 
 void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 {
+	TraceSpan span("Tab update");
+
 	// Store tpf
 	_lastTimePerFrame = tpf;
 
@@ -225,27 +235,33 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 		_upWebView->GetResolutionY()
 		);
 
+	// Project rects of DOM nodes into viewport with current scrolling
+	_spRectStore->Project(_scrollingOffsetX, _scrollingOffsetY);
+
+	// Decide occlusion of DOM nodes against fixed elements
+	if (setup::DOM_OCCLUSION_GRID)
+	{
+		UpdateOcclusion();
+	}
+
 	// Update highlight rectangle of webview
 	// TODO: alternative: give webview shared pointer to DOM nodes
-	std::vector<Rect> rects;
-	for (const auto& rIdNodePair : _TextLinkMap)
+	_highlightRects.clear();
+	for (const auto& rspLink : _TextLinkMap)
 	{
-		if (!rIdNodePair.second)
-			continue;
-
 		// Check whether link is visible
-		bool visible = !rIdNodePair.second->IsOccluded();
+		bool visible = !rspLink->IsOccluded();
 
 		// Only highlight if visible
 		if (visible)
 		{
-			for (const auto& rRect : rIdNodePair.second->GetRects())
+			for (const auto& rRect : rspLink->GetRects())
 			{
-				rects.push_back(rRect);
+				_highlightRects.push_back(rRect);
 			}
 		}
 	}
-	_upWebView->SetHighlightRects(rects);
+	_upWebView->SetHighlightRects(_highlightRects);
 
 	// ###########################
 	// ### UPDATE COLOR OF GUI ###
@@ -257,6 +273,23 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 	// ### UPDATE ICON ###
 	// ###################
 
+	// Show favicons which have been processed in background meanwhile
+	for (auto it = _pendingFaviconURLs.begin(); it != _pendingFaviconURLs.end();)
+	{
+		std::shared_ptr<const FaviconManager::Favicon> spFavicon;
+		FaviconManager::State state = _pWeb->GetFavicon(*it, spFavicon);
+		if (state == FaviconManager::State::PENDING)
+		{
+			++it;
+			continue;
+		}
+		if (state == FaviconManager::State::AVAILABLE)
+		{
+			ApplyFavicon(spFavicon);
+		}
+		it = _pendingFaviconURLs.erase(it);
+	}
+
     if (_iconState == IconState::ICON_NOT_FOUND && _faviconLoaded)
 	{
         // Favicon has been loaded now
@@ -290,13 +323,21 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 	}
 
 	// Update text in layout
+    const glm::vec3 passTimes = _upWebView->GetPassTimes(); // page, detail and composition
     eyegui::setContentOfTextBlock(
         _pDebugLayout,
         "web_view_coordinate",
         "Fixed:\n"
         + std::to_string(spTabInput->CEFPixelGazeX) + ", " + std::to_string(spTabInput->CEFPixelGazeY) + "\n"
         + "Scrolled:\n"
-        + std::to_string((int)(spTabInput->CEFPixelGazeX + _scrollingOffsetX)) + ", " + std::to_string((int)(spTabInput->CEFPixelGazeY + _scrollingOffsetY)));
+        + std::to_string((int)(spTabInput->CEFPixelGazeX + _scrollingOffsetX)) + ", " + std::to_string((int)(spTabInput->CEFPixelGazeY + _scrollingOffsetY)) + "\n"
+        + "Frame rate:\n"
+        + std::to_string(_pCefMediator->GetFrameRate(this)) + " (" + std::to_string((int)_paintsPerSecond) + " paints/s)\n"
+        + "Paint latency:\n"
+        + std::to_string(_paintLatency) + "ms (" + std::to_string(_coalescedPaintCount) + " coalesced)\n"
+        + "GPU passes:\n"
+        + std::to_string(passTimes.x) + "ms, " + std::to_string(passTimes.y) + "ms, " + std::to_string(passTimes.z) + "ms"
+        + (setup::TRACING ? "\nLatency:\n" + Tracer::instance().GetSummary() : ""));
 
 	// #######################################
     // ### UPDATE PIPELINE OR STANDARD GUI ###
@@ -350,8 +391,8 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 			_pCefMediator->GetPageResolution(this);
 		}
 
-		// Enable input for panel layout and disable it for pipeline abort layout
-		eyegui::setInputUsageOfLayout(_pPanelLayout, true);
+		// Enable input for panel layout when browser is ready and disable it for pipeline abort layout
+		eyegui::setInputUsageOfLayout(_pPanelLayout, _pCefMediator->IsTabReady(this));
 		eyegui::setInputUsageOfLayout(_pPipelineAbortLayout, false);
 
 		// Manual scrolling
@@ -443,12 +484,12 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
         }
 
 		// Autoscroll inside of DOMOverflowElement if gazed upon
-		for (auto& rIdOverflowPair : _OverflowElementMap)
+		for (const auto& rspOverflowElement : _OverflowElementMap)
 		{
-			auto& rspOverflowElement = rIdOverflowPair.second;
-			if (rspOverflowElement)
+			for (const auto& rRect : rspOverflowElement->GetViewportRects())
 			{
-				for (const auto& rRect : rspOverflowElement->GetRects())
+				// Check if current gaze is inside of overflow element, if so execute scrolling method in corresponding Javascript object
+				if (rRect.IsInside(spTabInput->CEFPixelGazeX, spTabInput->CEFPixelGazeY))
 				{
 					int scrolledCEFPixelGazeX = spTabInput->CEFPixelGazeX;
 					int scrolledCEFPixelGazeY = spTabInput->CEFPixelGazeY;
@@ -460,13 +501,8 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 						scrolledCEFPixelGazeY += _scrollingOffsetY;
 					}
 
-					// Check if current gaze is inside of overflow element, if so execute scrolling method in corresponding Javascript object
-					if (rRect.IsInside(scrolledCEFPixelGazeX, scrolledCEFPixelGazeY))
-					{
-						rspOverflowElement->Scroll(scrolledCEFPixelGazeX, scrolledCEFPixelGazeY);
-						//rspOverflowElement->Scroll(spTabInput->CEFPixelGazeX, spTabInput->CEFPixelGazeY);
-						break;
-					}
+					rspOverflowElement->Scroll(scrolledCEFPixelGazeX, scrolledCEFPixelGazeY);
+					break;
 				}
 			}
 		}
@@ -545,6 +581,26 @@ void Tab::Update(float tpf, const std::shared_ptr<const Input> spInput)
 			}
 		}
 	}
+
+	// ###############################
+	// ### UPDATE DETAIL RENDERING ###
+	// ###############################
+
+	// Web view parameters are set by pipeline above
+	UpdateDetailRendering(tpf);
+
+	// #########################
+	// ### UPDATE FRAME RATE ###
+	// #########################
+
+	UpdateFrameRate(tpf, spInput);
+
+	// ###########################
+	// ### UPLOAD STAGED PAINT ###
+	// ###########################
+
+	// Done last, so paints received until now are composited in this frame
+	UploadStagedPaint();
 }
 
 void Tab::Draw() const
@@ -580,6 +636,12 @@ void Tab::Draw() const
 
 void Tab::Activate()
 {
+	// Bring back discarded or frozen Tab
+	if (_lifecycleState == LifecycleState::FROZEN) { _pCefMediator->UnfreezeTab(this); }
+	Restore();
+	_lifecycleState = LifecycleState::LIVE;
+	_backgroundTime = 0.f;
+
 	// Show layouts
 	eyegui::setVisibilityOfLayout(_pOverlayLayout, true, true, false);
 	eyegui::setVisibilityOfLayout(_pScrollingOverlayLayout, true, true, false);
@@ -620,10 +682,125 @@ void Tab::Deactivate()
 
 	// Remember being not active
 	_active = false;
+
+	// Paints are uploaded directly while not active, so upload remaining staged ones now
+	UploadStagedPaint();
+
+	// Go back to standard resolution
+	UpdateDetailRendering(0.f);
+
+	// Hidden Tab does not need many frames
+	_pCefMediator->RequestFrameRate(this, setup::WEB_VIEW_PAUSED_FRAME_RATE);
+}
+
+void Tab::Freeze()
+{
+	if (_lifecycleState != LifecycleState::LIVE) { return; }
+	LogInfo("Tab: Freezing ", _url);
+	_pCefMediator->FreezeTab(this);
+	_lifecycleState = LifecycleState::FROZEN;
+}
+
+void Tab::Discard()
+{
+	if (_lifecycleState == LifecycleState::DISCARDED) { return; }
+	LogInfo("Tab: Discarding ", _url, ", releasing about ", _upWebView->GetMemoryUsage() / 1024, " KB of GPU memory.");
+
+	// Keep thumbnail for tab overview
+	if (auto spTexture = _upWebView->GetTexture().lock())
+	{
+		spTexture->GetPixelsFromMipMap(
+			WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL,
+			_thumbnailWidth,
+			_thumbnailHeight,
+			_thumbnailData);
+	}
+
+	// Keep navigation history, new browser starts without it. Already restored history is still valid
+	if (_restoredHistory.empty())
+	{
+		std::vector<std::string> URLs;
+		int currentIndex = -1;
+		if (_pCefMediator->GetNavigationURLs(this, URLs, currentIndex) && currentIndex >= 0)
+		{
+			_restoredHistory.resize(URLs.size());
+			for (int i = 0; i < (int)URLs.size(); i++)
+			{
+				_restoredHistory.at(i).URL = URLs.at(i);
+			}
+			_restoredHistory.at(currentIndex).scrollingOffsetX = _scrollingOffsetX;
+			_restoredHistory.at(currentIndex).scrollingOffsetY = _scrollingOffsetY;
+			_restoredHistoryIndex = currentIndex;
+		}
+	}
+	_restoredHistoryNavigationIndex = -1; // page is loaded again at restoration, scrolling is restored there
+
+	// Keep scrolling for restoration
+	_restoreScrollingOffsetX = _scrollingOffsetX;
+	_restoreScrollingOffsetY = _scrollingOffsetY;
+
+	// Close browser and release everything related to rendered page
+	EndSocialRecord();
+	AbortAndClearPipelines();
+	_pCefMediator->UnregisterTab(this);
+	ClearDOMNodes();
+	_loadingFrames.clear();
+	_upWebView->ReleaseResources();
+
+	_lifecycleState = LifecycleState::DISCARDED;
+}
+
+void Tab::Restore()
+{
+	if (_lifecycleState != LifecycleState::DISCARDED) { return; }
+	LogInfo("Tab: Restoring ", _url);
+
+	// Create new browser, scrolling is restored when loading is finished
+	_restoreStartTime = std::chrono::steady_clock::now();
+	_restoreScrolling = true;
+	_pCefMediator->RegisterTab(this, _url, _requestContext);
+
+	// Thumbnail not needed anymore
+	_thumbnailData.clear();
+	_thumbnailData.shrink_to_fit();
+
+	_lifecycleState = LifecycleState::LIVE;
+}
+
+bool Tab::GetPreview(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData) const
+{
+	// Discarded Tab only has its thumbnail
+	if (_lifecycleState == LifecycleState::DISCARDED)
+	{
+		if (_thumbnailData.empty()) { return false; }
+		rWidth = _thumbnailWidth;
+		rHeight = _thumbnailHeight;
+		rData = _thumbnailData;
+		return true;
+	}
+
+	// Fetch pixel data of web view texture
+	if (auto spTexture = _upWebView->GetTexture().lock())
+	{
+		return spTexture->GetPixelsFromMipMap(mipMapLevel, rWidth, rHeight, rData);
+	}
+	return false;
 }
 
 void Tab::OpenURL(std::string URL)
 {
+	// Discarded Tab needs browser again
+	if (_lifecycleState == LifecycleState::DISCARDED)
+	{
+		_url = URL;
+		_restoreScrollingOffsetX = 0.0;
+		_restoreScrollingOffsetY = 0.0;
+		Restore();
+	}
+
+	// New page is added to history kept over discarding instead of replacing entry of going back or forward
+	_restoredHistoryNavigationIndex = -1;
+
 	// Tell CEF to load a new URL (sets later URL and title here)
 	_pCefMediator->LoadURLInTab(this, URL);
 
@@ -648,7 +825,14 @@ void Tab::AbortAndClearPipelines()
 
 void Tab::GoForward()
 {
-	_pCefMediator->GoForward(this);
+	if (_restoredHistory.empty())
+	{
+		_pCefMediator->GoForward(this);
+	}
+	else if (CanGoForward())
+	{
+		GoToRestoredHistoryEntry(_restoredHistoryIndex + 1);
+	}
 
 	// Abort any pipeline execution
 	AbortAndClearPipelines();
@@ -659,7 +843,14 @@ void Tab::GoForward()
 
 void Tab::GoBack()
 {
-	_pCefMediator->GoBack(this);
+	if (_restoredHistory.empty())
+	{
+		_pCefMediator->GoBack(this);
+	}
+	else if (CanGoBack())
+	{
+		GoToRestoredHistoryEntry(_restoredHistoryIndex - 1);
+	}
 
 	// Abort any pipeline execution
 	AbortAndClearPipelines();
@@ -746,14 +937,14 @@ std::vector<Tab::DOMLinkInfo> Tab::RetrieveDOMLinkInfos() const
 {
 	std::vector<Tab::DOMLinkInfo> result;
 	result.reserve(_TextLinkMap.size());
-	for (const auto& rLink : _TextLinkMap)
+	for (const auto& rspLink : _TextLinkMap)
 	{
-		if (!rLink.second->GetRects().empty()) // there is at least one rectangle
+		if (!rspLink->GetRects().empty()) // there is at least one rectangle
 		{
-			std::string text = rLink.second->GetText();
+			std::string text = rspLink->GetText();
 			if (!text.empty()) // there is some text
 			{
-				result.push_back(Tab::DOMLinkInfo(rLink.second->GetRects(), text));
+				result.push_back(Tab::DOMLinkInfo(rspLink->GetRects(), text));
 			}
 		}
 	}
@@ -799,17 +990,16 @@ void Tab::EnterVideoMode(int id)
 {
 	if (!_pipelineActive)
 	{
-		auto iter = _VideoMap.find(id);
-		if (iter != _VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+		if (const auto& rspVideo = _VideoMap.Find(id)) // search for DOMVideo corresponding to id
 		{
 			// Set fullscreen
-			iter->second->SetFullscreen(true);
+			rspVideo->SetFullscreen(true);
 
 			// Hide controls
-			iter->second->ShowControls(false);
+			rspVideo->ShowControls(false);
 
-			// Store id
-			_videoModeId = id;
+			// Store handle, which becomes dead when video is removed
+			_videoModeHandle = _VideoMap.GetHandle(id);
 
 			// Set visibility of layout
 			eyegui::setVisibilityOfLayout(_pVideoModeLayout, true, true, true);
@@ -831,20 +1021,19 @@ void Tab::EnterVideoMode(int id)
 
 void Tab::ExitVideoMode(bool immediately)
 {
-	if (_videoModeId >= 0)
+	if (_videoModeHandle.id >= 0)
 	{
-		auto iter = _VideoMap.find(_videoModeId);
-		if (iter != _VideoMap.end()) // search for DOMVideo corresponding to videoModeId
+		if (const auto& rspVideo = _VideoMap.Get(_videoModeHandle)) // DOMVideo shown in video mode, if not removed meanwhile
 		{
 			// Return from fullscreen
-			iter->second->SetFullscreen(false);
+			rspVideo->SetFullscreen(false);
 
 			// Show controls
-			iter->second->ShowControls(true);
+			rspVideo->ShowControls(true);
 		}
 
-		// Reset id
-		_videoModeId = -1; // indicating that video mode is off
+		// Reset handle
+		_videoModeHandle = DOMNodeHandle(); // indicating that video mode is off
 
 		// Set visibility of layout
 		eyegui::setVisibilityOfLayout(_pVideoModeLayout, false, false, !immediately);
@@ -1004,6 +1193,226 @@ void Tab::UpdateAccentColor(float tpf)
 	);
 }
 
+void Tab::UpdateDetailRendering(float tpf)
+{
+	// Render with higher device scale factor while zoomed in (smaller zoom value means more magnification)
+	bool detail = setup::WEB_VIEW_DETAIL_RENDERING && _active && (_webViewParameters.zoom <= setup::WEB_VIEW_DETAIL_ZOOM_THRESHOLD);
+	float scaleFactor = detail ? setup::WEB_VIEW_DETAIL_SCALE : 1.f;
+	if (scaleFactor != _webRenderScaleFactor)
+	{
+		_webRenderScaleFactor = scaleFactor;
+		_pCefMediator->NotifyScreenInfoChanged(this);
+	}
+
+	// Visible region of web view after zooming, calculated like in composition shader of WebView
+	const glm::vec2& rCenterOffset = _webViewParameters.centerOffset;
+	const glm::vec2& rZoomPosition = _webViewParameters.zoomPosition;
+	const float zoom = _webViewParameters.zoom;
+	glm::vec2 visibleMin = ((rCenterOffset - rZoomPosition) * zoom) + rZoomPosition;
+	glm::vec2 visibleMax = ((glm::vec2(1.f, 1.f) + rCenterOffset - rZoomPosition) * zoom) + rZoomPosition;
+
+	// Ask for new paint when detail does not cover visible region. Requests are rate limited,
+	// because region stays uncovered until paint with new device scale factor arrives
+	_detailInvalidationCooldown = glm::max(0.f, _detailInvalidationCooldown - tpf);
+	if (detail && _detailInvalidationCooldown > 0.f) { return; }
+	if (_upWebView->SetDetailRegion(detail, glm::vec4(visibleMin, visibleMax)))
+	{
+		_pCefMediator->InvalidateTab(this);
+		_detailInvalidationCooldown = TAB_DETAIL_INVALIDATION_INTERVAL;
+	}
+}
+
+void Tab::UpdateFrameRate(float tpf, const std::shared_ptr<const Input> spInput)
+{
+	// Measure paints per second
+	_frameRateMeasurementTime += tpf;
+	if (_frameRateMeasurementTime >= TAB_FRAME_RATE_MEASUREMENT_INTERVAL)
+	{
+		unsigned int paintCount = _pCefMediator->GetPaintCount(this);
+		_paintsPerSecond = (float)(paintCount - _frameRatePrevPaintCount) / _frameRateMeasurementTime;
+		_frameRatePrevPaintCount = paintCount;
+		_frameRateMeasurementTime = 0.f;
+	}
+
+	// Gaze movement is measured from position at last activity, so slow movement is counted, too
+	glm::vec2 gaze(spInput->gazeX, spInput->gazeY);
+	bool gazeMovement = glm::distance(gaze, _frameRatePrevGaze) > TAB_FRAME_RATE_GAZE_MOVEMENT;
+
+	// Activity which requires fluid rendering
+	bool activity =
+		_pipelineActive // zooming etc.
+		|| _videoModeHandle.id >= 0 // video mode
+		|| !_loadingFrames.empty() // page loading
+		|| _autoScrollingValue != 0.f // automatic scrolling
+		|| _scrollingOffsetY != _frameRatePrevScrolling // scrolling
+		|| gazeMovement // gaze movement
+		|| spInput->instantInteraction // interaction with gaze
+		|| spInput->manualInput; // keyboard or mouse
+	if (activity) { _frameRatePrevGaze = gaze; }
+	_frameRatePrevScrolling = _scrollingOffsetY;
+	_frameRateIdleTime = activity ? 0.f : _frameRateIdleTime + tpf;
+
+	// Page which paints about as often as allowed is animating by itself. It counts as animating until it
+	// paints less often than idle frame rate allows, so it does not toggle between both frame rates
+	if (_paintsPerSecond >= TAB_FRAME_RATE_ANIMATION_RATIO * (float)_pCefMediator->GetFrameRate(this))
+	{
+		_frameRateAnimation = true;
+	}
+	else if (_paintsPerSecond < TAB_FRAME_RATE_ANIMATION_RATIO * (float)setup::WEB_VIEW_IDLE_FRAME_RATE)
+	{
+		_frameRateAnimation = false;
+	}
+
+	// Decide about frame rate
+	int frameRate = setup::WEB_VIEW_MAX_FRAME_RATE;
+	if (_pMaster->IsPaused() || !spInput->windowFocused)
+	{
+		frameRate = setup::WEB_VIEW_PAUSED_FRAME_RATE;
+	}
+	else if (_frameRateIdleTime >= TAB_FRAME_RATE_IDLE_TIME)
+	{
+		frameRate = _frameRateAnimation ? setup::WEB_VIEW_ANIMATION_FRAME_RATE : setup::WEB_VIEW_IDLE_FRAME_RATE;
+	}
+	_pCefMediator->RequestFrameRate(this, frameRate);
+}
+
+void Tab::UpdateOcclusion()
+{
+	auto start = std::chrono::steady_clock::now();
+
+	// Rasterize fixed elements into grid. Only those which Javascript found on top of the page occlude, others
+	// may be backgrounds or let pointer events pass through
+	_occlusionGrid.Reset(_upWebView->GetResolutionX(), _upWebView->GetResolutionY(), TAB_OCCLUSION_GRID_CELL_SIZE);
+	for (int i = 0; i < (int)_fixedElements.size(); i++)
+	{
+		if (!_fixedElementsTopmost[i]) { continue; }
+		for (const auto& rElement : _fixedElements[i])
+		{
+			_occlusionGrid.Add(rElement);
+		}
+	}
+
+	// Test DOM nodes against grid
+	for (const auto& rspNode : _TextLinkMap) { DecideOcclusion(rspNode); }
+	for (const auto& rspNode : _TextInputMap) { DecideOcclusion(rspNode); }
+	for (const auto& rspNode : _SelectFieldMap) { DecideOcclusion(rspNode); }
+	for (const auto& rspNode : _OverflowElementMap) { DecideOcclusion(rspNode); }
+	for (const auto& rspNode : _VideoMap) { DecideOcclusion(rspNode); }
+	for (const auto& rspNode : _CheckboxMap) { DecideOcclusion(rspNode); }
+
+	_occlusionTime += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	// Log statistics from time to time
+	if (++_occlusionFrameCount >= TAB_OCCLUSION_STATISTICS_FRAMES)
+	{
+		LogInfo("Tab: Occlusion took ", _occlusionTime / _occlusionFrameCount, "ms per frame, ",
+			_occlusionDecidedCount, " decisions on browser side, ",
+			_occlusionProbingToggleCount, " changes of probing in Javascript.");
+		if (_occlusionComparedCount > 0)
+		{
+			LogInfo("Tab: Occlusion compared to Javascript for ", _occlusionComparedCount, " decisions, false positive rate ",
+				(float)_occlusionFalsePositiveCount / _occlusionComparedCount, ", false negative rate ",
+				(float)_occlusionFalseNegativeCount / _occlusionComparedCount, ".");
+		}
+		_occlusionTime = 0.f;
+		_occlusionFrameCount = 0;
+		_occlusionDecidedCount = 0;
+		_occlusionComparedCount = 0;
+		_occlusionFalsePositiveCount = 0;
+		_occlusionFalseNegativeCount = 0;
+		_occlusionProbingToggleCount = 0;
+	}
+}
+
+void Tab::DecideOcclusion(std::shared_ptr<DOMNode> spNode)
+{
+	if (!spNode) { return; }
+
+	// Fixed nodes are stacked in unknown order with other fixed elements, so leave them to Javascript
+	auto occlusion = DOMNode::Occlusion::UNDECIDED;
+	RectSpan rects = spNode->GetViewportRects();
+	if (rects.empty())
+	{
+		// Javascript does not probe nodes without rects either
+		occlusion = DOMNode::Occlusion::VISIBLE;
+	}
+	else if (!spNode->IsFixed())
+	{
+		// Same sample points as in Javascript, corners of first rect moved inside by one pixel and clipped to viewport
+		const Rect& rRect = rects.front();
+		const float maxX = (float)(_upWebView->GetResolutionX() - 1);
+		const float maxY = (float)(_upWebView->GetResolutionY() - 1);
+		const float left = glm::clamp(rRect.left + 1, 0.f, maxX);
+		const float right = glm::clamp(rRect.right - 1, 0.f, maxX);
+		const float top = glm::clamp(rRect.top + 1, 0.f, maxY);
+		const float bottom = glm::clamp(rRect.bottom - 1, 0.f, maxY);
+		const glm::vec2 corners[] = {
+			glm::vec2(left, top),
+			glm::vec2(right, top),
+			glm::vec2(right, bottom),
+			glm::vec2(left, bottom) };
+
+		// Overflow element clips its content
+		RectSpan overflowRects;
+		const auto& rspOverflowElement = _OverflowElementMap.Find(spNode->GetOverflowId());
+		if (rspOverflowElement && rspOverflowElement != spNode)
+		{
+			overflowRects = rspOverflowElement->GetViewportRects();
+		}
+
+		// Grid only knows fixed elements found on top of the page, so it can only tell that a node is
+		// occluded. Other overlays may still cover free corners, which is left to Javascript
+		const bool insideViewport = rRect.right > 0 && rRect.bottom > 0 && rRect.left < maxX && rRect.top < maxY;
+		int fullCount = 0;
+		for (const auto& rCorner : corners)
+		{
+			if (!insideViewport) { break; } // offscreen nodes are left to Javascript
+			bool clipped = !overflowRects.empty() && !overflowRects.front().IsInside(rCorner.x, rCorner.y);
+			if (!clipped && _occlusionGrid.Test(rCorner.x, rCorner.y) != OcclusionGrid::Coverage::FULL) { break; }
+			++fullCount;
+		}
+		if (fullCount == 4)
+		{
+			occlusion = DOMNode::Occlusion::OCCLUDED;
+		}
+	}
+	spNode->SetOcclusion(occlusion);
+
+	// Compare with result of Javascript, when it still probes the node
+	if (occlusion != DOMNode::Occlusion::UNDECIDED)
+	{
+		++_occlusionDecidedCount;
+		if (spNode->IsOcclusionProbing())
+		{
+			++_occlusionComparedCount;
+			bool occluded = (occlusion == DOMNode::Occlusion::OCCLUDED);
+			if (occluded && !spNode->IsOccludedInJavascript()) { ++_occlusionFalsePositiveCount; }
+			if (!occluded && spNode->IsOccludedInJavascript()) { ++_occlusionFalseNegativeCount; }
+		}
+	}
+
+	// Tell Javascript whether it has to probe the node
+	bool probing = setup::DOM_OCCLUSION_VALIDATION || (occlusion == DOMNode::Occlusion::UNDECIDED);
+	if (probing != spNode->IsOcclusionProbing())
+	{
+		spNode->SetOcclusionProbing(probing);
+		ExecuteCorrespondingJavascriptFunction(spNode, "setOcclusionProbing", probing);
+		++_occlusionProbingToggleCount;
+	}
+}
+
+void Tab::UploadStagedPaint()
+{
+	TraceSpan span("Texture upload");
+	int paintCount = _upWebView->UploadStagedPaint();
+	if (paintCount > 0)
+	{
+		_paintLatency = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - _firstStagedPaintTime).count();
+		_coalescedPaintCount = paintCount - 1;
+	}
+	_paintStaged = false;
+}
+
 void Tab::PushBackClickVisualization(double x, double y)
 {
 	// Structure for click visulization
@@ -1033,6 +1442,16 @@ void Tab::PushBackClickVisualization(double x, double y)
 	_clickVisualizations.push_back(clickVisualization);
 }
 
+void Tab::GoToRestoredHistoryEntry(int index)
+{
+	// Loading by URL starts without scrolling, so it is restored when main frame finished loading.
+	// Form data of page is not kept, since browser's history is gone
+	_restoredHistoryIndex = index;
+	_restoredHistoryNavigationIndex = index;
+	_restoredHistoryNavigationCommitted = false;
+	_pCefMediator->LoadURLInTab(this, _restoredHistory.at(index).URL);
+}
+
 std::string Tab::GetFaviconIdentifier() const
 {
 	return "tab_info_" + std::to_string(_pWeb->GetIdOfTab(this));
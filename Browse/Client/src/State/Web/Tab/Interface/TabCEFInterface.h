@@ -32,6 +32,16 @@ public:
     // Tell CEF callback which resolution web view texture should have
     virtual void GetWebRenderResolution(int& rWidth, int& rHeight) const = 0;
 
+    // Tell CEF callback which device scale factor rendering should use
+    virtual float GetWebRenderScaleFactor() const = 0;
+
+    // Receive paint with higher resolution than web render resolution, used for zoomed region and downsampled
+    // for the rest of the web view. Dirty rects are in pixels of paint
+    virtual void ReceiveDetailPaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects) = 0;
+
+    // Receive paint which is uploaded right before composition of next frame. Dirty rects are in pixels
+    virtual void ReceivePaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects) = 0;
+
     // Getter and setter for favicon URL
     virtual std::string GetFavIconURL() const = 0;
     virtual void SetFavIconURL(std::string url) = 0;
@@ -43,8 +53,8 @@ public:
     virtual void SetCanGoBack(bool canGoBack) = 0;
     virtual void SetCanGoForward(bool canGoForward) = 0;
 
-    // Receive favicon bytes as char vector ordered in RGBA
-    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height) = 0;
+    // Receive favicon bytes of icon URL as char vector ordered in RGBA
+    virtual void ReceiveFaviconBytes(std::string URL, std::unique_ptr< std::vector<unsigned char> > upData, int width, int height) = 0;
     virtual void ResetFaviconBytes() = 0;
 
     // Get weak pointer to texture of web view
@@ -58,12 +68,12 @@ public:
 	virtual void AddDOMVideo(int id) = 0;
 	virtual void AddDOMCheckbox(int id) = 0;
 
-	virtual std::weak_ptr<DOMTextInput> GetDOMTextInput(int id) = 0;
-	virtual std::weak_ptr<DOMLink> GetDOMLink(int id) = 0;
-	virtual std::weak_ptr<DOMSelectField> GetDOMSelectField(int id) = 0;
-	virtual std::weak_ptr<DOMOverflowElement> GetDOMOverflowElement(int id) = 0;
-	virtual std::weak_ptr<DOMVideo> GetDOMVideo(int id) = 0;
-	virtual std::weak_ptr<DOMCheckbox> GetDOMCheckbox(int id) = 0;
+	virtual std::shared_ptr<DOMTextInput> GetDOMTextInput(int id) = 0;
+	virtual std::shared_ptr<DOMLink> GetDOMLink(int id) = 0;
+	virtual std::shared_ptr<DOMSelectField> GetDOMSelectField(int id) = 0;
+	virtual std::shared_ptr<DOMOverflowElement> GetDOMOverflowElement(int id) = 0;
+	virtual std::shared_ptr<DOMVideo> GetDOMVideo(int id) = 0;
+	virtual std::shared_ptr<DOMCheckbox> GetDOMCheckbox(int id) = 0;
 
 	virtual void RemoveDOMTextInput(int id) = 0;
 	virtual void RemoveDOMLink(int id) = 0;
@@ -84,8 +94,8 @@ public:
     // Receive size of current page for scrolling purposes
     virtual void SetPageResolution(double width, double height) = 0;
 
-    // Fixed elements' coordinates
-    virtual void AddFixedElementsCoordinates(int id, std::vector<Rect> elements) = 0;
+    // Fixed elements' coordinates. Topmost fixed elements are known to be above everything else at their coordinates
+    virtual void AddFixedElementsCoordinates(int id, std::vector<Rect> elements, bool topmost) = 0;
     virtual void RemoveFixedElement(int id) = 0;
 
     // Set Tab's title text
@@ -25,6 +25,8 @@
 #include "src/State/Web/Tab/Interface/TabDOMNodeInterface.h"
 #include "src/State/Web/WebTabInterface.h"
 #include "src/CEF/Data/DOMNode.h"
+#include "src/CEF/Data/OcclusionGrid.h"
+#include "src/CEF/Data/DOMNodeSlotMap.h"
 #include "src/State/Web/Tab/WebView.h"
 #include "src/State/Web/Tab/Pipelines/Pipeline.h"
 #include "src/State/Web/Tab/Triggers/TextInputTrigger.h"
@@ -42,6 +44,7 @@
 #include <map>
 #include <set>
 #include <future>
+#include <chrono>
 
 // Forward declaration
 class Master;
@@ -79,6 +82,26 @@ public:
     // Deactivate
     void Deactivate();
 
+	// Lifecycle of Tab in background
+	enum class LifecycleState { LIVE, FROZEN, DISCARDED };
+	LifecycleState GetLifecycleState() const { return _lifecycleState; }
+
+	// Count time in background, called by Web for inactive Tabs
+	void UpdateBackgroundTime(float tpf) { _backgroundTime += tpf; }
+	float GetBackgroundTime() const { return _backgroundTime; }
+
+	// Freeze Tab in background
+	void Freeze();
+
+	// Discard Tab in background. Browser is closed, URL, title, navigation history, scrolling, favicon and thumbnail are kept
+	void Discard();
+
+	// Restore discarded Tab, called at activation
+	void Restore();
+
+	// Get preview of web page from mip map level of web view texture or thumbnail of discarded Tab. Returns whether successful
+	bool GetPreview(int mipMapLevel, int& rWidth, int& rHeight, std::vector<unsigned char>& rData) const;
+
     // Open URL. Does load it
     void OpenURL(std::string URL);
 
@@ -95,8 +118,8 @@ public:
     void Reload();
 
     // Can go back / forward
-    bool CanGoBack() const { return _canGoBack; }
-    bool CanGoForward() const { return _canGoForward; }
+    bool CanGoBack() const { return _restoredHistory.empty() ? _canGoBack : _restoredHistoryIndex > 0; }
+    bool CanGoForward() const { return _restoredHistory.empty() ? _canGoForward : _restoredHistoryIndex < (int)_restoredHistory.size() - 1; }
 
 	// Pushs back pointing evaluation pipeline
 	void PushBackPointingEvaluationPipeline(PointingApproach approach);
@@ -361,6 +384,16 @@ public:
     // Tell CEF callback which resolution web view texture should have
     virtual void GetWebRenderResolution(int& rWidth, int& rHeight) const;
 
+    // Tell CEF callback which device scale factor rendering should use
+    virtual float GetWebRenderScaleFactor() const { return _webRenderScaleFactor; }
+
+    // Receive paint with higher resolution than web render resolution, used for zoomed region and downsampled
+    // for the rest of the web view
+    virtual void ReceiveDetailPaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects);
+
+    // Receive paint which is uploaded right before composition of next frame
+    virtual void ReceivePaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects);
+
     // Getter and setter for favicon URL
     virtual std::string GetFavIconURL() const { return _favIconUrl; }
     virtual void SetFavIconURL(std::string url) { _favIconUrl = url; }
@@ -373,8 +406,8 @@ public:
     virtual void SetCanGoBack(bool canGoBack) { _canGoBack = canGoBack;	}
     virtual void SetCanGoForward(bool canGoForward) { _canGoForward = canGoForward; }
 
-    // Receive favicon bytes as char vector ordered in RGBA. Accepts also NULL for upData!
-    virtual void ReceiveFaviconBytes(std::unique_ptr< std::vector<unsigned char> > upData, int width, int height);
+    // Receive favicon bytes of icon URL as char vector ordered in RGBA. Accepts also NULL for upData!
+    virtual void ReceiveFaviconBytes(std::string URL, std::unique_ptr< std::vector<unsigned char> > upData, int width, int height);
     virtual void ResetFaviconBytes(); // TODO
 
     // Get weak pointer to texture of web view
@@ -388,12 +421,12 @@ public:
 	virtual void AddDOMVideo(int id);
 	virtual void AddDOMCheckbox(int id);
 
-	virtual std::weak_ptr<DOMTextInput> GetDOMTextInput(int id);
-	virtual std::weak_ptr<DOMLink> GetDOMLink(int id);
-	virtual std::weak_ptr<DOMSelectField> GetDOMSelectField(int id);
-	virtual std::weak_ptr<DOMOverflowElement> GetDOMOverflowElement(int id);
-	virtual std::weak_ptr<DOMVideo> GetDOMVideo(int id);
-	virtual std::weak_ptr<DOMCheckbox> GetDOMCheckbox(int id);
+	virtual std::shared_ptr<DOMTextInput> GetDOMTextInput(int id);
+	virtual std::shared_ptr<DOMLink> GetDOMLink(int id);
+	virtual std::shared_ptr<DOMSelectField> GetDOMSelectField(int id);
+	virtual std::shared_ptr<DOMOverflowElement> GetDOMOverflowElement(int id);
+	virtual std::shared_ptr<DOMVideo> GetDOMVideo(int id);
+	virtual std::shared_ptr<DOMCheckbox> GetDOMCheckbox(int id);
 
 	virtual void RemoveDOMTextInput(int id);
 	virtual void RemoveDOMLink(int id);
@@ -412,7 +445,7 @@ public:
     // Set page resolution from Cef Mediator
     virtual void SetPageResolution(double width, double height);
 
-    virtual void AddFixedElementsCoordinates(int id, std::vector<Rect> elements);
+    virtual void AddFixedElementsCoordinates(int id, std::vector<Rect> elements, bool topmost);
     virtual void RemoveFixedElement(int id);
 
     // Set Tab's title text
@@ -456,6 +489,14 @@ private:
 		float fading; // at start this is CLICK_VISUALIZATION_DURATION and decrements to zero
 	};
 
+	// Struct for page in navigation history kept over discarding
+	struct RestoredHistoryEntry
+	{
+		std::string URL;
+		double scrollingOffsetX = 0;
+		double scrollingOffsetY = 0;
+	};
+
     // Give listener full access
     friend class TabButtonListener;
     friend class TabSensorListener;
@@ -565,12 +606,33 @@ private:
     // Method to update and pipe accent color to eyeGUI
     void UpdateAccentColor(float tpf);
 
+    // Decide about rendering zoomed region of web view with higher device scale factor
+    void UpdateDetailRendering(float tpf);
+
+	// Request frame rate of web view rendering depending on activity
+	void UpdateFrameRate(float tpf, const std::shared_ptr<const Input> spInput);
+
+	// Upload paints staged since last frame and measure their latency
+	void UploadStagedPaint();
+
+	// Decide occlusion of DOM nodes against fixed elements, so Javascript only probes ambiguous ones
+	void UpdateOcclusion();
+
+	// Decide occlusion of single DOM node using occlusion grid
+	void DecideOcclusion(std::shared_ptr<DOMNode> spNode);
+
     // Pushes back click visualization which fades out. X and y are in pixels
     void PushBackClickVisualization(double x, double y);
 
+	// Navigate to entry of history kept over discarding
+	void GoToRestoredHistoryEntry(int index);
+
 	// Unique name for favicon which is stored in eyeGUI
 	std::string GetFaviconIdentifier() const;
 
+	// Show favicon processed by favicon manager, if it has higher resolution than current one
+	void ApplyFavicon(std::shared_ptr<const FaviconManager::Favicon> spFavicon);
+
 	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 	// >>> Implemented in TabDOMNodeImpl.cpp >>>
 	// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -604,12 +666,27 @@ private:
 	std::vector<Trigger*> _triggers;
 
 	// Map nodeID to node itself, in order to access it when it has to be updated
-	std::map<int, std::shared_ptr<DOMLink> > _TextLinkMap;
-	std::map<int, std::shared_ptr<DOMTextInput> > _TextInputMap;
-	std::map<int, std::shared_ptr<DOMSelectField> > _SelectFieldMap;
-	std::map<int, std::shared_ptr<DOMOverflowElement> > _OverflowElementMap;
-	std::map<int, std::shared_ptr<DOMVideo> > _VideoMap;
-	std::map<int, std::shared_ptr<DOMCheckbox> > _CheckboxMap;
+	DOMNodeSlotMap<DOMLink> _TextLinkMap;
+	DOMNodeSlotMap<DOMTextInput> _TextInputMap;
+	DOMNodeSlotMap<DOMSelectField> _SelectFieldMap;
+	DOMNodeSlotMap<DOMOverflowElement> _OverflowElementMap;
+	DOMNodeSlotMap<DOMVideo> _VideoMap;
+	DOMNodeSlotMap<DOMCheckbox> _CheckboxMap;
+
+	// Rects of all DOM nodes, projected into viewport once per frame
+	std::shared_ptr<DOMRectStore> _spRectStore = std::make_shared<DOMRectStore>();
+
+	// Coarse grid of fixed elements in viewport to decide occlusion of DOM nodes
+	OcclusionGrid _occlusionGrid;
+
+	// Statistics about occlusion decided on browser side compared to Javascript
+	int _occlusionDecidedCount = 0;
+	int _occlusionComparedCount = 0;
+	int _occlusionFalsePositiveCount = 0; // occluded on browser side but visible in Javascript
+	int _occlusionFalseNegativeCount = 0; // visible on browser side but occluded in Javascript
+	int _occlusionProbingToggleCount = 0;
+	float _occlusionTime = 0.f; // milliseconds spent on browser side
+	int _occlusionFrameCount = 0;
 
     // Web view in which website is rendered and displayed
     std::unique_ptr<WebView> _upWebView;
@@ -635,6 +712,10 @@ private:
     // Parameters for WebView
     WebViewParameters _webViewParameters;
 
+    // Device scale factor used by CEF for rendering, raised while zoomed in
+    float _webRenderScaleFactor = 1.f;
+    float _detailInvalidationCooldown = 0.f; // seconds until next paint of detail may be requested
+
     // Layout color accent
     glm::vec4 _targetColorAccent = TAB_DEFAULT_COLOR_ACCENT;
     glm::vec4 _currentColorAccent = TAB_DEFAULT_COLOR_ACCENT;
@@ -692,6 +773,7 @@ private:
 
     // Coordinates of current fixed elements on site
 	std::vector<std::vector<Rect> > _fixedElements;
+	std::vector<bool> _fixedElementsTopmost; // only topmost fixed elements occlude other nodes
 
     // URL of current favIcon
     std::string _favIconUrl;
@@ -716,6 +798,9 @@ private:
 	// Boolean which indicates whether (at least some) favicon is loaded to eyeGUI
 	bool _faviconLoaded = false;
 
+	// URLs of favicons which are processed by favicon manager
+	std::set<std::string> _pendingFaviconURLs;
+
 	// Saves current state of icon
 	IconState _iconState;
 
@@ -741,8 +826,8 @@ private:
 	// Time until next polling
 	float _timeUntilPolling = 0.f;
 
-	// Id of DOMVideo in map that is currently shown in video mode
-	int _videoModeId = -1; // -1 is indicator that currently no video mode active
+	// Handle of DOMVideo in map that is currently shown in video mode
+	DOMNodeHandle _videoModeHandle; // id of -1 is indicator that currently no video mode active
 
 	// Marker for next received click to be triggered by user (used for social records)
 	bool _userTriggeredClick = false;
@@ -752,6 +837,40 @@ private:
 
 	// Polling partition index
 	int _pollingPartitionIndex = 0;
+
+	// Frame rate governor helpers
+	float _frameRateIdleTime = 0.f; // time since last activity
+	glm::vec2 _frameRatePrevGaze = glm::vec2(0, 0);
+	double _frameRatePrevScrolling = 0; // for determining scrolling
+	float _frameRateMeasurementTime = 0.f; // time since last measurement of paints
+	unsigned int _frameRatePrevPaintCount = 0;
+	float _paintsPerSecond = 0.f;
+	bool _frameRateAnimation = false; // page is animating by itself
+
+	// Paints staged for upload at next frame
+	bool _paintStaged = false;
+	std::chrono::steady_clock::time_point _firstStagedPaintTime; // oldest paint not yet uploaded
+	float _paintLatency = 0.f; // milliseconds from paint until upload right before composition
+	int _coalescedPaintCount = 0; // paints which did not need own upload in last frame
+
+	// Rects of visible text links, reused every update to highlight them in web view
+	std::vector<Rect> _highlightRects;
+
+	// Lifecycle management
+	LifecycleState _lifecycleState = LifecycleState::LIVE;
+	float _backgroundTime = 0.f;
+	CefRefPtr<CefRequestContext> _requestContext; // kept for restoration
+	std::vector<unsigned char> _thumbnailData; // downsampled web view while discarded
+	int _thumbnailWidth = 0;
+	int _thumbnailHeight = 0;
+	bool _restoreScrolling = false; // restore scrolling offset after loading
+	double _restoreScrollingOffsetX = 0;
+	double _restoreScrollingOffsetY = 0;
+	std::chrono::steady_clock::time_point _restoreStartTime;
+	std::vector<RestoredHistoryEntry> _restoredHistory; // navigation history kept over discarding, replaces browser's history when not empty
+	int _restoredHistoryIndex = -1;
+	int _restoredHistoryNavigationIndex = -1; // entry loaded by going back or forward, follows redirects until main frame finished loading
+	bool _restoredHistoryNavigationCommitted = false; // URL of that navigation has been set
 };
 
 #endif // TAB_H_
@@ -5,8 +5,10 @@
 
 #include "WebView.h"
 #include "src/Utils/Texture.h"
+#include "src/Utils/RectsRenderItem.h"
 #include "src/Setup.h"
 #include "submodules/glm/glm/gtc/matrix_transform.hpp"
+#include <algorithm>
 
 // Shaders
 const std::string vertexShaderSource =
@@ -44,6 +46,51 @@ const std::string geometryShaderSource =
 "    EndPrimitive();\n"
 "}\n";
 
+const std::string highlightVertexShaderSource =
+"#version 330 core\n"
+"layout(location = 0) in vec4 rect;\n" // top, left, bottom, right in pixels of web page
+"out vec4 vertRect;\n"
+"void main() {\n"
+"    vertRect = rect;\n"
+"}\n";
+
+const std::string highlightGeometryShaderSource =
+"#version 330 core\n"
+"layout(points) in;\n"
+"layout(triangle_strip, max_vertices = 4) out;\n"
+"in vec4 vertRect[];\n"
+"out vec2 uv;\n"
+"out vec2 pos;\n" // relative position within quad in OpenGL space
+"out vec2 size;\n" // size of quad (relative values)
+"uniform vec2 scrollingOffset;\n"
+"uniform vec2 resolution;\n" // resolution of web view
+"uniform vec4 region;\n" // minX, minY, maxX, maxY of rendered region relative to web view. Origin in upper left corner
+"void main() {\n"
+"    vec4 rect = (vertRect[0] - scrollingOffset.yxyx) / resolution.yxyx;\n" // move rect by scrolling and make it relative to web view
+"    rect = (rect - region.yxyx) / (region.wzwz - region.yxyx);\n" // make it relative to rendered region
+"    if(rect.w < 0.0 || rect.y > 1.0 || rect.z < 0.0 || rect.x > 1.0) { return; }\n" // skip rects outside of rendered region
+"    vec4 position = (vec4(rect.y, 1.0 - rect.z, rect.w, 1.0 - rect.x) * 2.0) - 1.0;\n" // minX, minY, maxX, maxY in normalized device coordinates
+"    vec4 textureCoordinate = vec4(rect.y, rect.z, rect.w, rect.x);\n" // using texture coordinates to flip image in v direction
+"    size = vec2(position.z - position.x, position.w - position.y);\n" // relative size of quad
+"    gl_Position = vec4(position.zw, 0.0, 1.0);\n" // upper right corner
+"    uv = vec2(textureCoordinate.zw);\n"
+"    pos = vec2(1,1);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.xw, 0.0, 1.0);\n" // upper left corner
+"    uv = vec2(textureCoordinate.xw);\n"
+"    pos = vec2(0,1);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.zy, 0.0, 1.0);\n" // lower right corner
+"    uv = vec2(textureCoordinate.zy);\n"
+"    pos = vec2(1,0);\n"
+"    EmitVertex();\n"
+"    gl_Position = vec4(position.xy, 0.0, 1.0);\n" // lower left corner
+"    uv = vec2(textureCoordinate.xy);\n"
+"    pos = vec2(0,0);\n"
+"    EmitVertex();\n"
+"    EndPrimitive();\n"
+"}\n";
+
 const std::string webpageFragmentShaderSource =
 "#version 330 core\n"
 "in vec2 uv;\n"
@@ -85,6 +132,9 @@ const std::string compositionFragmentShaderSource =
 "in vec2 uv;\n"
 "out vec4 fragColor;\n"
 "uniform sampler2D tex;\n"
+"uniform sampler2D detailTex;\n"
+"uniform vec4 detailRegion;\n" // minU, minV, maxU, maxV. OpenGL coordinate system!
+"uniform int detail;\n"
 "uniform vec2 centerOffset;\n"
 "uniform vec2 zoomPosition;\n"
 "uniform float zoom;\n"
@@ -94,7 +144,11 @@ const std::string compositionFragmentShaderSource =
 "   coords -= zoomPosition;" // move zoom position to origin
 "   coords *= zoom;" // scale coords
 "   coords += zoomPosition;" // move it back
-"   fragColor = texture(tex, coords);\n"
+"   if(detail > 0 && all(greaterThanEqual(coords, detailRegion.xy)) && all(lessThanEqual(coords, detailRegion.zw))) {\n"
+"       fragColor = texture(detailTex, (coords - detailRegion.xy) / (detailRegion.zw - detailRegion.xy));\n" // sharper rendering of zoomed region
+"   } else {\n"
+"       fragColor = texture(tex, coords);\n"
+"   }\n"
 "}\n";
 
 WebView::WebView(int x, int y, int width, int height)
@@ -110,7 +164,7 @@ WebView::WebView(int x, int y, int width, int height)
 
     // Render items
 	_upWebpageRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, webpageFragmentShaderSource));
-    _upHighlightRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, highlightFragmentShaderSource));
+    _upHighlightRenderItem = std::unique_ptr<RectsRenderItem>(new RectsRenderItem(highlightVertexShaderSource, highlightGeometryShaderSource, highlightFragmentShaderSource));
     _upCompositeRenderItem = std::unique_ptr<RenderItem>(new RenderItem(vertexShaderSource, geometryShaderSource, compositionFragmentShaderSource));
 
     // Framebuffer
@@ -118,11 +172,32 @@ WebView::WebView(int x, int y, int width, int height)
     _upFramebuffer->Bind();
     _upFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB, true);
     _upFramebuffer->Unbind();
+
+    // Detail texture and framebuffer, resized when detail paint arrives
+    _upDetailTexture = std::unique_ptr<Texture>(new Texture(1, 1, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::CLAMP));
+    _upDetailFramebuffer = std::unique_ptr<Framebuffer>(new Framebuffer(1, 1));
+    _upDetailFramebuffer->Bind();
+    _upDetailFramebuffer->AddAttachment(Framebuffer::ColorFormat::RGB);
+    _upDetailFramebuffer->Unbind();
+
+    // Supersampled paint and framebuffers to downsample it, texture is resized when detail paint arrives
+    _upSupersampledTexture = std::unique_ptr<Texture>(new Texture(1, 1, GL_RGBA, Texture::Filter::LINEAR, Texture::Wrap::CLAMP));
+    glGenFramebuffers(2, _blitFramebuffers);
+
+    // Timer queries for each pass, double buffered so reading results does not stall
+    if (setup::WEB_VIEW_GPU_TIMER_QUERIES)
+    {
+        glGenQueries(2 * PASS_COUNT, &_timerQueries[0][0]);
+    }
 }
 
 WebView::~WebView()
 {
-    // Nothing to do
+    glDeleteFramebuffers(2, _blitFramebuffers);
+    if (setup::WEB_VIEW_GPU_TIMER_QUERIES)
+    {
+        glDeleteQueries(2 * PASS_COUNT, &_timerQueries[0][0]);
+    }
 }
 
 void WebView::Update(
@@ -153,110 +228,115 @@ void WebView::Draw(
 	double scrollingOffsetX,
 	double scrollingOffsetY) const
 {
-    // ### FILL FRAMEBUFFER ###
-
-    // Just render to framebuffer
-    _upFramebuffer->Bind();
+    // Results of timer queries issued one frame ago
+    CollectTimers();
 
-    // Rescue current viewport and set own which fits rendered webpage
+    // Rescue current viewport
     GLint viewport[4];
     glGetIntegerv(GL_VIEWPORT, viewport);
-    glViewport(0, 0, _width, _height);
 
-    // Bind render item for web page
-	_upWebpageRenderItem->Bind();
+    // Without zooming, web page is drawn directly instead of through framebuffer
+    const bool detail = _detailActive && _detailAvailable;
+    const bool direct = !detail && parameters.zoom == 1.f && parameters.centerOffset == glm::vec2(0, 0);
+    if(direct)
+    {
+        // Viewport maps to web view like position used in compositing below
+        BeginTimer(PASS_PAGE);
+        glViewport(_x, _y, _width, _height);
+        DrawPage(_spTexture.get(), parameters.dim);
+        if(parameters.dim > 0.f)
+        {
+            DrawHighlights(glm::vec4(0.f, 0.f, 1.f, 1.f), (float)_width / (float)_height, scrollingOffsetX, scrollingOffsetY);
+        }
+        EndTimer();
 
-    // Bind texture with rendered web page
-    _spTexture->Bind();
+        // Restore old viewport
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        return;
+    }
 
-    // Fill uniforms
-	_upWebpageRenderItem->GetShader()->UpdateValue("position", glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
-	_upWebpageRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
-	_upWebpageRenderItem->GetShader()->UpdateValue("dim", parameters.dim);
+    // ### FILL FRAMEBUFFER ###
 
-    // Draw webpage completely into framebuffer
-	_upWebpageRenderItem->Draw(GL_POINTS);
+    // Render web page completely into framebuffer, with viewport which fits rendered webpage
+    BeginTimer(PASS_PAGE);
+    _upFramebuffer->Bind();
+    glViewport(0, 0, _width, _height);
+    DrawPage(_spTexture.get(), parameters.dim);
 
     // Render highlighting
     if(parameters.dim > 0.f)
     {
-		// Bind render item for highlighting
-		_upHighlightRenderItem->Bind();
+        DrawHighlights(glm::vec4(0.f, 0.f, 1.f, 1.f), (float)_width / (float)_height, scrollingOffsetX, scrollingOffsetY);
+    }
+
+    // Unbind framebuffer
+    _upFramebuffer->Unbind();
+    EndTimer();
 
-        // TODO: use value from highlight or so
-        // For now: just reset dimming to zero for the rect rendering
-		_upHighlightRenderItem->GetShader()->UpdateValue("dim", 0.f);
+    // ### FILL DETAIL FRAMEBUFFER ###
 
-		// Aspect ratio of web view
-		_upHighlightRenderItem->GetShader()->UpdateValue("aspectRatio", (float)_width / (float)_height);
+    // Render region of zoomed in webpage with higher resolution
+    if(detail)
+    {
+        BeginTimer(PASS_DETAIL);
+        _upDetailFramebuffer->Bind();
+        glViewport(0, 0, _upDetailTexture->GetWidth(), _upDetailTexture->GetHeight());
+
+        // Draw detail of webpage like complete webpage above
+        DrawPage(_upDetailTexture.get(), parameters.dim);
 
-        // Go over rects and render them
-        for(Rect rect : _rects)
+        // Render highlighting in detail region
+        if(parameters.dim > 0.f)
         {
-			// Move rect by scrolling
-			rect.left -= scrollingOffsetX;
-			rect.right -= scrollingOffsetX;
-			rect.bottom -= scrollingOffsetY;
-			rect.top -= scrollingOffsetY;
-
-			// Scale from web view resolution to real one
-			rect.left = (rect.left / (float)GetResolutionX()) * (float)_width;
-			rect.right = (rect.right / (float)GetResolutionX()) * (float)_width;
-			rect.bottom = (rect.bottom / (float)GetResolutionY()) * (float)_height;
-			rect.top = (rect.top / (float)GetResolutionY()) * (float)_height;
-
-            // Setup position
-			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "position",
-                glm::vec4(
-                    (((float)rect.left / (float)_width) * 2.f) - 1.f,
-                    ((((float)(_height - rect.bottom)) / (float)_height) * 2.f) - 1.f,
-                    (((float)(rect.right) / (float)_width) * 2.f) - 1.f,
-                    ((((float)(_height - rect.top)) / (float)_height) * 2.f) - 1.f)); // normalized device coordinates
-
-            // Setup texture coordinate
-			_upHighlightRenderItem->GetShader()->UpdateValue(
-                "textureCoordinate",
-                glm::vec4(
-                    (float)rect.left / (float)_width,
-                    1.f - (float)(_height - rect.bottom) / (float)_height,
-                    (float)rect.right / (float)_width,
-                    1.f - (float)(_height - rect.top) / (float)_height)); // using texture coordinates to flip image in v direction
-
-            // Draw the quad
-			_upHighlightRenderItem->Draw(GL_POINTS);
+            DrawHighlights(_detailRegion, (float)_upDetailTexture->GetWidth() / (float)_upDetailTexture->GetHeight(), scrollingOffsetX, scrollingOffsetY);
         }
+
+        _upDetailFramebuffer->Unbind();
+        EndTimer();
     }
 
     // Restore old viewport
     glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
 
-    // Unbind framebuffer
-    _upFramebuffer->Unbind();
-
     // ### COMPOSITING INCLUSIVE ZOOMING ###
 
     // Render composited inclusive zooming
+    BeginTimer(PASS_COMPOSITION);
     _upCompositeRenderItem->Bind();
 
     // Bind texture with webpage and custom rendered elements
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, _upFramebuffer->GetAttachment(0));
 
+    // Bind detail of webpage
+    if(detail)
+    {
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, _upDetailFramebuffer->GetAttachment(0));
+        glActiveTexture(GL_TEXTURE0);
+    }
+
     // Fill uniforms (TODO: here, coordinate sytem is not completely correctly translated. Would be only a problem at vertical transformation)
     _upCompositeRenderItem->GetShader()->UpdateValue(
-        "position",
+        Shader::Uniform::POSITION,
         glm::vec4(
             ((_x / (float)windowWidth) * 2.f) - 1.f, // minX
             ((_y / (float)windowHeight) * 2.f) - 1.f, // minY
             (((_x + _width) / (float)windowWidth) * 2.f) - 1.f, // maxX
             (((_y + _height) / (float)windowHeight) * 2.f) - 1.f // maxY
             )); // normalized device coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("textureCoordinate", glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
-    _upCompositeRenderItem->GetShader()->UpdateValue("centerOffset", glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoomPosition", glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
-    _upCompositeRenderItem->GetShader()->UpdateValue("zoom", parameters.zoom);
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::TEXTURE_COORDINATE, glm::vec4(0.f, 0.f, 1.f, 1.f)); // everything is rendered correctly into framebuffer, just display it
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::CENTER_OFFSET, glm::vec2(parameters.centerOffset.x, -parameters.centerOffset.y)); // center offset y has to be taken negative because OpenGL coordinates
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::ZOOM_POSITION, glm::vec2(parameters.zoomPosition.x, 1.f - parameters.zoomPosition.y)); // zoomPosition has origin in upper left but lower left is necessary
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::ZOOM, parameters.zoom);
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::TEX, 0);
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::DETAIL_TEX, 1);
+    _upCompositeRenderItem->GetShader()->UpdateValue(Shader::Uniform::DETAIL, detail ? 1 : 0);
+    _upCompositeRenderItem->GetShader()->UpdateValue(
+        Shader::Uniform::DETAIL_REGION,
+        glm::vec4(_detailRegion.x, 1.f - _detailRegion.w, _detailRegion.z, 1.f - _detailRegion.y)); // detail region has origin in upper left but lower left is necessary
     _upCompositeRenderItem->Draw(GL_POINTS);
+    EndTimer();
 }
 
 std::weak_ptr<Texture> WebView::GetTexture()
@@ -264,9 +344,328 @@ std::weak_ptr<Texture> WebView::GetTexture()
     return _spTexture;
 }
 
-void WebView::SetHighlightRects(std::vector<Rect> rects)
+void WebView::SetHighlightRects(const std::vector<Rect>& rRects)
+{
+    // Only upload rects when they changed
+    bool changed = rRects.size() != _rects.size();
+    for (size_t i = 0; i < rRects.size() && !changed; i++)
+    {
+        const Rect& rA = rRects[i];
+        const Rect& rB = _rects[i];
+        changed = rA.top != rB.top || rA.left != rB.left || rA.bottom != rB.bottom || rA.right != rB.right;
+    }
+    if (!changed) { return; }
+    _rects = rRects;
+
+    // Rects are stored as top, left, bottom, right
+    std::vector<glm::vec4> data;
+    data.reserve(_rects.size());
+    for (const Rect& rRect : _rects)
+    {
+        data.push_back(glm::vec4(rRect.top, rRect.left, rRect.bottom, rRect.right));
+    }
+    _upHighlightRenderItem->Fill(data);
+}
+
+glm::vec3 WebView::GetPassTimes() const
+{
+    return glm::vec3(_passTimes[PASS_PAGE], _passTimes[PASS_DETAIL], _passTimes[PASS_COMPOSITION]);
+}
+
+bool WebView::SetDetailRegion(bool active, glm::vec4 visibleRegion)
 {
-    _rects = rects;
+    _detailActive = active;
+    if(!_detailActive)
+    {
+        // Supersampled paint is not needed anymore
+        if(_upSupersampledTexture->GetWidth() > 1)
+        {
+            _upSupersampledTexture->Fill(1, 1, GL_BGRA, NULL);
+        }
+        _detailAvailable = false;
+        return false;
+    }
+
+    // Check whether current detail still covers visible region
+    visibleRegion = glm::clamp(visibleRegion, 0.f, 1.f);
+    if(_detailAvailable
+        && visibleRegion.x >= _detailRegion.x
+        && visibleRegion.y >= _detailRegion.y
+        && visibleRegion.z <= _detailRegion.z
+        && visibleRegion.w <= _detailRegion.w)
+    {
+        return false;
+    }
+
+    // Request region with margin, so small movements of zoom do not require new paint
+    glm::vec2 margin = glm::vec2(visibleRegion.z - visibleRegion.x, visibleRegion.w - visibleRegion.y) * setup::WEB_VIEW_DETAIL_MARGIN;
+    _requestedDetailRegion = glm::clamp(visibleRegion + glm::vec4(-margin, margin), 0.f, 1.f);
+    return true;
+}
+
+void WebView::FillDetail(int width, int height, const unsigned char* pBuffer)
+{
+    if(!_detailActive) { return; }
+
+    // Pixel region of requested detail within paint
+    int minX = glm::clamp((int)glm::floor(_requestedDetailRegion.x * width), 0, width);
+    int minY = glm::clamp((int)glm::floor(_requestedDetailRegion.y * height), 0, height);
+    int maxX = glm::clamp((int)glm::ceil(_requestedDetailRegion.z * width), 0, width);
+    int maxY = glm::clamp((int)glm::ceil(_requestedDetailRegion.w * height), 0, height);
+    if(maxX <= minX || maxY <= minY) { return; }
+
+    // Upload only that region
+    _upDetailTexture->FillRegion(width, minX, minY, maxX - minX, maxY - minY, GL_BGRA, pBuffer);
+    _upDetailFramebuffer->Bind();
+    _upDetailFramebuffer->Resize(maxX - minX, maxY - minY);
+    _upDetailFramebuffer->Unbind();
+
+    // Remember region which is actually covered
+    _detailRegion = glm::vec4(
+        (float)minX / (float)width,
+        (float)minY / (float)height,
+        (float)maxX / (float)width,
+        (float)maxY / (float)height);
+    _detailAvailable = true;
+}
+
+void WebView::FillDownsampled(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects, int targetWidth, int targetHeight)
+{
+    if(width <= 0 || height <= 0 || targetWidth <= 0 || targetHeight <= 0) { return; }
+
+    // Upload complete paint when any size changes, otherwise only union of dirty rects
+    int minX = 0, minY = 0, maxX = width, maxY = height;
+    if(_upSupersampledTexture->GetWidth() != width || _upSupersampledTexture->GetHeight() != height
+        || _spTexture->GetWidth() != targetWidth || _spTexture->GetHeight() != targetHeight)
+    {
+        _upSupersampledTexture->Fill(width, height, GL_BGRA, pBuffer);
+        _spTexture->Fill(targetWidth, targetHeight, GL_BGRA, NULL);
+    }
+    else
+    {
+        if(rDirtyRects.empty()) { return; }
+        minX = width; minY = height; maxX = 0; maxY = 0;
+        for(const auto& rRect : rDirtyRects)
+        {
+            minX = glm::min(minX, glm::clamp((int)rRect.left, 0, width));
+            minY = glm::min(minY, glm::clamp((int)rRect.top, 0, height));
+            maxX = glm::max(maxX, glm::clamp((int)rRect.right, 0, width));
+            maxY = glm::max(maxY, glm::clamp((int)rRect.bottom, 0, height));
+        }
+        if(maxX <= minX || maxY <= minY) { return; }
+        _upSupersampledTexture->UpdateRegion(minX, minY, maxX - minX, maxY - minY, GL_BGRA, pBuffer);
+    }
+
+    // Target region covering dirty region, source region is taken from it so pixels stay aligned
+    const int targetMinX = (minX * targetWidth) / width;
+    const int targetMinY = (minY * targetHeight) / height;
+    const int targetMaxX = glm::min(targetWidth, (maxX * targetWidth + width - 1) / width);
+    const int targetMaxY = glm::min(targetHeight, (maxY * targetHeight + height - 1) / height);
+
+    // Let GPU downsample by linear filtered blit. Rows of both textures are in order of paint
+    GLint readFramebuffer = 0, drawFramebuffer = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _blitFramebuffers[0]);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _upSupersampledTexture->GetHandle(), 0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _blitFramebuffers[1]);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _spTexture->GetHandle(), 0);
+    glBlitFramebuffer(
+        (targetMinX * width) / targetWidth,
+        (targetMinY * height) / targetHeight,
+        (targetMaxX * width) / targetWidth,
+        (targetMaxY * height) / targetHeight,
+        targetMinX, targetMinY, targetMaxX, targetMaxY,
+        GL_COLOR_BUFFER_BIT,
+        GL_LINEAR);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+}
+
+void WebView::StagePaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects)
+{
+    // Copy complete paint when size changes, otherwise only dirty rects
+    const int rowSize = width * 4;
+    if (width != _stagedWidth || height != _stagedHeight)
+    {
+        _stagedWidth = width;
+        _stagedHeight = height;
+        _stagedPaint.assign(pBuffer, pBuffer + (rowSize * height));
+        _stagedDirtyRect = Rect(0, 0, (float)height, (float)width);
+    }
+    else
+    {
+        for (const auto& rRect : rDirtyRects)
+        {
+            const int left = glm::clamp((int)rRect.left, 0, width);
+            const int right = glm::clamp((int)rRect.right, 0, width);
+            const int top = glm::clamp((int)rRect.top, 0, height);
+            const int bottom = glm::clamp((int)rRect.bottom, 0, height);
+            for (int row = top; row < bottom; row++)
+            {
+                const int offset = (row * rowSize) + (left * 4);
+                std::copy(pBuffer + offset, pBuffer + offset + ((right - left) * 4), _stagedPaint.begin() + offset);
+            }
+
+            // Extend dirty rect
+            if (_stagedPaintCount == 0)
+            {
+                _stagedDirtyRect = Rect((float)top, (float)left, (float)bottom, (float)right);
+            }
+            else
+            {
+                _stagedDirtyRect = Rect(
+                    glm::min(_stagedDirtyRect.top, (float)top),
+                    glm::min(_stagedDirtyRect.left, (float)left),
+                    glm::max(_stagedDirtyRect.bottom, (float)bottom),
+                    glm::max(_stagedDirtyRect.right, (float)right));
+            }
+        }
+    }
+    _stagedPaintCount++;
+}
+
+int WebView::UploadStagedPaint()
+{
+    if (_stagedPaintCount == 0) { return 0; }
+
+    // Reallocate texture when size changed, otherwise upload dirty region only
+    if (_spTexture->GetWidth() != _stagedWidth || _spTexture->GetHeight() != _stagedHeight)
+    {
+        _spTexture->Fill(_stagedWidth, _stagedHeight, GL_BGRA, _stagedPaint.data());
+    }
+    else if (!_stagedDirtyRect.IsZero())
+    {
+        _spTexture->UpdateRegion(
+            (int)_stagedDirtyRect.left,
+            (int)_stagedDirtyRect.top,
+            (int)_stagedDirtyRect.Width(),
+            (int)_stagedDirtyRect.Height(),
+            GL_BGRA,
+            _stagedPaint.data());
+    }
+
+    int count = _stagedPaintCount;
+    _stagedPaintCount = 0;
+    _stagedDirtyRect = Rect();
+    return count;
+}
+
+void WebView::ReleaseResources()
+{
+    _stagedPaint.clear();
+    _stagedPaint.shrink_to_fit();
+    _stagedWidth = 0;
+    _stagedHeight = 0;
+    _stagedPaintCount = 0;
+    _spTexture->Fill(1, 1, GL_BGRA, NULL);
+    _upDetailTexture->Fill(1, 1, GL_BGRA, NULL);
+    _upSupersampledTexture->Fill(1, 1, GL_BGRA, NULL);
+    _detailAvailable = false;
+
+    _upFramebuffer->Bind();
+    _upFramebuffer->Resize(1, 1);
+    _upFramebuffer->Unbind();
+    _upDetailFramebuffer->Bind();
+    _upDetailFramebuffer->Resize(1, 1);
+    _upDetailFramebuffer->Unbind();
+
+    // Force resizing of framebuffer at next update
+    _width = 0;
+    _height = 0;
+}
+
+size_t WebView::GetMemoryUsage() const
+{
+    // Textures are RGBA, framebuffers RGB with depth and stencil
+    size_t usage = (size_t)(_spTexture->GetWidth() * _spTexture->GetHeight()) * 4;
+    usage += (size_t)(_width * _height) * (3 + 4);
+    if (_detailActive)
+    {
+        usage += (size_t)(_upDetailTexture->GetWidth() * _upDetailTexture->GetHeight()) * (4 + 3 + 4);
+        usage += (size_t)(_upSupersampledTexture->GetWidth() * _upSupersampledTexture->GetHeight()) * 4;
+    }
+    return usage;
+}
+
+void WebView::DrawPage(const Texture* pTexture, float dim) const
+{
+    // Bind render item for web page
+    _upWebpageRenderItem->Bind();
+
+    // Bind texture with rendered web page
+    pTexture->Bind();
+
+    // Fill uniforms
+    _upWebpageRenderItem->GetShader()->UpdateValue(Shader::Uniform::POSITION, glm::vec4(-1.f, -1.f, 1.f, 1.f)); // normalized device coordinates
+    _upWebpageRenderItem->GetShader()->UpdateValue(Shader::Uniform::TEXTURE_COORDINATE, glm::vec4(0.f, 1.f, 1.f, 0.f)); // using texture coordinates to flip image in v direction
+    _upWebpageRenderItem->GetShader()->UpdateValue(Shader::Uniform::DIM, dim);
+
+    // Draw webpage completely into current viewport
+    _upWebpageRenderItem->Draw(GL_POINTS);
+}
+
+void WebView::DrawHighlights(
+    glm::vec4 region,
+    float aspectRatio,
+    double scrollingOffsetX,
+    double scrollingOffsetY) const
+{
+    // Bind render item for highlighting
+    _upHighlightRenderItem->Bind();
+
+    // TODO: use value from highlight or so
+    // For now: just reset dimming to zero for the rect rendering
+    _upHighlightRenderItem->GetShader()->UpdateValue(Shader::Uniform::DIM, 0.f);
+
+    // Aspect ratio of rendered region
+    _upHighlightRenderItem->GetShader()->UpdateValue(Shader::Uniform::ASPECT_RATIO, aspectRatio);
+
+    // Geometry shader moves rects by scrolling and makes them relative to rendered region
+    _upHighlightRenderItem->GetShader()->UpdateValue(Shader::Uniform::SCROLLING_OFFSET, glm::vec2(scrollingOffsetX, scrollingOffsetY));
+    _upHighlightRenderItem->GetShader()->UpdateValue(Shader::Uniform::RESOLUTION, glm::vec2(GetResolutionX(), GetResolutionY()));
+    _upHighlightRenderItem->GetShader()->UpdateValue(Shader::Uniform::REGION, region);
+
+    // Draw all rects at once
+    _upHighlightRenderItem->Draw(GL_POINTS);
+}
+
+void WebView::BeginTimer(Pass pass) const
+{
+    if (!setup::WEB_VIEW_GPU_TIMER_QUERIES) { return; }
+    glBeginQuery(GL_TIME_ELAPSED, _timerQueries[_timerFrame][pass]);
+    _timerIssued[_timerFrame][pass] = true;
+}
+
+void WebView::EndTimer() const
+{
+    if (!setup::WEB_VIEW_GPU_TIMER_QUERIES) { return; }
+    glEndQuery(GL_TIME_ELAPSED);
+}
+
+void WebView::CollectTimers() const
+{
+    if (!setup::WEB_VIEW_GPU_TIMER_QUERIES) { return; }
+
+    // Switch to other set of queries and read its results, which are from previous frame
+    _timerFrame = 1 - _timerFrame;
+    for (int pass = 0; pass < PASS_COUNT; pass++)
+    {
+        if (!_timerIssued[_timerFrame][pass])
+        {
+            _passTimes[pass] = 0.f; // pass has been skipped
+            continue;
+        }
+        GLuint available = 0;
+        glGetQueryObjectuiv(_timerQueries[_timerFrame][pass], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available)
+        {
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(_timerQueries[_timerFrame][pass], GL_QUERY_RESULT, &nanoseconds);
+            _passTimes[pass] = (float)((double)nanoseconds / 1000000.0);
+        }
+        _timerIssued[_timerFrame][pass] = false;
+    }
 }
 
 int WebView::GetX() const
@@ -19,6 +19,7 @@
 
 // Forward declarations
 class Texture;
+class RectsRenderItem;
 
 // Class
 class WebView
@@ -53,8 +54,34 @@ public:
     // Getter for weak pointer of texture
     std::weak_ptr<Texture> GetTexture();
 
-    // Set rects which are not dimmed
-    void SetHighlightRects(std::vector<Rect> rects);
+    // Set rects which are not dimmed. Rects are only uploaded when they changed
+    void SetHighlightRects(const std::vector<Rect>& rRects);
+
+    // GPU time in milliseconds of page, detail and composition pass of previous frame. Zero for skipped pass
+    glm::vec3 GetPassTimes() const;
+
+    // Set region which is visible after zooming, relative to web view with origin in upper left corner
+    // (minX, minY, maxX, maxY). Returns whether a new detail paint is required to cover that region
+    bool SetDetailRegion(bool active, glm::vec4 visibleRegion);
+
+    // Fill detail texture with requested region of paint which has higher resolution than web view
+    void FillDetail(int width, int height, const unsigned char* pBuffer);
+
+    // Update web view texture from paint with higher resolution. Dirty rects of paint are uploaded and
+    // downsampled into texture of target size by linear filtered blit
+    void FillDownsampled(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects, int targetWidth, int targetHeight);
+
+    // Copy paint into staging buffer instead of uploading it. Dirty rects are in pixels
+    void StagePaint(int width, int height, const unsigned char* pBuffer, const std::vector<Rect>& rDirtyRects);
+
+    // Upload staged paints at once. Returns count of paints covered by upload, zero when nothing was staged
+    int UploadStagedPaint();
+
+    // Shrink textures and framebuffers. They are resized at next paint and update
+    void ReleaseResources();
+
+    // Estimated bytes of GPU memory used by textures and framebuffers
+    size_t GetMemoryUsage() const;
 
 	// Getter for values of GUI element. Resolution may not be same as web page rendering
 	int GetX() const;
@@ -68,12 +95,30 @@ public:
 
 private:
 
+    // Passes of drawing measured by timer queries
+    enum Pass { PASS_PAGE, PASS_DETAIL, PASS_COMPOSITION, PASS_COUNT };
+
+    // Render given texture of web page into complete viewport
+    void DrawPage(const Texture* pTexture, float dim) const;
+
+    // Render highlight rects into currently bound framebuffer which displays given region of web view
+    void DrawHighlights(
+        glm::vec4 region,
+        float aspectRatio,
+        double scrollingOffsetX,
+        double scrollingOffsetY) const;
+
+    // Timer queries of passes
+    void BeginTimer(Pass pass) const;
+    void EndTimer() const;
+    void CollectTimers() const;
+
     // Texture object which belongs here but filled by CEF and read maybe by other
     std::shared_ptr<Texture> _spTexture;
 
     // Render item
     std::unique_ptr<RenderItem> _upWebpageRenderItem;
-	std::unique_ptr<RenderItem> _upHighlightRenderItem;
+	std::unique_ptr<RectsRenderItem> _upHighlightRenderItem;
     std::unique_ptr<RenderItem> _upCompositeRenderItem;
 
     // Current values
@@ -87,6 +132,31 @@ private:
 
     // Framebuffer to render highlights etc on webpage and later zoom in
     std::unique_ptr<Framebuffer> _upFramebuffer;
+
+    // Region of web page rendered with higher device scale factor while zoomed in
+    std::unique_ptr<Texture> _upDetailTexture;
+    std::unique_ptr<Framebuffer> _upDetailFramebuffer;
+    bool _detailActive = false;
+    bool _detailAvailable = false; // whether detail texture covers detail region
+    glm::vec4 _detailRegion; // region covered by detail texture (relative, origin in upper left corner)
+    glm::vec4 _requestedDetailRegion; // region to upload at next detail paint
+
+    // Complete paint with higher resolution, downsampled into web view texture by blit between framebuffers
+    std::unique_ptr<Texture> _upSupersampledTexture;
+    GLuint _blitFramebuffers[2] = { 0, 0 }; // read and draw
+
+    // Paints staged for upload right before composition
+    std::vector<unsigned char> _stagedPaint;
+    int _stagedWidth = 0;
+    int _stagedHeight = 0;
+    Rect _stagedDirtyRect; // union of dirty rects since last upload
+    int _stagedPaintCount = 0;
+
+    // Timer queries per pass, alternating between two frames
+    GLuint _timerQueries[2][PASS_COUNT];
+    mutable bool _timerIssued[2][PASS_COUNT] = { { false } };
+    mutable int _timerFrame = 0;
+    mutable float _passTimes[PASS_COUNT] = { 0.f };
 };
 
 #endif // WEBVIEW_H_
@@ -28,6 +28,9 @@ Web::Web(Master* pMaster, Mediator* pCefMediator, bool dataTransfer) : State(pMa
 	// Create hisotry manager
 	_upHistoryManager = std::unique_ptr<HistoryManager>(new HistoryManager(pMaster->GetUserDirectory()));
 
+	// Create favicon manager
+	_upFaviconManager = std::unique_ptr<FaviconManager>(new FaviconManager(pMaster->GetUserDirectory()));
+
 	// Create History
 	_upHistory = std::unique_ptr<History>(new History(_pMaster, _upHistoryManager.get()));
 
@@ -501,6 +504,9 @@ StateType Web::Update(float tpf, const std::shared_ptr<const Input> spInput)
 		_tabs.at(_currentTabId)->Update(tpf, spInput);
     }
 
+	// Tabs in background
+	UpdateTabLifecycles(tpf);
+
     // Decide what to do next
     if (_goToSettings)
     {
@@ -584,6 +590,16 @@ std::shared_ptr<HistoryManager::Page> Web::AddPageToHistory(std::string URL, std
 	return _upHistoryManager->AddPage(URL, title);
 }
 
+FaviconManager::State Web::GetFavicon(std::string URL, std::shared_ptr<const FaviconManager::Favicon>& rspFavicon)
+{
+	return _upFaviconManager->GetFavicon(URL, rspFavicon);
+}
+
+void Web::AddFavicon(std::string URL, std::unique_ptr<std::vector<unsigned char> > upData, int width, int height)
+{
+	_upFaviconManager->AddFavicon(URL, std::move(upData), width, height);
+}
+
 int Web::GetIndexOfTabInOrderVector(int id) const
 {
     // Search tab in order
@@ -671,31 +687,26 @@ void Web::UpdateTabOverview()
         std::string shortURL = ShortenURL(_tabs.at(tabId)->GetURL());
         eyegui::setContentOfTextBlock(_pTabOverviewLayout, textblockId, shortURL);
 
-        // Set webpage rendering as icon of button
-        auto wpTexture = _tabs.at(tabId)->GetWebViewTexture();
-        if(auto spTexture = wpTexture.lock())
+        // Set webpage rendering as icon of button (thumbnail of discarded tab)
+        std::vector<unsigned char> tabPreviewData;
+        int tabPreviewWidth;
+        int tabPreviewHeight;
+        if (_tabs.at(tabId)->GetPreview(
+            WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL,
+            tabPreviewWidth,
+            tabPreviewHeight,
+            tabPreviewData))
         {
-            // Fetch pixel data of tab in higher mip map level
-            std::vector<unsigned char> tabPreviewData;
-            int tabPreviewWidth;
-            int tabPreviewHeight;
-            if (spTexture->GetPixelsFromMipMap(
-                WEB_TAB_OVERVIEW_MINI_PREVIEW_MIP_MAP_LEVEL,
+            // Pipe it to eyeGUI
+            eyegui::setIconOfIconElement(
+                _pTabOverviewLayout,
+                buttonId,
+                buttonId + "_preview",
                 tabPreviewWidth,
                 tabPreviewHeight,
-                tabPreviewData))
-            {
-                // Pipe it to eyeGUI
-                eyegui::setIconOfIconElement(
-                    _pTabOverviewLayout,
-                    buttonId,
-                    buttonId + "_preview",
-                    tabPreviewWidth,
-                    tabPreviewHeight,
-                    eyegui::ColorFormat::RGBA,
-                    tabPreviewData.data(),
-                    true);
-            }
+                eyegui::ColorFormat::RGBA,
+                tabPreviewData.data(),
+                true);
         }
 
 		// Styling
@@ -885,6 +896,43 @@ void Web::UpdateTabOverviewIcon()
 	eyegui::setIconOfIconElement(_pWebLayout, "tab_overview", iconFilepath);
 }
 
+void Web::UpdateTabLifecycles(float tpf)
+{
+	if (!setup::TAB_LIFECYCLE_MANAGEMENT) { return; }
+
+	// Freeze and discard background Tabs after some time
+	std::vector<Tab*> liveTabs;
+	for (auto& rPair : _tabs)
+	{
+		if (rPair.first == _currentTabId) { continue; }
+		Tab* pTab = rPair.second.get();
+		pTab->UpdateBackgroundTime(tpf);
+		if (pTab->GetBackgroundTime() >= setup::TAB_DISCARD_TIME)
+		{
+			pTab->Discard();
+		}
+		else if (pTab->GetBackgroundTime() >= setup::TAB_FREEZE_TIME)
+		{
+			pTab->Freeze();
+		}
+		if (pTab->GetLifecycleState() != Tab::LifecycleState::DISCARDED)
+		{
+			liveTabs.push_back(pTab);
+		}
+	}
+
+	// Discard longest idle Tabs when too many are live
+	int excess = (int)liveTabs.size() - setup::TAB_MAX_LIVE_BACKGROUND_COUNT;
+	if (excess > 0)
+	{
+		std::sort(liveTabs.begin(), liveTabs.end(), [](const Tab* a, const Tab* b) { return a->GetBackgroundTime() > b->GetBackgroundTime(); });
+		for (int i = 0; i < excess; i++)
+		{
+			liveTabs.at(i)->Discard();
+		}
+	}
+}
+
 bool Web::ValidateURL(const std::string& rURL) const
 {
 	bool valid = false;
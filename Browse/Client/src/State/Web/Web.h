@@ -11,6 +11,7 @@
 #include "src/State/Web/Tab/Tab.h"
 #include "src/State/Web/Managers/BookmarkManager.h"
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Managers/FaviconManager.h"
 #include "src/State/Web/Screens/URLInput.h"
 #include "src/State/Web/Screens/History.h"
 #include <map>
@@ -113,6 +114,12 @@ public:
 	// Add history entry
 	virtual std::shared_ptr<HistoryManager::Page> AddPageToHistory(std::string URL, std::string title);
 
+	// Get favicon shared by all Tabs
+	virtual FaviconManager::State GetFavicon(std::string URL, std::shared_ptr<const FaviconManager::Favicon>& rspFavicon);
+
+	// Hand over downloaded favicon
+	virtual void AddFavicon(std::string URL, std::unique_ptr<std::vector<unsigned char> > upData, int width, int height);
+
 private:
 
     // Jobs given by Tab over WebTabInterface
@@ -214,6 +221,9 @@ private:
 	// Validate URL. Returns true if recognized as URL
 	bool ValidateURL(const std::string& rURL) const;
 
+	// Freeze and discard Tabs in background
+	void UpdateTabLifecycles(float tpf);
+
     // Maps id to Tab
     std::map<int, std::unique_ptr<Tab> > _tabs;
 
@@ -245,6 +255,9 @@ private:
 	// History manager
 	std::unique_ptr<HistoryManager> _upHistoryManager;
 
+	// Favicon manager
+	std::unique_ptr<FaviconManager> _upFaviconManager;
+
 	// History object
 	std::unique_ptr<History> _upHistory;
 
@@ -11,6 +11,7 @@
 #define WEBTABINTERFACE_H_
 
 #include "src/State/Web/Managers/HistoryManager.h"
+#include "src/State/Web/Managers/FaviconManager.h"
 #include "src/Award.h"
 #include <string>
 
@@ -32,6 +33,12 @@ public:
 
 	// Add history entry
 	virtual std::shared_ptr<HistoryManager::Page> AddPageToHistory(std::string URL, std::string title) = 0;
+
+	// Get favicon shared by all Tabs. Unknown favicons should be downloaded
+	virtual FaviconManager::State GetFavicon(std::string URL, std::shared_ptr<const FaviconManager::Favicon>& rspFavicon) = 0;
+
+	// Hand over downloaded favicon, which is processed in background
+	virtual void AddFavicon(std::string URL, std::unique_ptr<std::vector<unsigned char> > upData, int width, int height) = 0;
 };
 
 #endif // WEBTABINTERFACE_H_
@@ -0,0 +1,231 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "FileWriter.h"
+#include "src/Utils/Logger.h"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <io.h>
+#elif __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	// Suffixes of temporary file and backup
+	const std::string TEMPORARY_SUFFIX = ".tmp";
+	const std::string BACKUP_SUFFIX = ".bak";
+
+	// Footer is an XML comment so written files stay readable as plain XML
+	const std::string CHECKSUM_PREFIX = "\n<!-- checksum ";
+	const std::string CHECKSUM_POSTFIX = " -->\n";
+
+	// FNV-1a hash of content
+	std::string Checksum(const std::string& rContent)
+	{
+		uint32_t hash = 2166136261u;
+		for (unsigned char c : rContent)
+		{
+			hash ^= c;
+			hash *= 16777619u;
+		}
+		char buffer[9];
+		std::snprintf(buffer, sizeof(buffer), "%08x", hash);
+		return std::string(buffer);
+	}
+
+	// Read file and verify checksum. Files without checksum footer may be accepted as written before checksums
+	// were introduced, but only if validation accepts them
+	bool ReadVerified(const std::string& rFullpath, std::string& rContent, bool acceptWithoutChecksum,
+		const std::function<bool(const std::string&)>& rValidate)
+	{
+		std::ifstream file(rFullpath, std::ios::binary);
+		if (!file.is_open()) { return false; }
+		std::stringstream stream;
+		stream << file.rdbuf();
+		std::string content = stream.str();
+		if (content.empty()) { return false; }
+
+		// Split footer from content
+		const size_t footerSize = CHECKSUM_PREFIX.size() + 8 + CHECKSUM_POSTFIX.size();
+		const size_t footerStart = content.rfind(CHECKSUM_PREFIX);
+		if (footerStart == std::string::npos)
+		{
+			if (!acceptWithoutChecksum || (rValidate && !rValidate(content))) { return false; }
+			rContent = content;
+			return true;
+		}
+		if (content.size() - footerStart != footerSize
+			|| content.compare(footerStart + CHECKSUM_PREFIX.size() + 8, std::string::npos, CHECKSUM_POSTFIX) != 0)
+		{
+			return false;
+		}
+		std::string checksum = content.substr(footerStart + CHECKSUM_PREFIX.size(), 8);
+		content.resize(footerStart);
+		if (Checksum(content) != checksum) { return false; }
+		if (rValidate && !rValidate(content)) { return false; }
+		rContent = content;
+		return true;
+	}
+
+	// Make sure written data reaches the hard disk before file is renamed. Returns whether successful
+	bool SyncFile(FILE* pFile)
+	{
+		if (std::fflush(pFile) != 0) { return false; }
+#ifdef _WIN32
+		return _commit(_fileno(pFile)) == 0;
+#elif __linux__
+		return fsync(fileno(pFile)) == 0;
+#else
+		return true;
+#endif
+	}
+
+	// Make sure renames within directory of file are persistent. Not possible on Windows
+	void SyncDirectory(const std::string& rFullpath)
+	{
+#ifdef __linux__
+		size_t slash = rFullpath.find_last_of('/');
+		std::string directory = slash == std::string::npos ? "." : rFullpath.substr(0, slash + 1);
+		int descriptor = open(directory.c_str(), O_RDONLY);
+		if (descriptor >= 0)
+		{
+			fsync(descriptor);
+			close(descriptor);
+		}
+#endif
+	}
+}
+
+FileWriter::FileWriter(std::string fullpath) : _fullpath(fullpath)
+{
+	_worker = std::thread(&FileWriter::Work, this);
+}
+
+FileWriter::~FileWriter()
+{
+	// Worker writes pending content before it returns
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_shutdown = true;
+	}
+	_contentAvailable.notify_all();
+	_worker.join();
+
+	LogInfo("FileWriter: ", _fullpath, " requested ", _requestCount, " times, written ", _writeCount, " times, failed ", _failCount, " times");
+}
+
+void FileWriter::Write(std::string content)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_pending && !_writing && content == _lastWritten)
+		{
+			return; // file already has content
+		}
+		_content = std::move(content);
+		_pending = true;
+		_requestCount++;
+	}
+	_contentAvailable.notify_one();
+}
+
+void FileWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_written.wait(lock, [this] { return !_pending && !_writing; });
+}
+
+bool FileWriter::Read(const std::string& rFullpath, std::string& rContent, std::function<bool(const std::string&)> validate)
+{
+	if (ReadVerified(rFullpath, rContent, true, validate)) { return true; }
+
+	// Temporary file is complete when worker stopped between both renames
+	if (ReadVerified(rFullpath + TEMPORARY_SUFFIX, rContent, false, validate))
+	{
+		LogInfo("FileWriter: Recovered ", rFullpath, " from temporary file");
+		return true;
+	}
+	if (ReadVerified(rFullpath + BACKUP_SUFFIX, rContent, true, validate))
+	{
+		LogInfo("FileWriter: Recovered ", rFullpath, " from backup");
+		return true;
+	}
+	return false;
+}
+
+void FileWriter::Work()
+{
+	while (true)
+	{
+		// Take latest content
+		std::string content;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_contentAvailable.wait(lock, [this] { return _shutdown || _pending; });
+			if (!_pending)
+			{
+				return; // shutdown and nothing left to write
+			}
+			content = std::move(_content);
+			_pending = false;
+			_writing = true;
+		}
+
+		// Write it
+		bool success = WriteFile(content);
+
+		// Tell waiting threads. Remember content only when it reached the file, so failed content is written again
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_writing = false;
+			if (success) { _writeCount++; } else { _failCount++; }
+			_lastWritten = success ? std::move(content) : std::string();
+		}
+		_written.notify_all();
+	}
+}
+
+bool FileWriter::WriteFile(const std::string& rContent) const
+{
+	const std::string temporaryPath = _fullpath + TEMPORARY_SUFFIX;
+	const std::string backupPath = _fullpath + BACKUP_SUFFIX;
+
+	// Write temporary file with checksum footer and sync it, so rename never exposes incomplete data after power loss
+	{
+		FILE* pFile = std::fopen(temporaryPath.c_str(), "wb");
+		if (pFile == NULL)
+		{
+			LogError("FileWriter: Failed to open ", temporaryPath);
+			return false;
+		}
+		const std::string data = rContent + CHECKSUM_PREFIX + Checksum(rContent) + CHECKSUM_POSTFIX;
+		bool good = std::fwrite(data.data(), 1, data.size(), pFile) == data.size();
+		good = SyncFile(pFile) && good;
+		good = (std::fclose(pFile) == 0) && good;
+		if (!good)
+		{
+			LogError("FileWriter: Failed to write ", temporaryPath);
+			return false;
+		}
+	}
+
+	// Keep current file as backup. Renaming onto existing file fails on Windows, so remove old backup first
+	std::remove(backupPath.c_str());
+	std::rename(_fullpath.c_str(), backupPath.c_str()); // fails when there is no file, yet
+
+	// Move temporary file into place
+	if (std::rename(temporaryPath.c_str(), _fullpath.c_str()) != 0)
+	{
+		LogError("FileWriter: Failed to rename ", temporaryPath, " to ", _fullpath);
+		return false;
+	}
+	SyncDirectory(_fullpath);
+	return true;
+}
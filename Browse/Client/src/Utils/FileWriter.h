@@ -0,0 +1,70 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Writer of small text files on a worker thread. Content written while the
+// worker is busy replaces pending content, so only the latest one reaches the
+// hard disk. Content is written to a temporary file with checksum first and
+// synced to disk and renamed afterwards, previous file is kept as backup.
+// Reading falls back to temporary file and backup when file is missing,
+// corrupted or rejected by the caller.
+
+#ifndef FILEWRITER_H_
+#define FILEWRITER_H_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class FileWriter
+{
+public:
+
+	// Constructor, starts worker
+	FileWriter(std::string fullpath);
+
+	// Destructor, writes pending content before stopping worker
+	virtual ~FileWriter();
+
+	// Write content in background. Replaces content that is not written yet. Skipped when
+	// content equals the last successfully written one and nothing else is pending
+	void Write(std::string content);
+
+	// Block until pending content has been written
+	void Flush();
+
+	// Read content of last good copy of file. Copies without checksum are only taken when validation
+	// accepts them, e.g. when they can be parsed. Returns whether successful
+	static bool Read(const std::string& rFullpath, std::string& rContent,
+		std::function<bool(const std::string&)> validate = nullptr);
+
+private:
+
+	// Loop of worker
+	void Work();
+
+	// Write content to temporary file and replace file with it. Returns whether successful
+	bool WriteFile(const std::string& rContent) const;
+
+	// Fullpath to file
+	std::string _fullpath;
+
+	// Worker
+	std::thread _worker;
+	std::mutex _mutex; // guards everything below
+	std::condition_variable _contentAvailable;
+	std::condition_variable _written;
+	std::string _content;
+	bool _pending = false;
+	bool _writing = false;
+	bool _shutdown = false;
+	std::string _lastWritten; // content of last successful write, empty after failure
+
+	// Statistics
+	int _requestCount = 0;
+	int _writeCount = 0;
+	int _failCount = 0;
+};
+
+#endif // FILEWRITER_H_
@@ -0,0 +1,152 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "JobPool.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <sstream>
+
+JobPool::JobPool(int workerCount, int telemetryCapacity) : _telemetryCapacity(telemetryCapacity)
+{
+	for (int i = 0; i < workerCount; i++)
+	{
+		_workers.push_back(std::thread(&JobPool::Work, this));
+	}
+}
+
+JobPool::~JobPool()
+{
+	Shutdown(0.f);
+}
+
+bool JobPool::Push(std::function<void()> job, JobLane lane, std::string mergeKey)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_shutdown)
+		{
+			return false;
+		}
+
+		Job newJob;
+		newJob.function = job;
+		newJob.mergeKey = mergeKey;
+		newJob.queued = std::chrono::steady_clock::now();
+
+		if (lane == JobLane::INTERACTIVE)
+		{
+			_interactiveJobs.push_back(newJob);
+		}
+		else
+		{
+			// Replace queued job with same merge key, it keeps its position in queue
+			auto it = mergeKey.empty() ? _telemetryJobs.end() : std::find_if(_telemetryJobs.begin(), _telemetryJobs.end(), [&](const Job& rJob) { return rJob.mergeKey == mergeKey; });
+			if (it != _telemetryJobs.end())
+			{
+				it->function = job;
+				_mergedCount++;
+			}
+			else
+			{
+				// Drop oldest job when lane is full
+				if ((int)_telemetryJobs.size() >= _telemetryCapacity)
+				{
+					_telemetryJobs.pop_front();
+					_droppedCount++;
+				}
+				_telemetryJobs.push_back(newJob);
+			}
+		}
+		_maxQueueDepth = std::max(_maxQueueDepth, (int)(_interactiveJobs.size() + _telemetryJobs.size()));
+	}
+	_jobAvailable.notify_one();
+	return true;
+}
+
+void JobPool::Shutdown(float timeout)
+{
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (_shutdown)
+		{
+			return;
+		}
+
+		// Give workers time to finish queue
+		_idle.wait_for(lock, std::chrono::duration<float>(timeout), [this]
+		{
+			return _interactiveJobs.empty() && _telemetryJobs.empty() && _runningCount == 0;
+		});
+
+		// Cancel what is left, running jobs cannot be interrupted
+		_cancelledCount += (int)(_interactiveJobs.size() + _telemetryJobs.size());
+		_interactiveJobs.clear();
+		_telemetryJobs.clear();
+		_shutdown = true;
+	}
+	_jobAvailable.notify_all();
+	for (auto& rWorker : _workers)
+	{
+		rWorker.join();
+	}
+	LogInfo("JobPool: ", GetSummary());
+}
+
+std::string JobPool::GetSummary() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::ostringstream stream;
+	stream.precision(1);
+	stream << std::fixed
+		<< "Queue depth " << (_interactiveJobs.size() + _telemetryJobs.size()) << " (max " << _maxQueueDepth << ")"
+		<< ", done " << _doneCount << ", dropped " << _droppedCount << ", merged " << _mergedCount << ", cancelled " << _cancelledCount
+		<< ", wait avg " << (_doneCount > 0 ? _waitSum / _doneCount : 0.0) << "ms (max " << _waitMax << "ms)"
+		<< ", run avg " << (_doneCount > 0 ? _runSum / _doneCount : 0.0) << "ms";
+	return stream.str();
+}
+
+void JobPool::Work()
+{
+	while (true)
+	{
+		// Take next job, interactive ones first
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_jobAvailable.wait(lock, [this] { return _shutdown || !_interactiveJobs.empty() || !_telemetryJobs.empty(); });
+			if (_shutdown)
+			{
+				return;
+			}
+			std::deque<Job>& rQueue = _interactiveJobs.empty() ? _telemetryJobs : _interactiveJobs;
+			job = std::move(rQueue.front());
+			rQueue.pop_front();
+			_runningCount++;
+		}
+
+		// Execute job
+		auto start = std::chrono::steady_clock::now();
+		try
+		{
+			job.function();
+		}
+		catch (const std::exception& e)
+		{
+			LogError("JobPool: Job failed: ", e.what());
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		// Update metrics
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			const double wait = std::chrono::duration<double, std::milli>(start - job.queued).count();
+			_waitSum += wait;
+			_waitMax = std::max(_waitMax, wait);
+			_runSum += std::chrono::duration<double, std::milli>(end - start).count();
+			_doneCount++;
+			_runningCount--;
+		}
+		_idle.notify_all();
+	}
+}
@@ -0,0 +1,78 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Fixed count of worker threads executing jobs from two lanes. Interactive
+// jobs are never dropped and always taken first. Telemetry jobs queue up to a
+// capacity, beyond that the oldest one is dropped. Queued telemetry job with
+// same merge key is replaced by newer one.
+
+#ifndef JOBPOOL_H_
+#define JOBPOOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Lanes of jobs
+enum class JobLane { INTERACTIVE, TELEMETRY };
+
+class JobPool
+{
+public:
+
+	// Constructor, starts workers
+	JobPool(int workerCount, int telemetryCapacity);
+
+	// Destructor, cancels queued jobs and waits for running ones
+	virtual ~JobPool();
+
+	// Push job. Empty merge key means that job is never merged. Returns false when pool has been shut down
+	bool Push(std::function<void()> job, JobLane lane, std::string mergeKey = "");
+
+	// Wait until queue is empty or timeout in seconds is reached, cancel remaining jobs and stop workers
+	void Shutdown(float timeout);
+
+	// Queue depth, latency and drops as text
+	std::string GetSummary() const;
+
+private:
+
+	// Queued job
+	struct Job
+	{
+		std::function<void()> function;
+		std::string mergeKey;
+		std::chrono::steady_clock::time_point queued;
+	};
+
+	// Loop of workers
+	void Work();
+
+	// Members
+	std::vector<std::thread> _workers;
+	int _telemetryCapacity;
+	mutable std::mutex _mutex; // guards everything below
+	std::condition_variable _jobAvailable;
+	std::condition_variable _idle;
+	std::deque<Job> _interactiveJobs;
+	std::deque<Job> _telemetryJobs;
+	int _runningCount = 0;
+	bool _shutdown = false;
+
+	// Metrics
+	int _maxQueueDepth = 0;
+	int _doneCount = 0;
+	int _droppedCount = 0;
+	int _mergedCount = 0;
+	int _cancelledCount = 0;
+	double _waitSum = 0; // milliseconds from push until start of job
+	double _waitMax = 0;
+	double _runSum = 0; // milliseconds of execution
+};
+
+#endif // JOBPOOL_H_
@@ -0,0 +1,61 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// Bounded queue for exactly one producer thread and one consumer thread.
+// Neither side blocks, producer drops elements when queue is full.
+
+#ifndef LOCKFREEQUEUE_H_
+#define LOCKFREEQUEUE_H_
+
+#include <atomic>
+#include <vector>
+
+template<typename T>
+class LockFreeQueue
+{
+public:
+
+	// Constructor. One slot stays empty to distinguish full from empty queue
+	LockFreeQueue(size_t capacity) : _buffer(capacity + 1) {}
+
+	// Called by producer. Returns false when queue is full
+	bool Push(const T& rElement)
+	{
+		const size_t tail = _tail.load(std::memory_order_relaxed);
+		const size_t next = (tail + 1) % _buffer.size();
+		if (next == _head.load(std::memory_order_acquire))
+		{
+			_dropCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		_buffer[tail] = rElement;
+		_tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	// Called by consumer. Returns false when queue is empty
+	bool Pop(T& rElement)
+	{
+		const size_t head = _head.load(std::memory_order_relaxed);
+		if (head == _tail.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+		rElement = _buffer[head];
+		_head.store((head + 1) % _buffer.size(), std::memory_order_release);
+		return true;
+	}
+
+	// Count of elements dropped because queue was full
+	unsigned int GetDropCount() const { return _dropCount.load(std::memory_order_relaxed); }
+
+private:
+
+	// Members
+	std::vector<T> _buffer;
+	std::atomic<size_t> _head{ 0 }; // written by consumer
+	std::atomic<size_t> _tail{ 0 }; // written by producer
+	std::atomic<unsigned int> _dropCount{ 0 };
+};
+
+#endif // LOCKFREEQUEUE_H_
@@ -0,0 +1,42 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "RectsRenderItem.h"
+
+RectsRenderItem::RectsRenderItem(std::string vertSource, std::string geomSource, std::string fragSource)
+: RenderItem(vertSource, geomSource, fragSource)
+{
+    // Create vertex buffer and bring it together with vertex array
+    glGenBuffers(1, &_vbo);
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, NULL);
+
+    // Unbind everything
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+RectsRenderItem::~RectsRenderItem()
+{
+    glDeleteBuffers(1, &_vbo);
+}
+
+void RectsRenderItem::Fill(const std::vector<glm::vec4>& rRects)
+{
+    // Orphan old data, so no synchronization with previous draw is necessary
+    _count = (int)rRects.size();
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, rRects.size() * sizeof(glm::vec4), rRects.empty() ? NULL : rRects.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void RectsRenderItem::Draw(GLenum mode) const
+{
+    if (_count > 0)
+    {
+        glDrawArrays(mode, 0, _count);
+    }
+}
@@ -0,0 +1,40 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+// RenderItem with vertex buffer of rects. Each rect is a point which is
+// expanded by geometry shader, so all rects are drawn with a single call.
+
+#ifndef RECTSRENDERITEM_H_
+#define RECTSRENDERITEM_H_
+
+#include "src/Utils/RenderItem.h"
+#include "src/Utils/glmWrapper.h"
+#include <vector>
+
+class RectsRenderItem : public RenderItem
+{
+public:
+
+    // Constructor. Rects are read from attribute at location zero
+    RectsRenderItem(std::string vertSource, std::string geomSource, std::string fragSource);
+
+    // Destructor
+    virtual ~RectsRenderItem();
+
+    // Upload rects into vertex buffer
+    void Fill(const std::vector<glm::vec4>& rRects);
+
+    // Drawing of all rects
+    virtual void Draw(GLenum mode = GL_POINTS) const;
+
+    // Count of rects in vertex buffer
+    int GetCount() const { return _count; }
+
+private:
+
+    // Vertex buffer with rects
+    GLuint _vbo = 0;
+    int _count = 0;
+};
+
+#endif // RECTSRENDERITEM_H_
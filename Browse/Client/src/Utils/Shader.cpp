@@ -5,6 +5,32 @@
 
 #include "Shader.h"
 #include "submodules/glm/glm/gtc/type_ptr.hpp"
+#include <cstring>
+
+// Names of uniforms in shader sources, in order of enumeration
+static const char* UNIFORM_NAMES[] =
+{
+    "aspectRatio",
+    "centerOffset",
+    "color",
+    "detail",
+    "detailRegion",
+    "detailTex",
+    "dim",
+    "focusPixelPosition",
+    "focusPixelRadius",
+    "matrix",
+    "peripheryMultiplier",
+    "position",
+    "region",
+    "resolution",
+    "scrollingOffset",
+    "tex",
+    "textureCoordinate",
+    "zoom",
+    "zoomPosition"
+};
+static_assert(sizeof(UNIFORM_NAMES) / sizeof(UNIFORM_NAMES[0]) == (size_t)Shader::Uniform::COUNT, "Each uniform needs a name");
 
 Shader::Shader(std::string vertSource, std::string fragSource) : Shader(vertSource, "", fragSource)
 {
@@ -46,6 +72,27 @@ Shader::Shader(std::string vertSource, std::string geomSource, std::string fragS
     glDeleteShader(vertexShader);
     if(geometryShader >= 0) { glDeleteShader(geometryShader); }
     glDeleteShader(fragmentShader);
+
+    // Resolve locations of active uniforms once
+    GLint count = 0;
+    glGetProgramiv(_program, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; i++)
+    {
+        char name[128];
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = GL_ZERO;
+        glGetActiveUniform(_program, (GLuint)i, sizeof(name) - 1, &length, &size, &type, name);
+        name[length] = 0;
+        for (int j = 0; j < (int)Uniform::COUNT; j++)
+        {
+            if (std::strcmp(name, UNIFORM_NAMES[j]) == 0)
+            {
+                _uniforms[j].location = glGetUniformLocation(_program, name);
+                break;
+            }
+        }
+    }
 }
 
 Shader::~Shader()
@@ -58,32 +105,57 @@ void Shader::Bind() const
     glUseProgram(_program);
 }
 
-void Shader::UpdateValue(std::string name, const int& rValue) const
+void Shader::UpdateValue(Uniform uniform, const int& rValue) const
 {
-    glUniform1i(glGetUniformLocation(_program, name.c_str()), rValue);
+    GLint location = CacheValue(uniform, &rValue, sizeof(rValue));
+    if (location >= 0) { glUniform1i(location, rValue); }
 }
 
-void Shader::UpdateValue(std::string name, const float& rValue) const
+void Shader::UpdateValue(Uniform uniform, const float& rValue) const
 {
-    glUniform1f(glGetUniformLocation(_program, name.c_str()), rValue);
+    GLint location = CacheValue(uniform, &rValue, sizeof(rValue));
+    if (location >= 0) { glUniform1f(location, rValue); }
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec2& rValue) const
+void Shader::UpdateValue(Uniform uniform, const glm::vec2& rValue) const
 {
-    glUniform2fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    GLint location = CacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+    if (location >= 0) { glUniform2fv(location, 1, glm::value_ptr(rValue)); }
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec3& rValue) const
+void Shader::UpdateValue(Uniform uniform, const glm::vec3& rValue) const
 {
-    glUniform3fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    GLint location = CacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+    if (location >= 0) { glUniform3fv(location, 1, glm::value_ptr(rValue)); }
 }
 
-void Shader::UpdateValue(std::string name, const glm::vec4& rValue) const
+void Shader::UpdateValue(Uniform uniform, const glm::vec4& rValue) const
 {
-    glUniform4fv(glGetUniformLocation(_program, name.c_str()), 1, glm::value_ptr(rValue));
+    GLint location = CacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+    if (location >= 0) { glUniform4fv(location, 1, glm::value_ptr(rValue)); }
 }
 
-void Shader::UpdateValue(std::string name, const glm::mat4& rValue) const
+void Shader::UpdateValue(Uniform uniform, const glm::mat4& rValue) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(_program, name.c_str()), 1, GL_FALSE, glm::value_ptr(rValue));
+    GLint location = CacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+    if (location >= 0) { glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(rValue)); }
+}
+
+GLint Shader::CacheValue(Uniform uniform, void const * pValue, size_t size) const
+{
+    // Uniforms not active in program are ignored like OpenGL does for location -1
+    UniformCache& rUniform = _uniforms[(int)uniform];
+    if (rUniform.location < 0)
+    {
+        return -1;
+    }
+
+    // Values stay in program, so upload only when value differs
+    if (rUniform.filled && std::memcmp(rUniform.value, pValue, size) == 0)
+    {
+        return -1;
+    }
+    std::memcpy(rUniform.value, pValue, size);
+    rUniform.filled = true;
+    return rUniform.location;
 }
@@ -15,6 +15,31 @@ class Shader
 {
 public:
 
+    // Uniforms used by shaders, resolved once after linking
+    enum class Uniform
+    {
+        ASPECT_RATIO,
+        CENTER_OFFSET,
+        COLOR,
+        DETAIL,
+        DETAIL_REGION,
+        DETAIL_TEX,
+        DIM,
+        FOCUS_PIXEL_POSITION,
+        FOCUS_PIXEL_RADIUS,
+        MATRIX,
+        PERIPHERY_MULTIPLIER,
+        POSITION,
+        REGION,
+        RESOLUTION,
+        SCROLLING_OFFSET,
+        TEX,
+        TEXTURE_COORDINATE,
+        ZOOM,
+        ZOOM_POSITION,
+        COUNT
+    };
+
     // Constructor
     Shader(std::string vertSource, std::string fragSource);
     Shader(std::string vertSource, std::string geomSource, std::string fragSource);
@@ -25,21 +50,35 @@ public:
     // Bind shader program
     void Bind() const;
 
-    // Update values in shader. Bind before updating!
-    void UpdateValue(std::string name, const int& rValue) const;
-    void UpdateValue(std::string name, const float& rValue) const;
-    void UpdateValue(std::string name, const glm::vec2& rValue) const;
-    void UpdateValue(std::string name, const glm::vec3& rValue) const;
-    void UpdateValue(std::string name, const glm::vec4& rValue) const;
-    void UpdateValue(std::string name, const glm::mat4& rValue) const;
+    // Update values in shader. Bind before updating! Skipped if uniform has that value already or is not used by shader
+    void UpdateValue(Uniform uniform, const int& rValue) const;
+    void UpdateValue(Uniform uniform, const float& rValue) const;
+    void UpdateValue(Uniform uniform, const glm::vec2& rValue) const;
+    void UpdateValue(Uniform uniform, const glm::vec3& rValue) const;
+    void UpdateValue(Uniform uniform, const glm::vec4& rValue) const;
+    void UpdateValue(Uniform uniform, const glm::mat4& rValue) const;
 
     // Get program handle
     GLuint GetProgram() const { return _program; }
 
 private:
 
+    // Location and last value of uniform
+    struct UniformCache
+    {
+        GLint location = -1;
+        bool filled = false;
+        unsigned char value[sizeof(glm::mat4)];
+    };
+
+    // Remember value of uniform. Returns location if value has changed, else -1
+    GLint CacheValue(Uniform uniform, void const * pValue, size_t size) const;
+
     // Handle
     GLuint _program = 0;
+
+    // Uniforms of program, indexed by uniform
+    mutable UniformCache _uniforms[(int)Uniform::COUNT];
 };
 
 
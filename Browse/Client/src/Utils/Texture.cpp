@@ -121,6 +121,58 @@ void Texture::Fill(
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void Texture::FillRegion(
+    int bufferWidth,
+    int x,
+    int y,
+    int width,
+    int height,
+    GLenum inputFormat,
+    unsigned char const * pBuffer)
+{
+    // Let OpenGL skip pixels outside of region while reading from buffer
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, bufferWidth);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+
+    // Fill texture with region
+    Fill(width, height, inputFormat, pBuffer);
+
+    // Set back to standard
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+}
+
+void Texture::UpdateRegion(
+    int x,
+    int y,
+    int width,
+    int height,
+    GLenum inputFormat,
+    unsigned char const * pBuffer)
+{
+    if (!_initialized || width <= 0 || height <= 0) { return; }
+
+    // Bind texture
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, _handle);
+
+    // Let OpenGL read region from buffer which has size of texture
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, _width);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, inputFormat, GL_UNSIGNED_BYTE, pBuffer);
+
+    // Set back to standard
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+
+    // Unbind texture
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 int Texture::GetWidth() const
 {
     return _width;
@@ -53,6 +53,28 @@ public:
         int unpackAlignment = 4,
         bool forceReallocation = false);
 
+    // Fill texture with region of bigger buffer, automatically reallocates if size changes
+    virtual void FillRegion(
+        int bufferWidth,
+        int x,
+        int y,
+        int width,
+        int height,
+        GLenum inputFormat,
+        unsigned char const * pBuffer);
+
+    // Update region of already allocated texture from buffer of same size as texture
+    virtual void UpdateRegion(
+        int x,
+        int y,
+        int width,
+        int height,
+        GLenum inputFormat,
+        unsigned char const * pBuffer);
+
+    // Getter for OpenGL handle, e.g. to attach texture to framebuffer
+    GLuint GetHandle() const { return _handle; }
+
     // Getter for width and height
     int GetWidth() const;
     int GetHeight() const;
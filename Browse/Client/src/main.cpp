@@ -13,6 +13,7 @@
 
 #include "src/Master/Master.h"
 #include "src/Utils/Logger.h"
+#include "src/Global.h"
 
 
 // Execute function to have Master object on stack which might be faster than on heap
@@ -69,6 +70,9 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
 	settings.windowless_rendering_enabled = true;
 	settings.remote_debugging_port = 8088;
 
+	// Let CEF tell when message loop work is necessary instead of relying on single work per frame
+	settings.external_message_pump = setup::CEF_EXTERNAL_MESSAGE_PUMP;
+
     // Initialize CEF
     LogInfo("Initializing CEF...");
     CefInitialize(args, settings, app.get(), windows_sandbox_info);
@@ -77,6 +81,12 @@ int CommonMain(const CefMainArgs& args, CefSettings settings, CefRefPtr<MainCefA
     // Execute our code
     bool shutdownOnExit = Execute(app, userDirectory);
 
+    // Let browsers close, since Master no longer pumps message loop of CEF
+    if (setup::CEF_EXTERNAL_MESSAGE_PUMP)
+    {
+        app->FinishBrowserClosing(MEDIATOR_BROWSER_CLOSE_TIMEOUT);
+    }
+
     // Shutdown CEF
     LogInfo("Shutdown CEF...");
     CefShutdown();
@@ -1,10 +1,12 @@
 #include "trie.h"
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <string>
 #include <sstream>
-#include <set>
+#include <chrono>
+#include <cstdlib>
 
 #include <fstream>
 #include <iostream>
@@ -14,142 +16,296 @@ using namespace std;
 /**
 * Constructor of the Tree Class
 * Keyboard uses it for the Wordcomplition
-* @param[in] first Node must be empty
+* Creates the empty root node
 */
-Trie::Trie(const string &val = "") {
-    value = val;
-    flag = false;
+Trie::Trie() {
+    nodes.push_back(Node());
+    suggestions.resize(TRIE_SUGGESTION_COUNT, -1);
 }
 
 /**
 * Function of the Tree Class
 * searches after a word in the Trie-Tree
 * @param[in] word variable used for the search
+* @return word if it is a prefix in the Trie-Tree, otherwise empty string
 */
 string Trie::find(const string &word) {
-    Trie * node = this;
-    for (size_t i = 0; i < word.length(); i++) {
-        const char c = word[i];
-        if (node->children.find(c) == node->children.end())
-            return "";
-        else
-            node = &node->children[c];
-    }
-    return node->value;
+    return findNode(word) < 0 ? "" : word;
+}
+
+/**
+* Function of the Tree Class
+* Walks along the characters of the prefix
+* @param[in] prefix variable used for the search
+* @return index of node or -1 if prefix is not included
+*/
+int Trie::findNode(const string &prefix) const {
+    int node = 0;
+    for (size_t i = 0; i < prefix.length() && node >= 0; i++)
+        node = findChild(node, prefix[i]);
+    return node;
+}
+
+/**
+* Function of the Tree Class
+* Searches child of node with char
+* @param[in] node index of parent node
+* @param[in] c char of child
+* @return index of child or -1 if not existing
+*/
+int Trie::findChild(int node, char c) const {
+    int child = nodes[node].firstChild;
+    while (child >= 0 && nodes[child].c < c)
+        child = nodes[child].nextSibling;
+    return (child >= 0 && nodes[child].c == c) ? child : -1;
 }
 
 //------------------------------------------------------------------
 /**
 * Function of the Tree Class
 * Adds Word to the Trie-Tree
+* Earlier inserted words are suggested first
 * @param[in] word variable used for the insert
 */
 void Trie::insert(const string &word) {
-    Trie * node = this;
-    for (size_t i = 0; i < word.length(); i++) {
-        const char c = word[i];
-        if (node->children.find(c) == node->children.end())
-            node->add(c);
-        node = &node->children[c];
-    }
-    node->flag = true;
+    const size_t count = words.size();
+    const int id = insertWord(word);
+    if (words.size() > count)
+        rank(word, id);
 }
 
 /**
 * Function of the Tree Class
-* Adds Char to the Trie-Tree
+* Returns child of node with char, which is created if not existing
+* Siblings are kept sorted by char
 * used by the insert function
-* @param[in] Char variable used for the insert
+* @param[in] node index of parent node
+* @param[in] c char of child
 */
-void Trie::add(char c) {
-    if (value == "")
-        children[c] = Trie(string(1, c));
+int Trie::childOf(int node, char c) {
+    int previous = -1;
+    int child = nodes[node].firstChild;
+    while (child >= 0 && nodes[child].c < c) {
+        previous = child;
+        child = nodes[child].nextSibling;
+    }
+    if (child >= 0 && nodes[child].c == c)
+        return child;
+
+    // Link new node between previous and child
+    const int index = (int)nodes.size();
+    nodes.push_back(Node());
+    nodes[index].c = c;
+    nodes[index].nextSibling = child;
+    if (previous < 0)
+        nodes[node].firstChild = index;
     else
-        children[c] = Trie(value + c);
+        nodes[previous].nextSibling = index;
+    suggestions.resize(nodes.size() * TRIE_SUGGESTION_COUNT, -1);
+    return index;
 }
-//------------------------------------------------------------------
 
 /**
 * Function of the Tree Class
-* searches all Prefixes
+* Adds nodes for word without ranking it
+* @param[in] word variable used for the insert
+* @return id of word
 */
-vector<string> Trie::all_prefixes() {
-    vector<string> results;
-    if (flag)
-        results.push_back(value);
-
-    if (children.size()) {
-        map<char, Trie>::iterator iter;
-        vector<string>::iterator node;
-        for (iter = children.begin(); iter != children.end(); iter++) {
-            vector<string> nodes = iter->second.all_prefixes();
-            results.insert(results.end(), nodes.begin(), nodes.end());
+int Trie::insertWord(const string &word) {
+    int node = 0;
+    for (size_t i = 0; i < word.length(); i++)
+        node = childOf(node, word[i]);
+    if (nodes[node].word < 0) {
+        nodes[node].word = (int)words.size();
+        words.push_back(word);
+        counts.push_back(0);
+    }
+    return nodes[node].word;
+}
+
+/**
+* Function of the Tree Class
+* Words chosen more often rank higher, otherwise order of dictionary decides
+* @param[in] a id of first word
+* @param[in] b id of second word
+*/
+bool Trie::ranksHigher(int a, int b) const {
+    if (counts[a] != counts[b])
+        return counts[a] > counts[b];
+    return a < b;
+}
+
+/**
+* Function of the Tree Class
+* Moves word up in the cached suggestions of all nodes along the word
+* Rank of a word only increases, so other cached words stay valid
+* @param[in] word variable used for the walk
+* @param[in] id of word
+*/
+void Trie::rank(const string &word, int id) {
+    int node = 0;
+    for (size_t i = 0; i <= word.length(); i++) {
+        int32_t *list = &suggestions[node * TRIE_SUGGESTION_COUNT];
+        uint8_t &count = nodes[node].suggestionCount;
+
+        // Find slot of word, which might replace the last one
+        int pos = 0;
+        while (pos < count && list[pos] != id)
+            pos++;
+        if (pos == count) {
+            if (count < TRIE_SUGGESTION_COUNT)
+                count++;
+            else if (ranksHigher(id, list[TRIE_SUGGESTION_COUNT - 1]))
+                pos = TRIE_SUGGESTION_COUNT - 1;
+            else
+                pos = -1;
+        }
+
+        // Bubble it up
+        if (pos >= 0) {
+            list[pos] = id;
+            for (; pos > 0 && ranksHigher(list[pos], list[pos - 1]); pos--)
+                swap(list[pos], list[pos - 1]);
         }
+
+        if (i < word.length())
+            node = findChild(node, word[i]);
     }
-    return results;
 }
+//------------------------------------------------------------------
 
 /**
 * Function of the Tree Class
 * Seaches Trie-Tree for words on hand of the prefix
+* Only the best ranked words are returned, at most TRIE_SUGGESTION_COUNT
 * @param[in] prefix variable used for the Search
 */
 vector<string> Trie::autocomplete(const string &prefix) {
-    Trie * node = this;
     vector<string> results;
-    for (size_t i = 0; i < prefix.length(); i++) {
-        const char c = prefix[i];
-        if (node->children.find(c) == node->children.end())
-            return results;
-        else
-            node = &node->children[c];
-    }
-    return node->all_prefixes();
+    const int node = findNode(prefix);
+    if (node < 0)
+        return results;
+    const int32_t *list = &suggestions[node * TRIE_SUGGESTION_COUNT];
+    for (int i = 0; i < nodes[node].suggestionCount; i++)
+        results.push_back(words[list[i]]);
+    return results;
 }
 
+/**
+* Function of the Tree Class
+* Counts that the user has chosen a word, so it is suggested earlier
+* Count is appended to the counts file next to the Dictionary
+* @param[in] word variable chosen by the user
+*/
+void Trie::learn(const string &word) {
+    if (word.empty())
+        return;
+    const int id = insertWord(word);
+    counts[id]++;
+    rank(word, id);
+
+    std::ofstream out(countsPath, std::ios::app);
+    out << 1 << '\t' << word << '\n';
+}
 
-/*
-TODO
---Save Trie-Tree to file (if possible)
---load Trie-Tree from file (if possible)
+/**
+* Function of the Tree Class
+* Approximate memory used by nodes, cached suggestions and words
 */
+size_t Trie::memoryUsage() const {
+    size_t size = nodes.capacity() * sizeof(Node)
+        + suggestions.capacity() * sizeof(int32_t)
+        + counts.capacity() * sizeof(uint32_t)
+        + words.capacity() * sizeof(string);
+    for (const string &word : words)
+        size += word.capacity();
+    return size;
+}
 
 /**
 * Function of the Tree Class
 * Load Dictionary from File
+* Lines are expected to be ordered by frequency
 * @param[in] dict variable is the Dictionary-Path
 */
 void Trie::loadDict(std::string dict) {
-    Trie * trie = this;
+    auto start = std::chrono::steady_clock::now();
+    *this = Trie();
 
     std::ifstream inf;
     std::string word;
 
     std::cout << "Keyboard: Opening Dictionary: " << dict << std::endl;
-    //inf.open("dict.txt");
     inf.open(dict);
 
     if (!inf.is_open() || inf.fail())
         cout << "Error opening Dictionary file - quit\n";
     while (getline(inf, word)) {
-        trie->insert(word);
+        if (!word.empty() && word.back() == '\r')
+            word.pop_back();
+        if (!word.empty())
+            insert(word);
         if (inf.bad())
             perror("error while reading file");
     }
-    inf.clear(); // clear eof and fail bits
-    inf.seekg(0, ios::beg);
     inf.close();
+
+    countsPath = dict + ".counts";
+    loadCounts();
+
+    std::cout << "Keyboard: Dictionary has " << words.size() << " words in " << nodes.size() << " nodes, "
+        << memoryUsage() / 1024 << " KB, loaded in "
+        << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms" << std::endl;
 }
 
 /**
 * Function of the Tree Class
-* Load Dictionary from File
+* Load counts of words chosen by user in earlier sessions
+* File has lines of count and word separated by tab, it is rewritten with one line per word when words occur more than once
+*/
+void Trie::loadCounts() {
+    std::ifstream in(countsPath);
+    if (!in.is_open())
+        return;
+
+    // Sum up appended counts
+    map<string, uint32_t> learned;
+    size_t lines = 0;
+    string line;
+    while (getline(in, line)) {
+        const size_t tab = line.find('\t');
+        if (tab == string::npos)
+            continue;
+        learned[line.substr(tab + 1)] += (uint32_t)strtoul(line.c_str(), NULL, 10);
+        lines++;
+    }
+    in.close();
+
+    // Apply counts, words learned by user are added
+    for (const auto &entry : learned) {
+        const int id = insertWord(entry.first);
+        counts[id] += entry.second;
+        rank(entry.first, id);
+    }
+
+    // Compact file
+    if (lines > learned.size()) {
+        std::ofstream out(countsPath, std::ios::trunc);
+        for (const auto &entry : learned)
+            out << entry.second << '\t' << entry.first << '\n';
+    }
+}
+
+/**
+* Function of the Tree Class
+* Add line to Dictionary file and to the Trie-Tree
 * @param[in] dict variable is the Dictionary-Path
 * @param[in] line variable is the String added to the Dictionary
 */
 void Trie::addLinetoDict(std::string dict, std::string line) {
     std::ofstream out(dict, std::ios::app);
     out << line + "\n";
+    insert(line);
 }
 
 /**
@@ -185,4 +341,17 @@ void Trie::deleteLineinDict(std::string dict, std::string line) {
 
     remove(c);
     rename("temp.txt", c);
+
+    // Forget what user has learned about the word
+    ifstream countsIn(dict + ".counts");
+    vector<string> lines;
+    while (getline(countsIn, word)) {
+        const size_t tab = word.find('\t');
+        if (tab == string::npos || word.substr(tab + 1) != line)
+            lines.push_back(word);
+    }
+    countsIn.close();
+    ofstream countsOut(dict + ".counts", std::ios::trunc);
+    for (const string &rest : lines)
+        countsOut << rest << '\n';
 }
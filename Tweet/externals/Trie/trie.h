@@ -4,29 +4,54 @@
 * Author : Vivek Narayanan
 
 Modified for "GazeTheWeb - Tweet" application (01/01/2016)
+Nodes are kept in one array and every node caches its best ranked words,
+so completion does not have to walk the subtree below the prefix.
 */
 
-#include <map>
+#pragma once
+
+#include <cstdint>
 #include <vector>
 #include <string>
-#include <sstream>
-#include <set>
 
 using namespace std;
 
+/** Maximal count of words cached per node and returned by autocomplete */
+static const int TRIE_SUGGESTION_COUNT = 12;
+
 class Trie {
 public:
-    map<char, Trie> children;
-    string value;
-    bool flag;
-
-    Trie(const string &);
-    void add(char);
+    Trie();
     string find(const string &);
     void insert(const string &);
-    vector<string> all_prefixes();
     vector<string> autocomplete(const string &);
+    void learn(const string &);
     void loadDict(std::string);
     void addLinetoDict(std::string, std::string);
     void deleteLineinDict(std::string, std::string);
+    size_t memoryUsage() const;
+
+private:
+    /** Node with children as sorted sibling list, indices point into nodes */
+    struct Node {
+        int32_t firstChild = -1;
+        int32_t nextSibling = -1;
+        int32_t word = -1;
+        uint8_t suggestionCount = 0;
+        char c = 0;
+    };
+
+    int findNode(const string &) const;
+    int findChild(int, char) const;
+    int childOf(int, char);
+    int insertWord(const string &);
+    bool ranksHigher(int, int) const;
+    void rank(const string &, int);
+    void loadCounts();
+
+    vector<Node> nodes;
+    vector<int32_t> suggestions; // TRIE_SUGGESTION_COUNT word ids per node, best first
+    vector<string> words; // in order of dictionary, which is by frequency
+    vector<uint32_t> counts; // how often user chose word
+    string countsPath;
 };
@@ -67,6 +67,33 @@ namespace eyegui
 	//! Enumeration of available description visibility behaviors.
 	enum class DescriptionVisibility { HIDDEN, ON_PENETRATION, VISIBLE };
 
+    //! Handle of element in layout
+    /*!
+      Resolved once from id and then used instead of it, so no lookup by string
+      is done per call. Handle stays valid while layout is resized and is
+      resolved again internally when elements of layout are replaced. Only use
+      it with layout it was fetched from.
+    */
+    class ElementHandle
+    {
+    public:
+
+        //! Check whether handle has been resolved.
+        /*!
+          \return true if handle has been fetched for existing element.
+        */
+        bool isValid() const { return mIndex >= 0; }
+
+    protected:
+
+        // Index in handle table of layout
+        friend class Layout;
+        int mIndex = -1;
+    };
+
+    //! Handle of text block in layout
+    class TextBlockHandle : public ElementHandle {};
+
     //! Abstract listener class for buttons.
     class ButtonListener
     {
@@ -83,21 +110,42 @@ namespace eyegui
           \param pLayout pointer to layout from which callback is coming.
           \param id is the unique id of the button which causes the callback.
         */
-        void virtual hit(Layout* pLayout, std::string id) = 0;
+        void virtual hit(Layout* pLayout, std::string id);
 
         //! Callback for pushing button down.
         /*!
           \param pLayout pointer to layout from which callback is coming.
           \param id is the unique id of the button which causes the callback.
         */
-        void virtual down(Layout* pLayout, std::string id) = 0;
+        void virtual down(Layout* pLayout, std::string id);
 
         //! Callback for pulling button up.
         /*!
           \param pLayout pointer to layout from which callback is coming.
           \param id is the unique id of the button which causes the callback.
         */
-        void virtual up(Layout* pLayout, std::string id) = 0;
+        void virtual up(Layout* pLayout, std::string id);
+
+        //! Callback for hitting of button, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the button which causes the callback.
+        */
+        void virtual hit(Layout* pLayout, ElementHandle handle);
+
+        //! Callback for pushing button down, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the button which causes the callback.
+        */
+        void virtual down(Layout* pLayout, ElementHandle handle);
+
+        //! Callback for pulling button up, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the button which causes the callback.
+        */
+        void virtual up(Layout* pLayout, ElementHandle handle);
     };
 
     //! Abstract listener class for sensors.
@@ -117,7 +165,15 @@ namespace eyegui
           \param id is the unique id of the sensor which causes the callback.
           \param amount is the value of penetration at time of callback.
         */
-        void virtual penetrated(Layout* pLayout, std::string id, float amount) = 0;
+        void virtual penetrated(Layout* pLayout, std::string id, float amount);
+
+        //! Callback for penetration of sensor, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the sensor which causes the callback.
+          \param amount is the value of penetration at time of callback.
+        */
+        void virtual penetrated(Layout* pLayout, ElementHandle handle, float amount);
     };
 
     //! Abstract listener class for keyboards.
@@ -137,7 +193,7 @@ namespace eyegui
           \param id is the unique id of the keyboard which causes the callback.
           \param value is the u16string given by pressed key.
         */
-        void virtual keyPressed(Layout* pLayout, std::string id, std::u16string value) = 0;
+        void virtual keyPressed(Layout* pLayout, std::string id, std::u16string value);
 
         //! Callback for pressing keys of keyboard.
         /*!
@@ -145,7 +201,23 @@ namespace eyegui
           \param id is the unique id of the keyboard which causes the callback.
           \param value is the string given by pressed key.
         */
-        void virtual keyPressed(Layout* pLayout, std::string id, std::string value) = 0;
+        void virtual keyPressed(Layout* pLayout, std::string id, std::string value);
+
+        //! Callback for pressing keys of keyboard, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the keyboard which causes the callback.
+          \param rValue is the u16string given by pressed key.
+        */
+        void virtual keyPressed(Layout* pLayout, ElementHandle handle, const std::u16string& rValue);
+
+        //! Callback for pressing keys of keyboard, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+          \param pLayout pointer to layout from which callback is coming.
+          \param handle is the handle of the keyboard which causes the callback.
+          \param rValue is the string given by pressed key.
+        */
+        void virtual keyPressed(Layout* pLayout, ElementHandle handle, const std::string& rValue);
     };
 
     //! Abstract listener class for word suggest.
@@ -165,7 +237,7 @@ namespace eyegui
         \param id is the unique id of the word suggest which causes the callback.
         \param value is the u16string of the suggestion.
         */
-        void virtual chosen(Layout* pLayout, std::string id, std::u16string value) = 0;
+        void virtual chosen(Layout* pLayout, std::string id, std::u16string value);
 
         //! Callback for choosing suggested word.
         /*!
@@ -173,7 +245,23 @@ namespace eyegui
         \param id is the unique id of the word suggest which causes the callback.
         \param value is the string of the suggestion.
         */
-        void virtual chosen(Layout* pLayout, std::string id, std::string value) = 0;
+        void virtual chosen(Layout* pLayout, std::string id, std::string value);
+
+        //! Callback for choosing suggested word, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+        \param pLayout pointer to layout from which callback is coming.
+        \param handle is the handle of the word suggest which causes the callback.
+        \param rValue is the u16string of the suggestion.
+        */
+        void virtual chosen(Layout* pLayout, ElementHandle handle, const std::u16string& rValue);
+
+        //! Callback for choosing suggested word, which is called by eyeGUI. Calls id based callback if not overridden.
+        /*!
+        \param pLayout pointer to layout from which callback is coming.
+        \param handle is the handle of the word suggest which causes the callback.
+        \param rValue is the string of the suggestion.
+        */
+        void virtual chosen(Layout* pLayout, ElementHandle handle, const std::string& rValue);
     };
 
     //! Struct for relative values of position and size
@@ -394,6 +482,43 @@ namespace eyegui
         bool active,
         bool fade = false);
 
+    //! Fetch handle of element.
+    /*!
+      \param pLayout pointer to layout.
+      \param id is the unique id of an element.
+      \return handle of element. Invalid if element does not exist.
+    */
+    ElementHandle fetchElementHandle(Layout* pLayout, std::string id);
+
+    //! Get id of element behind handle.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle is the handle of an element.
+      \return id of element, empty for invalid handle. Reference stays valid as long as layout exists.
+    */
+    std::string const & getElementId(Layout const * pLayout, ElementHandle handle);
+
+    //! Activity of element via handle.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle of element.
+      \param active indicates the state of acitvity.
+      \param fade indicates, whether activity should fade.
+    */
+    void setElementActivity(
+        Layout* pLayout,
+        ElementHandle handle,
+        bool active,
+        bool fade = false);
+
+    //! Get activity of element via handle.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle of element.
+      \return true if element of handle is active and false else
+    */
+    bool isElementActive(Layout const * pLayout, ElementHandle handle);
+
     //! Toggle activity of element.
     /*!
       \param pLayout pointer to layout.
@@ -448,6 +573,17 @@ namespace eyegui
         std::string id,
         std::string style);
 
+    //! Set style of element via handle. Does nothing if style is unchanged.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle of element.
+      \param stlye is name of style in stylesheet of layout.
+    */
+    void setStyleOfElement(
+        Layout* pLayout,
+        ElementHandle handle,
+        std::string style);
+
     //! Get whether element is dimming.
     /*!
       \param pLayout pointer to layout.
@@ -659,6 +795,30 @@ namespace eyegui
     */
     void setContentOfTextBlock(Layout* pLayout, std::string id, std::string content);
 
+    //! Fetch handle of text block.
+    /*!
+      \param pLayout pointer to layout.
+      \param id is the unique id of a text block.
+      \return handle of text block. Invalid if no text block with id exists.
+    */
+    TextBlockHandle fetchTextBlockHandle(Layout* pLayout, std::string id);
+
+    //! Set content of text block via handle. Does nothing if content is unchanged.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle of text block.
+      \param content is new content for text block as UTF-16 string.
+    */
+    void setContentOfTextBlock(Layout* pLayout, TextBlockHandle handle, std::u16string content);
+
+    //! Set content of text block via handle. Does nothing if content is unchanged.
+    /*!
+      \param pLayout pointer to layout.
+      \param handle of text block.
+      \param content is new content for text block as UTF-8 string.
+    */
+    void setContentOfTextBlock(Layout* pLayout, TextBlockHandle handle, std::string content);
+
     //! Set key of text block. Works only if used localization file includes key.
     /*!
       \param pLayout pointer to layout.
@@ -787,6 +947,26 @@ namespace eyegui
         std::string id,
         std::weak_ptr<ButtonListener> wpListener);
 
+    //! Register callbacks to button.
+    /*!
+      Callbacks are bound to the button and called directly, without
+      looking up or comparing its id. Use this instead of a listener which
+      has to find out which of its buttons is the cause of a callback.
+      Callbacks are kept by the button and replace the ones registered
+      before.
+      \param pLayout pointer to layout.
+      \param id is the unique id of an element.
+      \param hitCallback is called when button is hit.
+      \param downCallback is called when button is pushed down. May be empty.
+      \param upCallback is called when button is pulled up. May be empty.
+    */
+    void registerButtonCallbacks(
+        Layout* pLayout,
+        std::string id,
+        std::function<void()> hitCallback,
+        std::function<void()> downCallback = nullptr,
+        std::function<void()> upCallback = nullptr);
+
     //! Register listener to sensor.
     /*!
       \param pLayout pointer to layout.
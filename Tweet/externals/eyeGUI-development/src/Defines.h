@@ -41,6 +41,10 @@ namespace eyegui
     static const std::u16string LOCALIZATION_NOT_FOUND = u"";
     static const float KEY_CIRCLE_CHARACTER_SIZE_RATIO = 0.6f;
     static const float KEYBOARD_HORIZONTAL_KEY_DISTANCE = 0.15f;
+    static const float KEYBOARD_FOCUS_GRID_CELL_SIZE = 0.25f; // relative to key size
+    static const float KEYBOARD_FOCUS_RADIUS = 3.0f; // radius of gaze affected keys, relative to key size
+    static const float KEYBOARD_KEY_POSITION_DELTA_MULTIPLIER = 0.25f; // delta position multiplier of keys in focus
+    static const uint KEYBOARD_PRESSED_KEY_CAPACITY = 8; // count of pressed keys animated at once
     static const ImageAlignment STANDARD_IMAGE_ALIGNMENT = ImageAlignment::ZOOMED;
     static const std::u16string TEXT_FLOW_OVERFLOW_MARK = u"...";
     static const float KEY_FOCUS_DURATION = 0.3f;
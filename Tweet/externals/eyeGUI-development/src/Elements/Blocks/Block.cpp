@@ -73,9 +73,9 @@ namespace eyegui
         if (getStyle()->backgroundColor.a > 0)
         {
             mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", mAlpha);
+            mpBackground->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpBackground->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->backgroundColor);
+            mpBackground->getShader()->fillValue(Shader::Uniform::ALPHA, mAlpha);
             mpBackground->draw();
         }
 
@@ -81,12 +81,12 @@ namespace eyegui
         if (mSeparatorDrawMatrices.size() > 0 && getStyle()->separatorColor.a > 0)
         {
             mpSeparatorItem->bind();
-            mpSeparatorItem->getShader()->fillValue("color", getStyle()->separatorColor);
-            mpSeparatorItem->getShader()->fillValue("alpha", mAlpha);
+            mpSeparatorItem->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->separatorColor);
+            mpSeparatorItem->getShader()->fillValue(Shader::Uniform::ALPHA, mAlpha);
 
             for (uint i = 0; i < mSeparatorDrawMatrices.size(); i++)
             {
-                mpSeparatorItem->getShader()->fillValue("matrix", mSeparatorDrawMatrices[i]);
+                mpSeparatorItem->getShader()->fillValue(Shader::Uniform::MATRIX, mSeparatorDrawMatrices[i]);
                 mpSeparatorItem->draw();
             }
         }
@@ -503,11 +503,11 @@ namespace eyegui
             if(mMark.getValue() > 0)
             {
                 mpMarkItem->bind();
-                mpMarkItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpMarkItem->getShader()->fillValue("markColor", getStyle()->markColor);
-                mpMarkItem->getShader()->fillValue("mark", mMark.getValue());
-                mpMarkItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MARK_COLOR, getStyle()->markColor);
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MARK, mMark.getValue());
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
                 mpMarkItem->draw();
             }
 
@@ -515,10 +515,10 @@ namespace eyegui
             if(mActivity.getValue() < 1)
             {
                 mpActivityItem->bind();
-                mpActivityItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpActivityItem->getShader()->fillValue("activity", mActivity.getValue());
-                mpActivityItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
+                mpActivityItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+                mpActivityItem->getShader()->fillValue(Shader::Uniform::ACTIVITY, mActivity.getValue());
+                mpActivityItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
                 mpActivityItem->draw();
             }
 
@@ -526,11 +526,11 @@ namespace eyegui
             if(mDim.getValue() > 0)
             {
                 mpDimItem->bind();
-                mpDimItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-                mpDimItem->getShader()->fillValue("dimColor", getStyle()->dimColor);
-                mpDimItem->getShader()->fillValue("dim", mDim.getValue());
-                mpDimItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-                mpMarkItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
+                mpDimItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+                mpDimItem->getShader()->fillValue(Shader::Uniform::DIM_COLOR, getStyle()->dimColor);
+                mpDimItem->getShader()->fillValue(Shader::Uniform::DIM, mDim.getValue());
+                mpDimItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+                mpMarkItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
                 mpDimItem->draw();
             }
 
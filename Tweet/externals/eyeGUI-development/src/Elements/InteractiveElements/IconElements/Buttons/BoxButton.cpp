@@ -60,14 +60,14 @@ namespace eyegui
     {
         mpIcon->bind(1);
         mpBoxButtonItem->bind();
-        mpBoxButtonItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpBoxButtonItem->getShader()->fillValue("color", getStyle()->color);
-        mpBoxButtonItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpBoxButtonItem->getShader()->fillValue("pressing", getPressing());
-        mpBoxButtonItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpBoxButtonItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpBoxButtonItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpBoxButtonItem->getShader()->fillValue("icon", 1);
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->color);
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::ICON_COLOR, getStyle()->iconColor);
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::PRESSING, getPressing());
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::ICON_UV_SCALE, iconAspectRatioCorrection());
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
+        mpBoxButtonItem->getShader()->fillValue(Shader::Uniform::ICON, 1);
         mpBoxButtonItem->draw();
 
         // Super call (draw highlight etc. on top)
@@ -11,6 +11,7 @@
 #include "NotificationQueue.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/Helper.h"
+#include "src/Listener/ButtonCallbackListener.h"
 
 namespace eyegui
 {
@@ -80,7 +81,7 @@ namespace eyegui
         if (isActive())
         {
             // Inform listener after updating
-            mpNotificationQueue->enqueue(getId(), NotificationType::BUTTON_HIT);
+            mpNotificationQueue->enqueue(this, NotificationType::BUTTON_HIT);
 
             // Call context correct method
             if (mIsDown)
@@ -105,7 +106,7 @@ namespace eyegui
             mIsDown = true;
 
             // Inform listener after updating
-            mpNotificationQueue->enqueue(getId(), NotificationType::BUTTON_DOWN);
+            mpNotificationQueue->enqueue(this, NotificationType::BUTTON_DOWN);
 
             // Immediately
             if (immediately)
@@ -126,7 +127,7 @@ namespace eyegui
             mIsDown = false;
 
             // Inform listener after updating
-            mpNotificationQueue->enqueue(getId(), NotificationType::BUTTON_UP);
+            mpNotificationQueue->enqueue(this, NotificationType::BUTTON_UP);
 
             // Immediately
             if (immediately)
@@ -146,6 +147,16 @@ namespace eyegui
         return mIsDown;
     }
 
+    void Button::registerCallbacks(
+        std::function<void()> hitCallback,
+        std::function<void()> downCallback,
+        std::function<void()> upCallback)
+    {
+        // Former listener expires and is removed at next notification
+        mspCallbackListener = std::make_shared<ButtonCallbackListener>(hitCallback, downCallback, upCallback);
+        registerListener(mspCallbackListener);
+    }
+
     float Button::specialUpdate(float tpf, Input* pInput)
     {
         // Super call
@@ -199,10 +210,10 @@ namespace eyegui
         if(mThreshold.getValue() > 0)
         {
             mpThresholdItem->bind();
-            mpThresholdItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-            mpThresholdItem->getShader()->fillValue("threshold", mThreshold.getValue());
-            mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
+            mpThresholdItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD_COLOR, getStyle()->thresholdColor);
+            mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD, mThreshold.getValue());
+            mpThresholdItem->getShader()->fillValue(Shader::Uniform::ALPHA, mAlpha);
             if(!mUseCircleThreshold)
             {
                 float orientation = 0;
@@ -213,9 +224,9 @@ namespace eyegui
                         orientation = 1;
                     }
                 }
-                mpThresholdItem->getShader()->fillValue("orientation", orientation);
+                mpThresholdItem->getShader()->fillValue(Shader::Uniform::ORIENTATION, orientation);
             }
-            mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+            mpThresholdItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // mask is always in slot 0
             mpThresholdItem->draw();
         }
 
@@ -247,13 +258,13 @@ namespace eyegui
         switch (notification)
         {
         case NotificationType::BUTTON_HIT:
-            notifyListener(&ButtonListener::hit, pLayout, getId());
+            notifyListener(&ButtonListener::hit, pLayout, mNotificationHandle);
             break;
         case NotificationType::BUTTON_DOWN:
-            notifyListener(&ButtonListener::down, pLayout, getId());
+            notifyListener(&ButtonListener::down, pLayout, mNotificationHandle);
             break;
         case NotificationType::BUTTON_UP:
-            notifyListener(&ButtonListener::up, pLayout, getId());
+            notifyListener(&ButtonListener::up, pLayout, mNotificationHandle);
             break;
         default:
             throwWarning(
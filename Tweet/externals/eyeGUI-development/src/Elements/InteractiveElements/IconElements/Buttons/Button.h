@@ -53,6 +53,12 @@ namespace eyegui
         // Is button down?
         bool isDown() const;
 
+        // Register callbacks which are kept by button and called like a listener, replaces former ones
+        void registerCallbacks(
+            std::function<void()> hitCallback,
+            std::function<void()> downCallback,
+            std::function<void()> upCallback);
+
     protected:
 
         // Updating filled by subclasses, returns adaptive scale
@@ -81,6 +87,7 @@ namespace eyegui
         bool mIsSwitch;
         LerpValue mThreshold; // [0..1]
         LerpValue mPressing; // [0..1]
+        std::shared_ptr<ButtonListener> mspCallbackListener; // listener template only keeps weak pointer
         RenderItem const * mpThresholdItem;
     };
 }
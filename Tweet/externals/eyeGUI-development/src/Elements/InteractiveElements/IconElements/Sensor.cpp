@@ -96,7 +96,7 @@ namespace eyegui
         // Inform listener after updating when penetrated
         if (mPenetration.getValue() > 0)
         {
-            mpNotificationQueue->enqueue(getId(), NotificationType::SENSOR_PENETRATED);
+            mpNotificationQueue->enqueue(this, NotificationType::SENSOR_PENETRATED);
         }
 
         return adaptiveScale;
@@ -106,14 +106,14 @@ namespace eyegui
     {
         mpIcon->bind(1);
         mpSensorItem->bind();
-        mpSensorItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-        mpSensorItem->getShader()->fillValue("color", getStyle()->color);
-        mpSensorItem->getShader()->fillValue("iconColor", getStyle()->iconColor);
-        mpSensorItem->getShader()->fillValue("penetration", mPenetration.getValue());
-        mpSensorItem->getShader()->fillValue("iconUVScale", iconAspectRatioCorrection());
-        mpSensorItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-        mpSensorItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
-        mpSensorItem->getShader()->fillValue("icon", 1);
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->color);
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::ICON_COLOR, getStyle()->iconColor);
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::PENETRATION, mPenetration.getValue());
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::ICON_UV_SCALE, iconAspectRatioCorrection());
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
+        mpSensorItem->getShader()->fillValue(Shader::Uniform::ICON, 1);
         mpSensorItem->draw();
 
         // Super call
@@ -139,7 +139,7 @@ namespace eyegui
         switch (notification)
         {
         case NotificationType::SENSOR_PENETRATED:
-            notifyListener(&SensorListener::penetrated, pLayout, getId(), mPenetration.getValue());
+            notifyListener(&SensorListener::penetrated, pLayout, mNotificationHandle, mPenetration.getValue());
             break;
         default:
             throwWarning(
@@ -92,12 +92,12 @@ namespace eyegui
         if(mHighlight.getValue() > 0)
         {
             mpHighlightItem->bind();
-            mpHighlightItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpHighlightItem->getShader()->fillValue("highlightColor", getStyle()->highlightColor);
-            mpHighlightItem->getShader()->fillValue("highlight", mHighlight.getValue());
-            mpHighlightItem->getShader()->fillValue("time", mpLayout->getAccPeriodicTime());
-            mpHighlightItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpHighlightItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::HIGHLIGHT_COLOR, getStyle()->highlightColor);
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::HIGHLIGHT, mHighlight.getValue());
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::TIME, mpLayout->getAccPeriodicTime());
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+            mpHighlightItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
             mpHighlightItem->draw();
         }
 
@@ -105,11 +105,11 @@ namespace eyegui
         if(mSelection.getValue() > 0)
         {
             mpSelectionItem->bind();
-            mpSelectionItem->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpSelectionItem->getShader()->fillValue("selectionColor", getStyle()->selectionColor);
-            mpSelectionItem->getShader()->fillValue("selection", mSelection.getValue());
-            mpSelectionItem->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
-            mpSelectionItem->getShader()->fillValue("mask", 0); // Mask is always in slot 0
+            mpSelectionItem->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpSelectionItem->getShader()->fillValue(Shader::Uniform::SELECTION_COLOR, getStyle()->selectionColor);
+            mpSelectionItem->getShader()->fillValue(Shader::Uniform::SELECTION, mSelection.getValue());
+            mpSelectionItem->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
+            mpSelectionItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // Mask is always in slot 0
             mpSelectionItem->draw();
         }
     }
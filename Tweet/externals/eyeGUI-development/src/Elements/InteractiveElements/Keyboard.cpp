@@ -63,6 +63,9 @@ namespace eyegui
 
         // Create keymaps (mKeymaps)
         initKeymaps(mpLayout->getCharacterSet());
+
+        // Pool of pressed keys, no allocation while typing
+        mPressedKeys.resize(KEYBOARD_PRESSED_KEY_CAPACITY, PressedKey{ 0.f, NULL });
     }
 
     Keyboard::~Keyboard()
@@ -151,8 +154,6 @@ namespace eyegui
         float PRESSED_KEY_SCALING_MULTIPLIER = 5.f; // Just animation scale of pressed key which is moving and fading towards user
         float THRESHOLD_DECREASE_AFTER_PRESS_DURATION = 0.2f; // Decrease of threshold after pressing
         float THRESHOLD_DECREASE_DURATION = 1.f; // General decrease duration of threshold if no gaze is upon element
-        float FOCUS_RADIUS = 3.0f; // Radius of gaze affected keys (in the center bigger, else smaller)
-        float KEY_POSITION_DELTA_MULTIPLIER = 0.25f; // Delta position multiplier of keys in focus
         float KEY_SIZE_DELTA_MULTIPLIER = 0.5f; // Delta size multiplier of keys in focus
         float MINIMAL_KEY_SIZE = 0.75f; // Cap minimal key size for those in focus area
 
@@ -188,25 +189,18 @@ namespace eyegui
         }
 
         // *** UPDATE ANIMATED PRESSED KEYES ***
-        std::vector<int> dyingPressedKeys;
-        for (uint i = 0; i < mPressedKeys.size(); i++)
+        for (auto& rPressedKey : mPressedKeys)
         {
-            // Update alpha and size
-            mPressedKeys[i].first -= tpf / INTERACTION_FADING_DURATION;
-            Key* pKey = mPressedKeys[i].second.get();
-            pKey->transformAndSize((int)pKey->getPosition().x, (int)pKey->getPosition().y, (int)(pKey->getSize() + PRESSED_KEY_SCALING_MULTIPLIER * tpf * initialKeySize));
-
-            // Check, whether still visible
-            if (mPressedKeys[i].first <= 0)
+            // Skip free slots
+            if (rPressedKey.alpha <= 0)
             {
-                dyingPressedKeys.push_back(i);
+                continue;
             }
-        }
 
-        // Delete dying pressed keys (go backwards through it)
-        for (int i = (int)dyingPressedKeys.size()-1; i >= 0; i--)
-        {
-            mPressedKeys.erase(mPressedKeys.begin() + i);
+            // Update alpha and size. Slot is free again when alpha reaches zero
+            rPressedKey.alpha = std::max(0.f, rPressedKey.alpha - tpf / INTERACTION_FADING_DURATION);
+            Key* pKey = rPressedKey.pKey;
+            pKey->transformAndSize((int)pKey->getPosition().x, (int)pKey->getPosition().y, (int)(pKey->getSize() + PRESSED_KEY_SCALING_MULTIPLIER * tpf * initialKeySize));
         }
 
         // *** FILTER USER'S GAZE ***
@@ -249,27 +243,13 @@ namespace eyegui
         // *** DETERMINE FOCUSED KEY ***
         if(penetrated)
         {
-            // Go over keys and search nearest
-            float minDistance = 1000000;
+            // Search nearest key
             int newFocusedKeyRow = -1;
             int newFocusedKeyColumn = -1;
-            for(uint i = 0; i < pKeys->size(); i++)
-            {
-                for(uint j = 0; j < (*pKeys)[i].size(); j++)
-                {
-                    // Use position in keys to get position after last update
-                    float currentDistance = glm::abs(glm::distance(mGazePosition, (*pKeys)[i][j]->getPosition()));
-                    if(currentDistance < minDistance)
-                    {
-                        minDistance = currentDistance;
-                        newFocusedKeyRow = i;
-                        newFocusedKeyColumn = j;
-                    }
-                }
-            }
+            findNearestKey(mKeymaps[mCurrentKeymapIndex], *pKeys, mGazePosition, newFocusedKeyRow, newFocusedKeyColumn);
 
             // Set focus if necessary
-            if(newFocusedKeyRow != mFocusedKeyRow || newFocusedKeyColumn != mFocusedKeyColumn)
+            if(newFocusedKeyRow >= 0 && (newFocusedKeyRow != mFocusedKeyRow || newFocusedKeyColumn != mFocusedKeyColumn))
             {
                 // Unset old focus
                 if(mFocusedKeyRow >= 0 && mFocusedKeyColumn >= 0)
@@ -319,12 +299,12 @@ namespace eyegui
                 glm::vec2 positionDelta = (*pInitialKeyPositions)[i][j] - mGazePosition;
 
                 // Radius of focus
-                float focusWeight = 1.f - glm::length(positionDelta) / (FOCUS_RADIUS * initialKeySize); // Key size used for normalization
+                float focusWeight = 1.f - glm::length(positionDelta) / (KEYBOARD_FOCUS_RADIUS * initialKeySize); // Key size used for normalization
                 focusWeight = clamp(focusWeight, 0, 1);
 
                 // Only near keys have to be moved
                 positionDelta *= focusWeight;
-                positionDelta *= KEY_POSITION_DELTA_MULTIPLIER;
+                positionDelta *= KEYBOARD_KEY_POSITION_DELTA_MULTIPLIER;
 
                 // Calculate delta of size
                 float sizeDelta = initialKeySize - glm::length((*pKeys)[i][j]->getPosition() - mGazePosition);
@@ -377,9 +357,9 @@ namespace eyegui
         {
             // Bind, fill and draw background
             mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
+            mpBackground->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpBackground->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->backgroundColor);
+            mpBackground->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
             mpBackground->draw();
         }
 
@@ -417,13 +397,16 @@ namespace eyegui
         // Draw animation of pressed keys
         for (const auto& rPressedKey : mPressedKeys)
         {
-            rPressedKey.second->draw(
-                getStyle()->color,
-                getStyle()->pickColor,
-                getStyle()->iconColor,
-                getStyle()->thresholdColor,
-                0,
-                getMultipliedDimmedAlpha() * rPressedKey.first);
+            if (rPressedKey.alpha > 0)
+            {
+                rPressedKey.pKey->draw(
+                    getStyle()->color,
+                    getStyle()->pickColor,
+                    getStyle()->iconColor,
+                    getStyle()->thresholdColor,
+                    0,
+                    getMultipliedDimmedAlpha() * rPressedKey.alpha);
+            }
         }
 
         popScissor();
@@ -495,6 +478,9 @@ namespace eyegui
                     rKeymap.bigKeys[i][j]->transformAndSize(pos.x, pos.y, (int)(rKeymap.initialKeySize));
                 }
             }
+
+            // Lookup of focused key depends on initial key positions
+            buildFocusGrid(rKeymap);
         }
     }
 
@@ -505,7 +491,10 @@ namespace eyegui
 
         mFocusPosition = glm::vec2(0,0);
         mGazePosition = glm::vec2(0,0);
-        mPressedKeys.clear();
+        for (auto& rPressedKey : mPressedKeys)
+        {
+            rPressedKey.alpha = 0;
+        }
 
         resetKeymapsAndState();
 
@@ -538,14 +527,14 @@ namespace eyegui
         case NotificationType::KEYBOARD_KEY_PRESSED:
         {
             // Notify listener method with UTF-16 string
-            notifyListener(&KeyboardListener::keyPressed, pLayout, getId(), mLastPressedKeyValue);
+            notifyListener(&KeyboardListener::keyPressed, pLayout, mNotificationHandle, mLastPressedKeyValue);
 
             // Convert last pressed value to UTF-8 string
             std::string lastPressedKeyValue8;
             convertUTF16ToUTF8(mLastPressedKeyValue, lastPressedKeyValue8);
 
             // Notify listener method with UTF-8 string
-            notifyListener(&KeyboardListener::keyPressed, pLayout, getId(), lastPressedKeyValue8);
+            notifyListener(&KeyboardListener::keyPressed, pLayout, mNotificationHandle, lastPressedKeyValue8);
             break;
         }
         default:
@@ -624,6 +613,12 @@ namespace eyegui
             throwError(OperationNotifier::Operation::BUG, "Tried to initialize keyboard of unkown character set");
         }
 
+        // Create copies for animation of pressed keys
+        for (Keymap& rKeymap : mKeymaps)
+        {
+            initPressedKeys(rKeymap);
+        }
+
         // Transform and size has to be called to set initial key size (depending on size of element)
     }
 
@@ -656,6 +651,116 @@ namespace eyegui
         rInitialPositions.push_back(std::vector<glm::vec2>());
     }
 
+    void Keyboard::initPressedKeys(Keymap& rKeymap) const
+    {
+        // Copies are created once, so pressing a key does not allocate anything
+        for (uint i = 0; i < rKeymap.smallKeys.size(); i++)
+        {
+            rKeymap.smallPressedKeys.push_back(std::vector<std::unique_ptr<Key> >());
+            rKeymap.bigPressedKeys.push_back(std::vector<std::unique_ptr<Key> >());
+            for (uint j = 0; j < rKeymap.smallKeys[i].size(); j++)
+            {
+                rKeymap.smallPressedKeys[i].push_back(std::unique_ptr<Key>(new CharacterKey(*(CharacterKey*)(rKeymap.smallKeys[i][j].get()))));
+                rKeymap.bigPressedKeys[i].push_back(std::unique_ptr<Key>(new CharacterKey(*(CharacterKey*)(rKeymap.bigKeys[i][j].get()))));
+            }
+        }
+    }
+
+    void Keyboard::buildFocusGrid(Keymap& rKeymap) const
+    {
+        rKeymap.focusGridCellSize = std::max(1, (int)(rKeymap.initialKeySize * KEYBOARD_FOCUS_GRID_CELL_SIZE));
+        rKeymap.focusGridColumns = std::max(1, (mWidth + rKeymap.focusGridCellSize - 1) / rKeymap.focusGridCellSize);
+        rKeymap.focusGridRows = std::max(1, (mHeight + rKeymap.focusGridCellSize - 1) / rKeymap.focusGridCellSize);
+        rKeymap.focusGridKeys.clear();
+        rKeymap.focusGridOffsets.clear();
+
+        // Keys are moved by at most focus radius times position delta multiplier / 4 key sizes from their initial
+        // position (maximum of r * (1 - r / radius) * multiplier), plus rounding to pixels
+        float maxKeyShift = KEYBOARD_FOCUS_RADIUS * KEYBOARD_KEY_POSITION_DELTA_MULTIPLIER * rKeymap.initialKeySize / 4.f + 1.5f;
+
+        // For a position in a cell, distances to current key positions differ from distances of
+        // cell center to initial key positions by at most half cell diagonal plus key shift.
+        // So key with larger distance than nearest one plus twice that slack can never be nearest
+        float slack = 2.f * (0.5f * glm::sqrt(2.f) * rKeymap.focusGridCellSize + maxKeyShift);
+
+        // Go over cells and collect candidates by initial position
+        for (int y = 0; y < rKeymap.focusGridRows; y++)
+        {
+            for (int x = 0; x < rKeymap.focusGridColumns; x++)
+            {
+                glm::vec2 cellCenter(
+                    mX + (x + 0.5f) * rKeymap.focusGridCellSize,
+                    mY + (y + 0.5f) * rKeymap.focusGridCellSize);
+
+                // Distance to nearest key
+                float minDistance = 1000000;
+                for (const auto& rPositions : rKeymap.initialKeyPositions)
+                {
+                    for (const auto& rPosition : rPositions)
+                    {
+                        minDistance = std::min(minDistance, glm::distance(cellCenter, rPosition));
+                    }
+                }
+
+                // All keys within slack of it
+                rKeymap.focusGridOffsets.push_back((int)rKeymap.focusGridKeys.size());
+                for (uint i = 0; i < rKeymap.initialKeyPositions.size(); i++)
+                {
+                    for (uint j = 0; j < rKeymap.initialKeyPositions[i].size(); j++)
+                    {
+                        if (glm::distance(cellCenter, rKeymap.initialKeyPositions[i][j]) <= minDistance + slack)
+                        {
+                            rKeymap.focusGridKeys.push_back(glm::ivec2(i, j));
+                        }
+                    }
+                }
+            }
+        }
+        rKeymap.focusGridOffsets.push_back((int)rKeymap.focusGridKeys.size());
+    }
+
+    void Keyboard::findNearestKey(const Keymap& rKeymap, const SubKeymap& rKeys, glm::vec2 position, int& rRow, int& rColumn) const
+    {
+        float minDistance = 1000000;
+
+        // Filtered gaze may lag outside of element (and grid is empty before transform and size), so check all keys
+        int x = (int)glm::floor((position.x - mX) / rKeymap.focusGridCellSize);
+        int y = (int)glm::floor((position.y - mY) / rKeymap.focusGridCellSize);
+        if (rKeymap.focusGridOffsets.empty()
+            || x < 0 || x >= rKeymap.focusGridColumns
+            || y < 0 || y >= rKeymap.focusGridRows)
+        {
+            for (uint i = 0; i < rKeys.size(); i++)
+            {
+                for (uint j = 0; j < rKeys[i].size(); j++)
+                {
+                    float currentDistance = glm::distance(position, rKeys[i][j]->getPosition());
+                    if (currentDistance < minDistance)
+                    {
+                        minDistance = currentDistance;
+                        rRow = i;
+                        rColumn = j;
+                    }
+                }
+            }
+            return;
+        }
+
+        // Check candidates of cell with their position after last update
+        int cell = y * rKeymap.focusGridColumns + x;
+        for (int k = rKeymap.focusGridOffsets[cell]; k < rKeymap.focusGridOffsets[cell + 1]; k++)
+        {
+            const glm::ivec2& rKey = rKeymap.focusGridKeys[k];
+            float currentDistance = glm::distance(position, rKeys[rKey.x][rKey.y]->getPosition());
+            if (currentDistance < minDistance)
+            {
+                minDistance = currentDistance;
+                rRow = rKey.x;
+                rColumn = rKey.y;
+            }
+        }
+    }
+
     void Keyboard::resetKeymapsAndState()
     {
         mThreshold.setValue(0);
@@ -720,11 +825,26 @@ namespace eyegui
         mKeyWasPressed = true;
 
         // Inform listener after updating
-        mpNotificationQueue->enqueue(getId(), NotificationType::KEYBOARD_KEY_PRESSED);
+        mpNotificationQueue->enqueue(this, NotificationType::KEYBOARD_KEY_PRESSED);
 
-        // Add pressed key for nice animation
-        std::unique_ptr<Key> upPressedKey = std::unique_ptr<Key>(new CharacterKey(*(CharacterKey*)((*pKeys)[i][j].get())));
-        upPressedKey->transformAndSize();
-        mPressedKeys.push_back(PressedKey(1.f, std::move(upPressedKey)));
+        // Add pressed key for nice animation. Take copy of keymap and slot of key pressed again or of most faded one
+        const Keymap& rKeymap = mKeymaps[mCurrentKeymapIndex];
+        Key* pPressedKey = (pKeys == &(rKeymap.bigKeys) ? rKeymap.bigPressedKeys : rKeymap.smallPressedKeys)[i][j].get();
+        PressedKey* pSlot = &(mPressedKeys[0]);
+        for (auto& rPressedKey : mPressedKeys)
+        {
+            if (rPressedKey.alpha > 0 && rPressedKey.pKey == pPressedKey)
+            {
+                pSlot = &rPressedKey;
+                break;
+            }
+            if (rPressedKey.alpha < pSlot->alpha)
+            {
+                pSlot = &rPressedKey;
+            }
+        }
+        pPressedKey->adoptState(*((*pKeys)[i][j]));
+        pSlot->alpha = 1.f;
+        pSlot->pKey = pPressedKey;
     }
 }
@@ -80,7 +80,6 @@ namespace eyegui
     private:
 
         // Typedefs
-        typedef std::pair<float, std::unique_ptr<Key> > PressedKey; // Alpha and copy of key
         typedef std::vector<std::vector<std::unique_ptr<Key> > > SubKeymap; // Sub keymap (only used to hold either small or big versions of characters
         typedef std::vector<std::vector<glm::vec2> > PositionMap; // Positions of keys in keymap
 
@@ -89,8 +88,22 @@ namespace eyegui
         {
             SubKeymap smallKeys;
             SubKeymap bigKeys;
+            SubKeymap smallPressedKeys; // copies of small keys used for animation of pressed keys
+            SubKeymap bigPressedKeys; // copies of big keys used for animation of pressed keys
             PositionMap initialKeyPositions;
             float initialKeySize;
+            std::vector<glm::ivec2> focusGridKeys; // row and column of candidates for nearest key, grouped by cell
+            std::vector<int> focusGridOffsets; // start of candidates of each cell in focusGridKeys, row major plus end
+            int focusGridColumns;
+            int focusGridRows;
+            int focusGridCellSize; // in pixels
+        };
+
+        // Struct for animation of pressed key
+        struct PressedKey
+        {
+            float alpha; // animation is over when zero
+            Key* pKey; // copy of key owned by keymap
         };
 
         // Struct for pairs of small and big characters used to initialize the keyboard
@@ -124,6 +137,17 @@ namespace eyegui
         // Add new line to sub keymaps
         void newLine(SubKeymap& rSmallKeys, SubKeymap& rBigKeys, PositionMap& rInitialPositions) const;
 
+        // Create copies of keys used for animation of pressed keys
+        void initPressedKeys(Keymap& rKeymap) const;
+
+        // Fill grid with candidates for nearest key of each cell. Candidates are all keys
+        // which may be nearest to any position in cell while keys are moved by gaze
+        void buildFocusGrid(Keymap& rKeymap) const;
+
+        // Find nearest key to position by checking candidates of its cell in focus grid.
+        // Result is the same as of checking all keys. Falls back to that outside of grid
+        void findNearestKey(const Keymap& rKeymap, const SubKeymap& rKeys, glm::vec2 position, int& rRow, int& rColumn) const;
+
         // Reset keymaps
         void resetKeymapsAndState();
 
@@ -139,7 +163,7 @@ namespace eyegui
         glm::vec2 mGazePosition;
         std::u16string mLastPressedKeyValue;
         bool mKeyWasPressed;
-        std::vector<PressedKey> mPressedKeys;  // Alpha [0..1] and copy of key
+        std::vector<PressedKey> mPressedKeys; // pool with fixed capacity, slots are reused
         bool mUseFastTyping;
         std::u16string mFastBuffer;
         std::vector<Keymap> mKeymaps;
@@ -222,9 +222,9 @@ namespace eyegui
         {
             // Bind, fill and draw background
             mpBackground->bind();
-            mpBackground->getShader()->fillValue("matrix", mFullDrawMatrix);
-            mpBackground->getShader()->fillValue("color", getStyle()->backgroundColor);
-            mpBackground->getShader()->fillValue("alpha", getMultipliedDimmedAlpha());
+            mpBackground->getShader()->fillValue(Shader::Uniform::MATRIX, mFullDrawMatrix);
+            mpBackground->getShader()->fillValue(Shader::Uniform::COLOR, getStyle()->backgroundColor);
+            mpBackground->getShader()->fillValue(Shader::Uniform::ALPHA, getMultipliedDimmedAlpha());
             mpBackground->draw();
         }
 
@@ -261,12 +261,12 @@ namespace eyegui
 
                     // Draw threshold
                     mpThresholdItem->bind();
-                    mpThresholdItem->getShader()->fillValue("matrix", matrix);
-                    mpThresholdItem->getShader()->fillValue("thresholdColor", getStyle()->thresholdColor);
-                    mpThresholdItem->getShader()->fillValue("threshold", threshold);
-                    mpThresholdItem->getShader()->fillValue("alpha", mAlpha);
-                    mpThresholdItem->getShader()->fillValue("orientation", 1.f); // vertical threshold
-                    mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::MATRIX, matrix);
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD_COLOR, getStyle()->thresholdColor);
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD, threshold);
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::ALPHA, mAlpha);
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::ORIENTATION, 1.f); // vertical threshold
+                    mpThresholdItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // mask is always in slot 0
                     mpThresholdItem->draw();
                 }
             }
@@ -329,14 +329,14 @@ namespace eyegui
         case NotificationType::WORD_SUGGEST_CHOSEN:
         {
             // Notify listener method with UTF-16 string
-            notifyListener(&WordSuggestListener::chosen, pLayout, getId(), mLastChosenSuggestion);
+            notifyListener(&WordSuggestListener::chosen, pLayout, mNotificationHandle, mLastChosenSuggestion);
 
             // Convert suggestion value to UTF-8 string
             std::string lastChosenSuggestionValue8;
             convertUTF16ToUTF8(mLastChosenSuggestion, lastChosenSuggestionValue8);
 
             // Notify listener method with UTF-8 string
-            notifyListener(&WordSuggestListener::chosen, pLayout, getId(), lastChosenSuggestionValue8);
+            notifyListener(&WordSuggestListener::chosen, pLayout, mNotificationHandle, lastChosenSuggestionValue8);
             break;
         }
         default:
@@ -415,7 +415,7 @@ namespace eyegui
         mLastChosenSuggestion = mSuggestions[index]->getContent();
 
         // Inform listener after updating
-        mpNotificationQueue->enqueue(getId(), NotificationType::WORD_SUGGEST_CHOSEN);
+        mpNotificationQueue->enqueue(this, NotificationType::WORD_SUGGEST_CHOSEN);
 
         // Add suggestions to chosen ones for animation
         std::unique_ptr<TextSimple> upChosenSuggestion = std::unique_ptr<TextSimple>(new TextSimple(*(mSuggestions[index].get())));
@@ -14,6 +14,7 @@
 
 #include "Element.h"
 #include "NotifierTemplate.h"
+#include "include/eyeGUI.h"
 
 namespace eyegui
 {
@@ -46,6 +47,10 @@ namespace eyegui
 
             // Filled by subclass and called by layout after updating
             virtual void specialPipeNotification(NotificationType notification, Layout* pLayout) = 0;
+
+            // Handle resolved by notification queue at first notification, passed to listeners
+            friend class NotificationQueue;
+            ElementHandle mNotificationHandle;
     };
 }
 
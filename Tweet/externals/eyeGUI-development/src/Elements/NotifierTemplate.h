@@ -8,7 +8,8 @@
 // elements are deriving from this and using their specific listener structures
 // as input for the template. Inside their "pipeNotification" method they call
 // the "notifyListener" method with the method of their listener structure
-// which should be called back for notification. Vector of weak pointers
+// which should be called back for notification. Listeners are called with
+// handle of element, so no id is copied per notification. Vector of weak pointers
 // to the listeners is handled here and dead weak pointer are deleted
 // automatically.
 
@@ -77,85 +78,108 @@ namespace eyegui
 
         // Notify listener about something (one need to know which method to call from listener)
         void notifyListener(
-            void (T::*method) (Layout*, std::string),
-            Layout* pLayout, std::string id)
+            void (T::*method) (Layout*, ElementHandle),
+            Layout* pLayout, ElementHandle handle)
         {
-            // Inform listener
-            for (std::shared_ptr<T>& spListener : getListener())
+            // Inform listener. Listeners may register further listeners meanwhile, so index is used
+            bool deadListener = false;
+            for (size_t i = 0; i < mListeners.size(); i++)
             {
-                (spListener.get()->*method)(pLayout, id);
+                if (auto spListener = mListeners[i].lock())
+                {
+                    (spListener.get()->*method)(pLayout, handle);
+                }
+                else
+                {
+                    deadListener = true;
+                }
             }
-        }
-
-        // Notify listener about something (one need to know which method to call from listener)
-        void notifyListener(
-            void (T::*method) (Layout*, std::string, float),
-            Layout* pLayout, std::string id, float value)
-        {
-            // Inform listener
-            for (std::shared_ptr<T>& spListener : getListener())
+            if (deadListener)
             {
-                (spListener.get()->*method)(pLayout, id, value);
+                removeDeadListeners();
             }
         }
 
         // Notify listener about something (one need to know which method to call from listener)
         void notifyListener(
-            void (T::*method) (Layout*, std::string, std::u16string),
-            Layout* pLayout, std::string id, std::u16string value)
+            void (T::*method) (Layout*, ElementHandle, float),
+            Layout* pLayout, ElementHandle handle, float value)
         {
-            // Inform listener
-            for (std::shared_ptr<T>& spListener : getListener())
+            // Inform listener. Listeners may register further listeners meanwhile, so index is used
+            bool deadListener = false;
+            for (size_t i = 0; i < mListeners.size(); i++)
             {
-                (spListener.get()->*method)(pLayout, id, value);
+                if (auto spListener = mListeners[i].lock())
+                {
+                    (spListener.get()->*method)(pLayout, handle, value);
+                }
+                else
+                {
+                    deadListener = true;
+                }
+            }
+            if (deadListener)
+            {
+                removeDeadListeners();
             }
         }
 
         // Notify listener about something (one need to know which method to call from listener)
         void notifyListener(
-            void (T::*method) (Layout*, std::string, std::string),
-            Layout* pLayout, std::string id, std::string value)
+            void (T::*method) (Layout*, ElementHandle, const std::u16string&),
+            Layout* pLayout, ElementHandle handle, const std::u16string& rValue)
         {
-            // Inform listener
-            for (std::shared_ptr<T>& spListener : getListener())
+            // Inform listener. Listeners may register further listeners meanwhile, so index is used
+            bool deadListener = false;
+            for (size_t i = 0; i < mListeners.size(); i++)
             {
-                (spListener.get()->*method)(pLayout, id, value);
+                if (auto spListener = mListeners[i].lock())
+                {
+                    (spListener.get()->*method)(pLayout, handle, rValue);
+                }
+                else
+                {
+                    deadListener = true;
+                }
+            }
+            if (deadListener)
+            {
+                removeDeadListeners();
             }
         }
 
-    private:
-
-        // Helper for notifications (shared pointer somehow expensive)
-        std::vector<std::shared_ptr<T> > getListener()
+        // Notify listener about something (one need to know which method to call from listener)
+        void notifyListener(
+            void (T::*method) (Layout*, ElementHandle, const std::string&),
+            Layout* pLayout, ElementHandle handle, const std::string& rValue)
         {
-            std::vector<std::shared_ptr<T> > listeners;
-            std::vector<int> deadListeners;
-
-            // Inform listener
-            for (uint i = 0; i < mListeners.size(); i++)
+            // Inform listener. Listeners may register further listeners meanwhile, so index is used
+            bool deadListener = false;
+            for (size_t i = 0; i < mListeners.size(); i++)
             {
-                std::weak_ptr<T>& wpListener = mListeners[i];
-
-                // Check weak pointer getting them
-                if (auto sp = wpListener.lock())
+                if (auto spListener = mListeners[i].lock())
                 {
-                    // Add to return vector
-                    listeners.push_back(sp);
+                    (spListener.get()->*method)(pLayout, handle, rValue);
                 }
                 else
                 {
-                    // Dead listeners even not added to return vector
-                    deadListeners.push_back(i);
+                    deadListener = true;
                 }
             }
-
-            // Delete dead listeners from member vector
-            for (uint i = 0; i < deadListeners.size(); i++)
+            if (deadListener)
             {
-                mListeners.erase(mListeners.begin() + i);
+                removeDeadListeners();
             }
+        }
+
+    private:
 
-            return listeners;
+        // Delete dead listeners from member vector
+        void removeDeadListeners()
+        {
+            mListeners.erase(
+                std::remove_if(mListeners.begin(), mListeners.end(), [](const std::weak_ptr<T>& rwpListener) { return rwpListener.expired(); }),
+                mListeners.end());
         }
 
         // Members
@@ -7,6 +7,8 @@
 
 #include "Picture.h"
 
+#include "src/Frame.h"
+
 namespace eyegui
 {
     Picture::Picture(
@@ -39,6 +41,7 @@ namespace eyegui
         mType = Type::PICTURE;
 
         // Fill members
+        mAlignment = alignment;
         mupImage = std::move(mpAssetManager->createImage(mpLayout, filepath, alignment));
 
         // Aspect ratio of border should be preserved if necessary (only when pictue is neither zoomed nor stretched)
@@ -71,7 +74,16 @@ namespace eyegui
 		unsigned char const * pData,
 		bool flipY)
     {
+        // Size of element follows size of image when aligned originally
+        const bool sizeChanged =
+            mupImage->getTextureWidth() != (unsigned int)width
+            || mupImage->getTextureHeight() != (unsigned int)height;
         mupImage->setContent(name, width, height, format, pData, flipY);
+        if (sizeChanged && mAlignment == ImageAlignment::ORIGINAL)
+        {
+            mBorderAspectRatio = (float)width / (float)height;
+            getFrame()->makeResizeNecessary(true);
+        }
     }
 
     float Picture::specialUpdate(float tpf, Input* pInput)
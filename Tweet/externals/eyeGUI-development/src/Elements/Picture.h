@@ -73,6 +73,7 @@ namespace eyegui
 
         // Members
         std::unique_ptr<Image> mupImage;
+        ImageAlignment mAlignment;
     };
 }
 
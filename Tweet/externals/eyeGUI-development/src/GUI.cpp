@@ -193,8 +193,11 @@ namespace eyegui
             mLayers[i]->second->update(tpf, &copyInput);
         }
 
-        // Update gaze drawer
-        mupGazeDrawer->update(input.gazeX, input.gazeY, tpf);
+        // Update gaze drawer only when it is drawn
+        if (mDrawGazeVisualization)
+        {
+            mupGazeDrawer->update(input.gazeX, input.gazeY, tpf);
+        }
 
         // Call resize callback (after update of layouts)
         if (resized && mResizeCallbackSet)
@@ -226,10 +229,10 @@ namespace eyegui
         {
             glm::mat4 matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f);
             mpResizeBlend->bind();
-            mpResizeBlend->getShader()->fillValue("matrix", matrix);
-            mpResizeBlend->getShader()->fillValue("color", RESIZE_BLEND_COLOR);
-            // mpResizeBlend->getShader()->fillValue("alpha", 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
-            mpResizeBlend->getShader()->fillValue("alpha", 1.0f); // Without animation
+            mpResizeBlend->getShader()->fillValue(Shader::Uniform::MATRIX, matrix);
+            mpResizeBlend->getShader()->fillValue(Shader::Uniform::COLOR, RESIZE_BLEND_COLOR);
+            // mpResizeBlend->getShader()->fillValue(Shader::Uniform::ALPHA, 1.0f - 0.5f * (mResizeWaitTime / RESIZE_WAIT_DURATION));
+            mpResizeBlend->getShader()->fillValue(Shader::Uniform::ALPHA, 1.0f); // Without animation
             mpResizeBlend->draw();
         }
 
@@ -260,12 +263,17 @@ namespace eyegui
 
     void GUI::setGazeVisualizationDrawing(bool draw)
     {
+        // Start with fresh trail since gaze drawer is not updated while not drawn
+        if (draw && !mDrawGazeVisualization)
+        {
+            mupGazeDrawer->reset();
+        }
         mDrawGazeVisualization = draw;
     }
 
     void GUI::toggleGazeVisualizationDrawing()
     {
-        mDrawGazeVisualization = !mDrawGazeVisualization;
+        setGazeVisualizationDrawing(!mDrawGazeVisualization);
     }
 
     void GUI::prefetchImage(std::string filepath)
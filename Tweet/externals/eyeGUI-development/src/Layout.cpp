@@ -23,6 +23,7 @@ namespace eyegui
         mpGUI = pGUI;
         mpAssetManager = pAssetManager;
         mupIds = NULL;
+        mIdsVersion = 0;
         mAlpha.setValue(1);
         mVisible = true;
         mResizeNecessary = true;
@@ -32,8 +33,9 @@ namespace eyegui
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
         mForceResize = false;
 
-        // Parse style file
-        mupStyles = stylesheet_parser::parse(stylesheetFilepath);
+        // Copy styles, since they can be changed per layout
+        mupStyles = std::unique_ptr<std::map<std::string, Style> >(
+            new std::map<std::string, Style>(*(mpAssetManager->fetchStylesheet(stylesheetFilepath))));
     }
 
     Layout::~Layout()
@@ -154,6 +156,7 @@ namespace eyegui
 
         // Keep track of ids
         mupIds = std::move(upIds);
+        mIdsVersion++;
     }
 
     NotificationQueue* Layout::getNotificationQueue() const
@@ -313,6 +316,119 @@ namespace eyegui
         return false;
     }
 
+    ElementHandle Layout::fetchElementHandle(std::string id)
+    {
+        ElementHandle handle;
+        Element* pElement = fetchElement(id);
+        if (pElement != NULL)
+        {
+            handle.mIndex = insertHandleEntry(id, pElement);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find element with id: " + id);
+        }
+        return handle;
+    }
+
+    std::string const & Layout::getElementId(ElementHandle handle) const
+    {
+        // Id does not depend on element, so entry is not resolved again
+        if (handle.mIndex < 0 || handle.mIndex >= (int)mHandleEntries.size())
+        {
+            return EMPTY_STRING_ATTRIBUTE;
+        }
+        return mHandleEntries[handle.mIndex].id;
+    }
+
+    TextBlockHandle Layout::fetchTextBlockHandle(std::string id)
+    {
+        TextBlockHandle handle;
+        Element* pElement = fetchElement(id);
+        if (toTextBlock(pElement) != NULL)
+        {
+            handle.mIndex = insertHandleEntry(id, pElement);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text block with id: " + id);
+        }
+        return handle;
+    }
+
+    void Layout::setElementActivity(ElementHandle handle, bool active, bool fade)
+    {
+        HandleEntry* pEntry = fetchHandleEntry(handle);
+        if (pEntry != NULL && pEntry->pElement != NULL)
+        {
+            pEntry->pElement->setActivity(active, fade);
+
+            if (!active && mpSelectedInteractiveElement == pEntry->pElement)
+            {
+                // If selected element goes inactive, deselect it
+                deselectInteractiveElement();
+            }
+        }
+    }
+
+    bool Layout::isElementActive(ElementHandle handle) const
+    {
+        HandleEntry* pEntry = fetchHandleEntry(handle);
+        if (pEntry != NULL && pEntry->pElement != NULL)
+        {
+            return pEntry->pElement->isActive();
+        }
+        return false;
+    }
+
+    void Layout::setStyleOfElement(ElementHandle handle, std::string style)
+    {
+        HandleEntry* pEntry = fetchHandleEntry(handle);
+        if (pEntry != NULL && pEntry->pElement != NULL)
+        {
+            if (pEntry->hasStyle && pEntry->style == style) { return; }
+            pEntry->pElement->setStyle(style);
+            pEntry->hasStyle = true;
+            pEntry->style = style;
+        }
+    }
+
+    void Layout::setContentOfTextBlock(TextBlockHandle handle, std::u16string content)
+    {
+        HandleEntry* pEntry = fetchHandleEntry(handle);
+        TextBlock* pTextBlock = pEntry != NULL ? toTextBlock(pEntry->pElement) : NULL;
+        if (pTextBlock != NULL)
+        {
+            // Text block itself skips unchanged content
+            pTextBlock->setContent(content);
+            pEntry->hasContent = false;
+        }
+    }
+
+    void Layout::setContentOfTextBlock(TextBlockHandle handle, std::string content)
+    {
+        HandleEntry* pEntry = fetchHandleEntry(handle);
+        TextBlock* pTextBlock = pEntry != NULL ? toTextBlock(pEntry->pElement) : NULL;
+        if (pTextBlock != NULL)
+        {
+            // Skip conversion when content is unchanged
+            if (pEntry->hasContent && pEntry->content == content) { return; }
+
+            // Cast to UTF-16
+            std::u16string content16;
+            if (convertUTF8ToUTF16(content, content16))
+            {
+                pTextBlock->setContent(content16);
+                pEntry->hasContent = true;
+                pEntry->content = content;
+            }
+            else
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Invalid characters found in content. Please check unicode encoding of your source code. Following string was received: " + content);
+            }
+        }
+    }
+
     void Layout::setElementDimming(std::string id, bool dimming)
     {
         Element* pElement = fetchElement(id);
@@ -358,6 +474,7 @@ namespace eyegui
         if (pElement != NULL)
         {
             pElement->setStyle(style);
+            invalidateHandleEntry(id, true, false);
         }
         else
         {
@@ -544,6 +661,7 @@ namespace eyegui
         if (pTextBlock != NULL)
         {
             pTextBlock->setContent(content);
+            invalidateHandleEntry(id, false, true);
         }
         else
         {
@@ -572,6 +690,7 @@ namespace eyegui
         if (pTextBlock != NULL)
         {
             pTextBlock->setKey(key);
+            invalidateHandleEntry(id, false, true);
         }
         else
         {
@@ -736,6 +855,23 @@ namespace eyegui
         }
     }
 
+    void Layout::registerButtonCallbacks(
+        std::string id,
+        std::function<void()> hitCallback,
+        std::function<void()> downCallback,
+        std::function<void()> upCallback)
+    {
+        Button* pButton = toButton(fetchElement(id));
+        if (pButton != NULL)
+        {
+            pButton->registerCallbacks(hitCallback, downCallback, upCallback);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find button with id: " + id);
+        }
+    }
+
     void Layout::registerSensorListener(std::string id, std::weak_ptr<SensorListener> wpListener)
     {
         Sensor* pSensor = toSensor(fetchElement(id));
@@ -1372,6 +1508,7 @@ namespace eyegui
             {
                 mupIds->erase(id);
             }
+            mIdsVersion++;
 
             // Reminder for removed frame
             pFrame->setRemoved();
@@ -1553,6 +1690,58 @@ namespace eyegui
         }
     }
 
+    Layout::HandleEntry* Layout::fetchHandleEntry(ElementHandle handle) const
+    {
+        if (handle.mIndex < 0 || handle.mIndex >= (int)mHandleEntries.size())
+        {
+            return NULL;
+        }
+
+        // Resolve element again only when ids have changed since last use
+        HandleEntry& rEntry = mHandleEntries[handle.mIndex];
+        if (rEntry.idsVersion != mIdsVersion)
+        {
+            Element* pElement = fetchElement(rEntry.id);
+            if (pElement != rEntry.pElement)
+            {
+                // Element has been replaced, so cached values are unknown
+                rEntry.pElement = pElement;
+                rEntry.hasStyle = false;
+                rEntry.hasContent = false;
+            }
+            rEntry.idsVersion = mIdsVersion;
+        }
+        return &rEntry;
+    }
+
+    int Layout::insertHandleEntry(std::string id, Element* pElement)
+    {
+        auto it = mHandleIndices.find(id);
+        if (it != mHandleIndices.end())
+        {
+            return it->second;
+        }
+        HandleEntry entry;
+        entry.id = id;
+        entry.pElement = pElement;
+        entry.idsVersion = mIdsVersion;
+        int index = (int)mHandleEntries.size();
+        mHandleEntries.push_back(entry);
+        mHandleIndices[id] = index;
+        return index;
+    }
+
+    void Layout::invalidateHandleEntry(std::string const & rId, bool style, bool content)
+    {
+        auto it = mHandleIndices.find(rId);
+        if (it != mHandleIndices.end())
+        {
+            HandleEntry& rEntry = mHandleEntries[it->second];
+            if (style) { rEntry.hasStyle = false; }
+            if (content) { rEntry.hasContent = false; }
+        }
+    }
+
     bool Layout::replaceElement(Element* pTarget, std::unique_ptr<Element> upElement, bool fade)
     {
         // Pointer to replacement
@@ -1631,6 +1820,7 @@ namespace eyegui
             {
                 mupIds->erase(id);
             }
+            mIdsVersion++;
 
             // Do direct resize to be ok for first draw
             pTarget->getFrame()->makeResizeNecessary(true);
@@ -1644,6 +1834,7 @@ namespace eyegui
 
     void Layout::insertId(Element* pElement)
     {
+        mIdsVersion++;
         int idCount = (int)mupIds->size();
 
         if (pElement->getId() != EMPTY_STRING_ATTRIBUTE)
@@ -1659,6 +1850,8 @@ namespace eyegui
 
     void Layout::insertIds(std::unique_ptr<idMap> upIdMap)
     {
+        mIdsVersion++;
+
         // Faster code, but not so good for debugging later applications
         /*int idCount = (int)(mupIds->size() + upIdMap->size());
         mupIds->insert(upIdMap->begin(), upIdMap->end());
@@ -24,7 +24,9 @@
 
 #include <memory>
 #include <map>
+#include <deque>
 #include <set>
+#include <vector>
 #include <utility>
 
 namespace eyegui
@@ -105,6 +107,18 @@ namespace eyegui
         // Check activity of element
         bool isElementActive(std::string id) const;
 
+        // Fetch handle of element, which is resolved again only when ids change
+        ElementHandle fetchElementHandle(std::string id);
+        std::string const & getElementId(ElementHandle handle) const;
+        TextBlockHandle fetchTextBlockHandle(std::string id);
+
+        // Setters via handle. Style and content are only applied when changed
+        void setElementActivity(ElementHandle handle, bool active, bool fade);
+        bool isElementActive(ElementHandle handle) const;
+        void setStyleOfElement(ElementHandle handle, std::string style);
+        void setContentOfTextBlock(TextBlockHandle handle, std::u16string content);
+        void setContentOfTextBlock(TextBlockHandle handle, std::string content);
+
         // Set whether element is dimming
         void setElementDimming(std::string id, bool dimming);
 
@@ -205,6 +219,13 @@ namespace eyegui
         // Register button listener
         void registerButtonListener(std::string id, std::weak_ptr<ButtonListener> wpListener);
 
+        // Register button callbacks
+        void registerButtonCallbacks(
+            std::string id,
+            std::function<void()> hitCallback,
+            std::function<void()> downCallback,
+            std::function<void()> upCallback);
+
         // Register sensor listener
         void registerSensorListener(std::string id, std::weak_ptr<SensorListener> wpListener);
 
@@ -340,6 +361,27 @@ namespace eyegui
         // Fetch pointer to element by id
         Element* fetchElement(std::string id) const;
 
+        // Entry in handle table
+        struct HandleEntry
+        {
+            std::string id;
+            Element* pElement = NULL;
+            uint idsVersion = 0;
+            bool hasStyle = false; // last set style is known
+            std::string style;
+            bool hasContent = false; // last set content is known
+            std::string content;
+        };
+
+        // Fetch entry of handle with up to date element pointer. Returns NULL for invalid handle
+        HandleEntry* fetchHandleEntry(ElementHandle handle) const;
+
+        // Add entry to handle table or return index of existing one
+        int insertHandleEntry(std::string id, Element* pElement);
+
+        // Forget cached values of handle entry, called when element is changed via its id
+        void invalidateHandleEntry(std::string const & rId, bool style, bool content);
+
         // Internal replacement helper, returns whether successful
         bool replaceElement(Element* pTarget, std::unique_ptr<Element> upElement, bool fade);
 
@@ -360,6 +402,9 @@ namespace eyegui
         AssetManager* mpAssetManager;
         std::unique_ptr<Frame> mupMainFrame;
         std::unique_ptr<std::map<std::string, Element*> > mupIds;
+        uint mIdsVersion; // incremented whenever ids are inserted or removed
+        mutable std::deque<HandleEntry> mHandleEntries; // deque keeps references to entries valid while inserting
+        std::map<std::string, int> mHandleIndices;
         std::vector<std::unique_ptr<Frame> > mFloatingFrames;
         std::vector<int> mFloatingFramesOrderingIndices;
         std::vector<int> mDyingFloatingFramesIndices;
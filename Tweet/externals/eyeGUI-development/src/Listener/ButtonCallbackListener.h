@@ -0,0 +1,44 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Button listener which calls callbacks registered for a single button.
+// Overrides the handle based methods, so neither id nor handle is resolved.
+
+#ifndef BUTTON_CALLBACK_LISTENER_H_
+#define BUTTON_CALLBACK_LISTENER_H_
+
+#include "include/eyeGUI.h"
+
+namespace eyegui
+{
+    class ButtonCallbackListener : public ButtonListener
+    {
+    public:
+
+        // Constructor, empty callbacks are skipped
+        ButtonCallbackListener(
+            std::function<void()> hitCallback,
+            std::function<void()> downCallback,
+            std::function<void()> upCallback)
+            : mHitCallback(hitCallback), mDownCallback(downCallback), mUpCallback(upCallback)
+        {
+            // Nothing to do
+        }
+
+        // Callbacks
+        void virtual hit(Layout* pLayout, ElementHandle handle) { if (mHitCallback) { mHitCallback(); } }
+        void virtual down(Layout* pLayout, ElementHandle handle) { if (mDownCallback) { mDownCallback(); } }
+        void virtual up(Layout* pLayout, ElementHandle handle) { if (mUpCallback) { mUpCallback(); } }
+
+    private:
+
+        // Members
+        std::function<void()> mHitCallback;
+        std::function<void()> mDownCallback;
+        std::function<void()> mUpCallback;
+    };
+}
+
+#endif // BUTTON_CALLBACK_LISTENER_H_
@@ -18,4 +18,34 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    void ButtonListener::hit(Layout* pLayout, std::string id)
+    {
+        // Nothing to do
+    }
+
+    void ButtonListener::down(Layout* pLayout, std::string id)
+    {
+        // Nothing to do
+    }
+
+    void ButtonListener::up(Layout* pLayout, std::string id)
+    {
+        // Nothing to do
+    }
+
+    void ButtonListener::hit(Layout* pLayout, ElementHandle handle)
+    {
+        hit(pLayout, getElementId(pLayout, handle));
+    }
+
+    void ButtonListener::down(Layout* pLayout, ElementHandle handle)
+    {
+        down(pLayout, getElementId(pLayout, handle));
+    }
+
+    void ButtonListener::up(Layout* pLayout, ElementHandle handle)
+    {
+        up(pLayout, getElementId(pLayout, handle));
+    }
 }
@@ -18,4 +18,24 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    void KeyboardListener::keyPressed(Layout* pLayout, std::string id, std::u16string value)
+    {
+        // Nothing to do
+    }
+
+    void KeyboardListener::keyPressed(Layout* pLayout, std::string id, std::string value)
+    {
+        // Nothing to do
+    }
+
+    void KeyboardListener::keyPressed(Layout* pLayout, ElementHandle handle, const std::u16string& rValue)
+    {
+        keyPressed(pLayout, getElementId(pLayout, handle), rValue);
+    }
+
+    void KeyboardListener::keyPressed(Layout* pLayout, ElementHandle handle, const std::string& rValue)
+    {
+        keyPressed(pLayout, getElementId(pLayout, handle), rValue);
+    }
 }
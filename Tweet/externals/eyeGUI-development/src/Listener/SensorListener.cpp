@@ -18,4 +18,14 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    void SensorListener::penetrated(Layout* pLayout, std::string id, float amount)
+    {
+        // Nothing to do
+    }
+
+    void SensorListener::penetrated(Layout* pLayout, ElementHandle handle, float amount)
+    {
+        penetrated(pLayout, getElementId(pLayout, handle), amount);
+    }
 }
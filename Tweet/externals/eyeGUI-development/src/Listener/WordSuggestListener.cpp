@@ -18,4 +18,24 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    void WordSuggestListener::chosen(Layout* pLayout, std::string id, std::u16string value)
+    {
+        // Nothing to do
+    }
+
+    void WordSuggestListener::chosen(Layout* pLayout, std::string id, std::string value)
+    {
+        // Nothing to do
+    }
+
+    void WordSuggestListener::chosen(Layout* pLayout, ElementHandle handle, const std::u16string& rValue)
+    {
+        chosen(pLayout, getElementId(pLayout, handle), rValue);
+    }
+
+    void WordSuggestListener::chosen(Layout* pLayout, ElementHandle handle, const std::string& rValue)
+    {
+        chosen(pLayout, getElementId(pLayout, handle), rValue);
+    }
 }
@@ -17,7 +17,6 @@ namespace eyegui
     NotificationQueue::NotificationQueue(Layout* pLayout)
     {
         mpLayout = pLayout;
-        mupNotificatons = std::unique_ptr<NotificationVector>(new NotificationVector);
     }
 
     NotificationQueue::~NotificationQueue()
@@ -25,12 +24,17 @@ namespace eyegui
         // Nothing to do
     }
 
-    void NotificationQueue::enqueue(std::string notifierId, NotificationType notification)
+    void NotificationQueue::enqueue(NotifierElement* pNotifier, NotificationType notification)
     {
         // Ignore elements without id
-        if(notifierId != EMPTY_STRING_ATTRIBUTE)
+        if(pNotifier->getId() != EMPTY_STRING_ATTRIBUTE)
         {
-          mupNotificatons->push_back(NotificationPair(notifierId, notification));
+            // Resolve handle of element only once
+            if (!pNotifier->mNotificationHandle.isValid())
+            {
+                pNotifier->mNotificationHandle = mpLayout->fetchElementHandle(pNotifier->getId());
+            }
+            mNotifications.push_back(Notification{ pNotifier->mNotificationHandle, notification });
         }
     }
 
@@ -38,12 +42,12 @@ namespace eyegui
     {
         // Repeat working on the notifications
         int loopCount = 0;
-        while (mupNotificatons->size() > 0)
+        while (mNotifications.size() > 0)
         {
             if (loopCount == NOTIFICATION_MAX_LOOP_COUNT)
             {
                 // Delete still existing notifications
-                mupNotificatons.reset(new NotificationVector);
+                mNotifications.clear();
                 throwWarning(OperationNotifier::Operation::RUNTIME, "Notifications are too nested and were cleared");
 
                 // Break the while loop
@@ -52,30 +56,28 @@ namespace eyegui
 
             else
             {
-                // Move notifications to local unique pointer and replace with empty one, which can be filled again
-                std::unique_ptr<NotificationVector> upNotifications = std::move(mupNotificatons);
-                mupNotificatons = std::unique_ptr<NotificationVector>(new NotificationVector);
+                // Take notifications, so listeners can fill the queue again
+                std::swap(mNotifications, mProcessedNotifications);
 
                 // Work on notifications
-                for (uint i = 0; i < upNotifications->size(); i++)
+                for (const Notification& rNotification : mProcessedNotifications)
                 {
-                    // Listeners of notifications could fill the notifications in this layout again... (just a note)
-                    NotificationPair notification = upNotifications->at(i);
-
-                    // Get notifier element pointer by id from layout
-                    NotifierElement* pNotifierElement = toNotifierElement(mpLayout->fetchElement(notification.first));
+                    // Get notifier element by handle, which resolves id again only if ids of layout have changed
+                    Layout::HandleEntry* pEntry = mpLayout->fetchHandleEntry(rNotification.handle);
+                    NotifierElement* pNotifierElement = pEntry != NULL ? toNotifierElement(pEntry->pElement) : NULL;
 
                     // Check for existence
                     if (pNotifierElement != NULL)
                     {
                         // Piping takes care that replaced elements do not send notifications
-                        pNotifierElement->pipeNotification(notification.second, mpLayout);
+                        pNotifierElement->pipeNotification(rNotification.type, mpLayout);
                     }
                     else
                     {
-                        throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find notifier element with id: " + notification.first);
+                        throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find notifier element with id: " + (pEntry != NULL ? pEntry->id : std::string()));
                     }
                 }
+                mProcessedNotifications.clear();
 
                 // Count loops
                 loopCount++;
@@ -10,6 +10,7 @@
 #ifndef NOTIFICATION_QUEUE_H_
 #define NOTIFICATION_QUEUE_H_
 
+#include "include/eyeGUI.h"
 #include "Elements/NotifierElement.h"
 
 #include <memory>
@@ -20,9 +21,15 @@ namespace eyegui
     // Forward declaration
     class Layout;
 
+    // Notification of element, which is resolved by handle when processed
+    struct Notification
+    {
+        ElementHandle handle;
+        NotificationType type;
+    };
+
     // Typedefs
-    typedef std::pair<std::string, NotificationType> NotificationPair;
-    typedef std::vector<NotificationPair> NotificationVector;
+    typedef std::vector<Notification> NotificationVector;
 
     class NotificationQueue
     {
@@ -35,7 +42,7 @@ namespace eyegui
         virtual ~NotificationQueue();
 
         // Enqueue notification which is processed before next updating of layout
-        void enqueue(std::string notifierId, NotificationType notification);
+        void enqueue(NotifierElement* pNotifier, NotificationType notification);
 
         // Process notifications
         void process();
@@ -44,7 +51,8 @@ namespace eyegui
 
         // Member
         Layout* mpLayout;
-        std::unique_ptr<NotificationVector> mupNotificatons;
+        NotificationVector mNotifications;
+        NotificationVector mProcessedNotifications; // swapped with notifications while processing, so capacity of both is kept
     };
 }
 
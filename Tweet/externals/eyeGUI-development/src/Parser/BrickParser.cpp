@@ -23,16 +23,15 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Read file, asset manager keeps it parsed for further bricks
+            tinyxml2::XMLDocument const * pDoc = pAssetManager->fetchDocument(filepath);
+            if (pDoc->Error())
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + pDoc->ErrorName(), filepath);
             }
 
             // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
+            tinyxml2::XMLElement const * xmlElement = pDoc->FirstChildElement();
 
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
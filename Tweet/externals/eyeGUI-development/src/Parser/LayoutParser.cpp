@@ -25,16 +25,15 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Read file, asset manager keeps it parsed for further layouts
+            tinyxml2::XMLDocument const * pDoc = pAssetManager->fetchDocument(filepath);
+            if (pDoc->Error())
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + pDoc->ErrorName(), filepath);
             }
 
             // First xml element should be a layout
-            tinyxml2::XMLElement* xmlLayout = doc.FirstChildElement();
+            tinyxml2::XMLElement const * xmlLayout = pDoc->FirstChildElement();
             if (!element_parser::validateElement(xmlLayout, "layout"))
             {
                 throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
@@ -47,7 +46,7 @@ namespace eyegui
             std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, stylesheetFilepath));
 
             // Then there should be an element
-            tinyxml2::XMLElement* xmlRoot = xmlLayout->FirstChildElement();
+            tinyxml2::XMLElement const * xmlRoot = xmlLayout->FirstChildElement();
 
             // Check for existence
             if (xmlRoot == NULL)
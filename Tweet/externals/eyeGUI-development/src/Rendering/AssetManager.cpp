@@ -19,6 +19,7 @@
 #include "Font/AtlasFont.h"
 #include "Font/EmptyFont.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Parser/StylesheetParser.h"
 
 #include <algorithm>
 
@@ -247,6 +248,12 @@ namespace eyegui
             case shaders::Type::CHARACTER_KEY:
                 rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCharacterKeyFragmentShader));
                 break;
+            case shaders::Type::GAZE_TRAIL:
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pGazeTrailVertexShader, shaders::pGazeTrailFragmentShader));
+                break;
+            case shaders::Type::GAZE_POINT:
+                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pGazePointVertexShader, shaders::pGazePointFragmentShader));
+                break;
             default:
                 throwError(OperationNotifier::Operation::BUG, "Shader does not exist");
             }
@@ -352,6 +359,33 @@ namespace eyegui
         return pFont;
     }
 
+    tinyxml2::XMLDocument const * AssetManager::fetchDocument(std::string filepath)
+    {
+        // Parse file when not cached or changed since parsing
+        CachedDocument& rDocument = mDocuments[filepath];
+        FileStamp stamp = getFileStamp(buildPath(filepath));
+        if (rDocument.upDocument == NULL || rDocument.stamp != stamp)
+        {
+            rDocument.stamp = stamp;
+            rDocument.upDocument = std::unique_ptr<tinyxml2::XMLDocument>(new tinyxml2::XMLDocument);
+            rDocument.upDocument->LoadFile(buildPath(filepath).c_str());
+        }
+        return rDocument.upDocument.get();
+    }
+
+    std::map<std::string, Style> const * AssetManager::fetchStylesheet(std::string filepath)
+    {
+        // Parse file when not cached or changed since parsing
+        CachedStylesheet& rStylesheet = mStylesheets[filepath];
+        FileStamp stamp = filepath == EMPTY_STRING_ATTRIBUTE ? FileStamp() : getFileStamp(buildPath(filepath));
+        if (rStylesheet.upStyles == NULL || rStylesheet.stamp != stamp)
+        {
+            rStylesheet.upStyles = stylesheet_parser::parse(filepath);
+            rStylesheet.stamp = stamp;
+        }
+        return rStylesheet.upStyles.get();
+    }
+
     void AssetManager::resizeFontAtlases()
     {
         for (auto& rPair : mFonts)
@@ -6,7 +6,9 @@
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Managing all kind of assets like shaders, meshes and graphics. Ensures that
 // all assets are unique and loaded only one time into memory. Initializes and
-// terminates the FreeType library and manages fonts.
+// terminates the FreeType library and manages fonts. Keeps parsed XML of
+// layouts and bricks and parsed stylesheets, which are parsed again only when
+// their file has changed.
 
 #ifndef ASSET_MANAGER_H_
 #define ASSET_MANAGER_H_
@@ -21,6 +23,10 @@
 #include "Assets/Key.h"
 #include "Assets/CharacterKey.h"
 #include "Assets/Image.h"
+#include "Style.h"
+#include "src/Utilities/Helper.h"
+
+#include "externals/TinyXML2/tinyxml2.h"
 
 #include "externals/FreeType2/include/ft2build.h"
 #include FT_FREETYPE_H
@@ -33,7 +39,7 @@ namespace eyegui
     // Available assets
 
     namespace shaders { enum class Type {
-    COLOR, CIRCLE, DIM, ACTIVITY, MARK, CIRCLE_THRESHOLD, BOX_THRESHOLD, HIGHLIGHT, SELECTION, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT, IMAGE, KEY, CHARACTER_KEY}; }
+    COLOR, CIRCLE, DIM, ACTIVITY, MARK, CIRCLE_THRESHOLD, BOX_THRESHOLD, HIGHLIGHT, SELECTION, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT, IMAGE, KEY, CHARACTER_KEY, GAZE_TRAIL, GAZE_POINT}; }
 
     namespace meshes { enum class Type { QUAD, LINE }; }
     namespace graphics { enum class Type { CIRCLE, BOX, NOT_FOUND }; }
@@ -76,6 +82,12 @@ namespace eyegui
         // Fetch font
         Font const * fetchFont(std::string filepath);
 
+        // Fetch parsed XML document of layout or brick
+        tinyxml2::XMLDocument const * fetchDocument(std::string filepath);
+
+        // Fetch parsed stylesheet
+        std::map<std::string, Style> const * fetchStylesheet(std::string filepath);
+
         // Resize font atlases (should be called by GUI only)
         void resizeFontAtlases();
 
@@ -101,6 +113,20 @@ namespace eyegui
 
     private:
 
+        // Parsed XML document and modification time and size of its file
+        struct CachedDocument
+        {
+            FileStamp stamp;
+            std::unique_ptr<tinyxml2::XMLDocument> upDocument;
+        };
+
+        // Parsed stylesheet and modification time and size of its file
+        struct CachedStylesheet
+        {
+            FileStamp stamp;
+            std::unique_ptr<std::map<std::string, Style> > upStyles;
+        };
+
         // Members
         GUI const * mpGUI;
         FT_Library mFreeTypeLibrary;
@@ -110,6 +136,8 @@ namespace eyegui
         std::map<std::string, std::unique_ptr<Texture> > mTextures;
         std::map<graphics::Type, std::unique_ptr<Texture> > mGraphics;
         std::map<std::string, std::unique_ptr<Font> > mFonts;
+        std::map<std::string, CachedDocument> mDocuments;
+        std::map<std::string, CachedStylesheet> mStylesheets;
     };
 }
 
@@ -131,11 +131,11 @@ namespace eyegui
         // Fill color
         glm::vec4 characterColor = iconColor;
         characterColor.a *= alpha;
-        mpQuadShader->fillValue("color", characterColor);
+        mpQuadShader->fillValue(Shader::Uniform::COLOR, characterColor);
 
         // Fill other uniforms
-        mpQuadShader->fillValue("matrix", mQuadMatrix); // Matrix is updated in transform and size
-        mpQuadShader->fillValue("atlas", 1);
+        mpQuadShader->fillValue(Shader::Uniform::MATRIX, mQuadMatrix); // Matrix is updated in transform and size
+        mpQuadShader->fillValue(Shader::Uniform::ATLAS, 1);
 
         // Draw character quad (vertex count must be 6)
         glDrawArrays(GL_TRIANGLES, 0, 6);
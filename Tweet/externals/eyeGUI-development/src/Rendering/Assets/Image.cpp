@@ -104,7 +104,7 @@ namespace eyegui
 
         // Fill matrix
         mpQuad->getShader()->fillValue(
-            "matrix",
+            Shader::Uniform::MATRIX,
             calculateDrawMatrix(
                 mpLayout->getLayoutWidth(),
                 mpLayout->getLayoutHeight(),
@@ -114,8 +114,8 @@ namespace eyegui
                 mHeight));
 
         // Fill values
-        mpQuad->getShader()->fillValue("alpha", alpha);
-        mpQuad->getShader()->fillValue("image", 1);
+        mpQuad->getShader()->fillValue(Shader::Uniform::ALPHA, alpha);
+        mpQuad->getShader()->fillValue(Shader::Uniform::IMAGE, 1);
 
         // Fill scale
         glm::vec2 scale = glm::vec2(1.f,1.f);
@@ -136,7 +136,7 @@ namespace eyegui
             }
 
         }
-        mpQuad->getShader()->fillValue("scale", scale);
+        mpQuad->getShader()->fillValue(Shader::Uniform::SCALE, scale);
 
         // Bind texture to render
         mpTexture->bind(1);
@@ -82,6 +82,15 @@ namespace eyegui
         transformAndSize();
     }
 
+    void Key::adoptState(const Key& rOtherKey)
+    {
+        mFocused = rOtherKey.mFocused;
+        mFocus.setValue(rOtherKey.mFocus.getValue());
+        mPicked = rOtherKey.mPicked;
+        mPick.setValue(rOtherKey.mPick.getValue());
+        transformAndSize(rOtherKey.mX, rOtherKey.mY, rOtherKey.mSize);
+    }
+
     void Key::update(float tpf)
     {
         mFocus.update(tpf / KEY_FOCUS_DURATION, !mFocused);
@@ -142,12 +151,12 @@ namespace eyegui
         // Fill color
         glm::vec4 circleColor = color;
         circleColor.a *= alpha;
-        mpCircleRenderItem->getShader()->fillValue("color", circleColor);
+        mpCircleRenderItem->getShader()->fillValue(Shader::Uniform::COLOR, circleColor);
 
         // Fill other uniforms
-        mpCircleRenderItem->getShader()->fillValue("matrix", mCircleMatrix); // Matrix is updated in transform and size
-        mpCircleRenderItem->getShader()->fillValue("pickColor", pickColor);
-        mpCircleRenderItem->getShader()->fillValue("pick", mPick.getValue());
+        mpCircleRenderItem->getShader()->fillValue(Shader::Uniform::MATRIX, mCircleMatrix); // Matrix is updated in transform and size
+        mpCircleRenderItem->getShader()->fillValue(Shader::Uniform::PICK_COLOR, pickColor);
+        mpCircleRenderItem->getShader()->fillValue(Shader::Uniform::PICK, mPick.getValue());
 
         // Drawing
         mpCircleRenderItem->draw();
@@ -161,11 +170,11 @@ namespace eyegui
 		if (threshold > 0)
 		{
 			mpThresholdItem->bind();
-			mpThresholdItem->getShader()->fillValue("matrix", mCircleMatrix);
-			mpThresholdItem->getShader()->fillValue("thresholdColor", thresholdColor);
-			mpThresholdItem->getShader()->fillValue("threshold", threshold);
-			mpThresholdItem->getShader()->fillValue("alpha", alpha);
-			mpThresholdItem->getShader()->fillValue("mask", 0); // mask is always in slot 0
+			mpThresholdItem->getShader()->fillValue(Shader::Uniform::MATRIX, mCircleMatrix);
+			mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD_COLOR, thresholdColor);
+			mpThresholdItem->getShader()->fillValue(Shader::Uniform::THRESHOLD, threshold);
+			mpThresholdItem->getShader()->fillValue(Shader::Uniform::ALPHA, alpha);
+			mpThresholdItem->getShader()->fillValue(Shader::Uniform::MASK, 0); // mask is always in slot 0
 			mpThresholdItem->draw();
 		}
 	}
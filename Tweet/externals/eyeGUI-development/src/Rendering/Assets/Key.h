@@ -41,6 +41,9 @@ namespace eyegui
         // Set position of center and size of key
         virtual void transformAndSize(int x, int y, int size);
 
+        // Take over position, size, focus and pick of other key, e.g. for animation
+        void adoptState(const Key& rOtherKey);
+
         // Update
         virtual void update(float tpf);
 
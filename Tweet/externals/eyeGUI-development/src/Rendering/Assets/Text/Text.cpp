@@ -74,6 +74,8 @@ namespace eyegui
 
     void Text::setContent(std::u16string content)
     {
+        // Building mesh is expensive, so skip unchanged content
+        if (content == mContent) { return; }
         mContent = content;
         calculateMesh();
     }
@@ -102,9 +102,9 @@ namespace eyegui
 			// Determine which 
 			glm::mat4 backgroundMatrix = calculateDrawMatrix(mpGUI->getWindowWidth(), mpGUI->getWindowHeight(), mX + ((mWidth - backgroundWidth) / 2), mY + yOffset - (extraPixels/2), backgroundWidth, backgroundHeight);
 			mpBackground->bind();
-			mpBackground->getShader()->fillValue("matrix", backgroundMatrix);
-			mpBackground->getShader()->fillValue("color", glm::vec4(0.f, 0.f, 0.f, 0.3f));
-			mpBackground->getShader()->fillValue("alpha", alpha);
+			mpBackground->getShader()->fillValue(Shader::Uniform::MATRIX, backgroundMatrix);
+			mpBackground->getShader()->fillValue(Shader::Uniform::COLOR, glm::vec4(0.f, 0.f, 0.f, 0.3f));
+			mpBackground->getShader()->fillValue(Shader::Uniform::ALPHA, alpha);
 			mpBackground->draw();
 		}
 
@@ -123,10 +123,10 @@ namespace eyegui
 		glBindVertexArray(mVertexArrayObject);
 
         // Fill uniforms
-        mpShader->fillValue("matrix", matrix);
-        mpShader->fillValue("color", color);
-        mpShader->fillValue("alpha", alpha);
-        mpShader->fillValue("atlas", 1);
+        mpShader->fillValue(Shader::Uniform::MATRIX, matrix);
+        mpShader->fillValue(Shader::Uniform::COLOR, color);
+        mpShader->fillValue(Shader::Uniform::ALPHA, alpha);
+        mpShader->fillValue(Shader::Uniform::ATLAS, 1);
 
         // Draw flow
         glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
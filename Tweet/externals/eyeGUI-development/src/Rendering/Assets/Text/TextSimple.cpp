@@ -83,10 +83,10 @@ namespace eyegui
             mpFont->bindAtlasTexture(mFontSize, 1, true);
         }
 
-        mpShader->fillValue("matrix", matrix);
-        mpShader->fillValue("color", color);
-        mpShader->fillValue("alpha", alpha);
-        mpShader->fillValue("atlas", 1);
+        mpShader->fillValue(Shader::Uniform::MATRIX, matrix);
+        mpShader->fillValue(Shader::Uniform::COLOR, color);
+        mpShader->fillValue(Shader::Uniform::ALPHA, alpha);
+        mpShader->fillValue(Shader::Uniform::ATLAS, 1);
 
         // Draw flow
         glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
@@ -8,22 +8,87 @@
 #include "GazeDrawer.h"
 
 #include "GUI.h"
-#include "externals/GLM/glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
 
 namespace eyegui
 {
+    // Floats per point in vertex buffer
+    static const int GAZE_DRAWER_POINT_FLOATS = 4;
+
     GazeDrawer::GazeDrawer(GUI const * pGUI, AssetManager* pAssetManager)
     {
         // Members
         mpGUI = pGUI;
         mpAssetManager = pAssetManager;
-        mpCircle = mpAssetManager->fetchRenderItem(shaders::Type::CIRCLE, meshes::Type::QUAD);
-        mpLine = mpAssetManager->fetchRenderItem(shaders::Type::COLOR, meshes::Type::LINE);
+        mpTrailShader = mpAssetManager->fetchShader(shaders::Type::GAZE_TRAIL);
+        mpPointShader = mpAssetManager->fetchShader(shaders::Type::GAZE_POINT);
+        mMinGazePointSize = 0;
+        mMaxGazePointSize = 0;
+        mVertexBufferSize = 0;
+        mPointCount = 0;
+
+        // Save currently set buffer and vertex array object
+        GLint oldBuffer = -1;
+        GLint oldVAO = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+
+        // Buffer for points, filled in update
+        glGenBuffers(1, &mVertexBuffer);
+
+        // Quad which is instanced for each point
+        glGenBuffers(1, &mQuadBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+        const float quad[] = { 0, 0, 1, 0, 0, 1, 1, 1 };
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+
+        // Vertex array object for trail, points are vertices
+        glGenVertexArrays(1, &mTrailVertexArrayObject);
+        glBindVertexArray(mTrailVertexArrayObject);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        GLuint trailPosAttrib = glGetAttribLocation(mpTrailShader->getShaderProgram(), "posAttribute");
+        glEnableVertexAttribArray(trailPosAttrib);
+        glVertexAttribPointer(trailPosAttrib, 2, GL_FLOAT, GL_FALSE, GAZE_DRAWER_POINT_FLOATS * sizeof(float), (void*)0);
+        GLuint trailAlphaAttrib = glGetAttribLocation(mpTrailShader->getShaderProgram(), "alphaAttribute");
+        glEnableVertexAttribArray(trailAlphaAttrib);
+        glVertexAttribPointer(trailAlphaAttrib, 1, GL_FLOAT, GL_FALSE, GAZE_DRAWER_POINT_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+
+        // Vertex array object for circles, points are instances
+        glGenVertexArrays(1, &mPointVertexArrayObject);
+        glBindVertexArray(mPointVertexArrayObject);
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+        GLuint quadAttrib = glGetAttribLocation(mpPointShader->getShaderProgram(), "quadAttribute");
+        glEnableVertexAttribArray(quadAttrib);
+        glVertexAttribPointer(quadAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        GLuint pointPosAttrib = glGetAttribLocation(mpPointShader->getShaderProgram(), "posAttribute");
+        glEnableVertexAttribArray(pointPosAttrib);
+        glVertexAttribPointer(pointPosAttrib, 2, GL_FLOAT, GL_FALSE, GAZE_DRAWER_POINT_FLOATS * sizeof(float), (void*)0);
+        glVertexAttribDivisor(pointPosAttrib, 1);
+        GLuint diameterAttrib = glGetAttribLocation(mpPointShader->getShaderProgram(), "diameterAttribute");
+        glEnableVertexAttribArray(diameterAttrib);
+        glVertexAttribPointer(diameterAttrib, 1, GL_FLOAT, GL_FALSE, GAZE_DRAWER_POINT_FLOATS * sizeof(float), (void*)(2 * sizeof(float)));
+        glVertexAttribDivisor(diameterAttrib, 1);
+        GLuint pointAlphaAttrib = glGetAttribLocation(mpPointShader->getShaderProgram(), "alphaAttribute");
+        glEnableVertexAttribArray(pointAlphaAttrib);
+        glVertexAttribPointer(pointAlphaAttrib, 1, GL_FLOAT, GL_FALSE, GAZE_DRAWER_POINT_FLOATS * sizeof(float), (void*)(3 * sizeof(float)));
+        glVertexAttribDivisor(pointAlphaAttrib, 1);
+
+        // Restore old settings
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        glBindVertexArray(oldVAO);
     }
 
     GazeDrawer::~GazeDrawer()
     {
-        // Nothing to do
+        // Delete vertex array objects
+        glDeleteVertexArrays(1, &mTrailVertexArrayObject);
+        glDeleteVertexArrays(1, &mPointVertexArrayObject);
+
+        // Delete buffers
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteBuffers(1, &mQuadBuffer);
     }
 
     void GazeDrawer::update(int gazeX, int gazeY, float tpf)
@@ -98,97 +163,41 @@ namespace eyegui
         {
             mPoints.erase(mPoints.begin(), mPoints.begin() + pointsToRemoveIndex + 1);
         }
+
+        // Stream points to GPU once per update
+        fillVertexBuffer();
     }
 
     void GazeDrawer::draw() const
     {
-        // Get values from GUI
-        float GUIWidth = (float)(mpGUI->getWindowWidth());
-        float GUIHeight = (float)(mpGUI->getWindowHeight());
-
-        // Draw lines
-        mpLine->bind();
-
-        // Go over connections of gaze points
-        for(uint i = 0; i < mPoints.size() - 1; i++)
+        // Nothing to draw
+        if (mPointCount <= 0)
         {
-            // Calculate transformation values
-            glm::vec2 currentPoint = mPoints[i].point;
-            glm::vec2 nextPoint = mPoints[i+1].point;
-            float distance = glm::distance(currentPoint, nextPoint);
-
-            // Matrix
-            glm::mat4 matrix = glm::mat4(1.0f);
-
-            // Translation
-            matrix = glm::translate(
-                matrix,
-                glm::vec3(currentPoint.x / GUIWidth, 1.0f - (currentPoint.y / GUIHeight), 0));
-
-            // Scaling
-            matrix = glm::scale(matrix, glm::vec3(distance / GUIWidth, distance / GUIHeight, 1));
-
-            // Rotation
-            glm::vec2 vector = nextPoint-currentPoint;
-            float angle = glm::acos(glm::dot(glm::vec2(1,0), vector) / glm::length(vector));
-
-            // Decide direction of rotation
-            if(nextPoint.y > currentPoint.y)
-            {
-                angle = -angle;
-            }
-
-            matrix = glm::rotate(matrix, angle, glm::vec3(0,0,1));
-
-            // Projection
-            matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
-
-            mpLine->getShader()->fillValue("matrix", matrix);
-            mpLine->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpLine->getShader()->fillValue("alpha", mPoints[i].alpha.getValue());
-            mpLine->draw(GL_LINES);
+            return;
         }
 
-        // Draw focus cycles
-        mpCircle->bind();
-
-        // Draw all circles
-        for (const GazePoint& rGazePoint : mPoints)
-        {
-            // Width and height
-            int diameter = calculateDiameterOfGazePoint(rGazePoint);
-            float glWidth = diameter / GUIWidth;
-            float glHeight = diameter / GUIHeight;
-
-            // New matrix
-            glm::mat4 matrix = glm::mat4(1.0f);
-
-            // Translation
-            matrix = glm::translate(
-                matrix,
-                glm::vec3((rGazePoint.point.x - diameter / 2) / GUIWidth,
-                    (1.0f - ((rGazePoint.point.y - diameter / 2) / GUIHeight)) - glHeight,
-                    0));
-
-            // Scaling
-            matrix = glm::scale(matrix, glm::vec3(glWidth, glHeight, 1));
-
-            // Projection
-            matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
-
-            // Set values
-            mpCircle->getShader()->fillValue("matrix", matrix);
-            mpCircle->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpCircle->getShader()->fillValue("alpha", rGazePoint.alpha.getValue());
-
-            // Draw
-            mpCircle->draw();
-        }
+        // Resolution is same for both shaders
+        glm::vec2 resolution((float)(mpGUI->getWindowWidth()), (float)(mpGUI->getWindowHeight()));
+
+        // Draw lines between gaze points
+        mpTrailShader->bind();
+        mpTrailShader->fillValue(Shader::Uniform::RESOLUTION, resolution);
+        mpTrailShader->fillValue(Shader::Uniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+        glBindVertexArray(mTrailVertexArrayObject);
+        glDrawArrays(GL_LINE_STRIP, 0, mPointCount);
+
+        // Draw focus circles
+        mpPointShader->bind();
+        mpPointShader->fillValue(Shader::Uniform::RESOLUTION, resolution);
+        mpPointShader->fillValue(Shader::Uniform::COLOR, mpGUI->getConfig()->gazeVisualizationColor);
+        glBindVertexArray(mPointVertexArrayObject);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, mPointCount);
     }
 
     void GazeDrawer::reset()
     {
         mPoints.clear();
+        mPointCount = 0;
     }
 
     int GazeDrawer::calculateDiameterOfGazePoint(const GazePoint& rGazePoint) const
@@ -197,4 +206,29 @@ namespace eyegui
                 (rGazePoint.focus.getValue() * mMaxGazePointSize
                 + (1.0f - rGazePoint.focus.getValue()) * mMinGazePointSize));
     }
+
+    void GazeDrawer::fillVertexBuffer()
+    {
+        // Collect data of points in reused vector
+        mVertexData.resize(mPoints.size() * GAZE_DRAWER_POINT_FLOATS);
+        float* pData = mVertexData.data();
+        for (const GazePoint& rGazePoint : mPoints)
+        {
+            *(pData++) = rGazePoint.point.x;
+            *(pData++) = rGazePoint.point.y;
+            *(pData++) = (float)calculateDiameterOfGazePoint(rGazePoint);
+            *(pData++) = rGazePoint.alpha.getValue();
+        }
+        mPointCount = (GLsizei)mPoints.size();
+
+        // Upload data. Buffer only grows and old content is orphaned, so driver does not wait for last draw
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        GLsizeiptr size = (GLsizeiptr)(mVertexData.size() * sizeof(float));
+        mVertexBufferSize = std::max(size, mVertexBufferSize);
+        glBufferData(GL_ARRAY_BUFFER, mVertexBufferSize, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, mVertexData.data());
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    }
 }
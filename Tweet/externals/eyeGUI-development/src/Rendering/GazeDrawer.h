@@ -4,7 +4,8 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Visualizes gaze.
+// Visualizes gaze. Trail is streamed into one vertex buffer each update and
+// drawn as line strip and instanced circles.
 
 #ifndef GAZE_DRAWER_H_
 #define GAZE_DRAWER_H_
@@ -64,14 +65,24 @@ namespace eyegui
         // Calculate pixel diameter of gaze point
         int calculateDiameterOfGazePoint(const GazePoint& rGazePoint) const;
 
+        // Fill vertex buffer with current points
+        void fillVertexBuffer();
+
         // Members
         GUI const * mpGUI;
         AssetManager* mpAssetManager;
         std::vector<GazePoint> mPoints;
-        RenderItem const * mpCircle;
-        RenderItem const * mpLine;
+        Shader const * mpTrailShader;
+        Shader const * mpPointShader;
         int mMinGazePointSize;
         int mMaxGazePointSize;
+        std::vector<float> mVertexData; // position, diameter and alpha of each point, kept to avoid allocations
+        GLuint mVertexBuffer; // streamed each update
+        GLsizeiptr mVertexBufferSize; // in bytes
+        GLuint mQuadBuffer;
+        GLuint mTrailVertexArrayObject;
+        GLuint mPointVertexArrayObject;
+        GLsizei mPointCount; // count of points in vertex buffer
     };
 }
 
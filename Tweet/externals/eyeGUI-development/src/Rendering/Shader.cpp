@@ -10,10 +10,45 @@
 #include "externals/GLM/glm/gtc/type_ptr.hpp"
 #include "src/Utilities/OperationNotifier.h"
 
+#include <cstring>
 #include <fstream>
 
 namespace eyegui
 {
+    // Names of uniforms in shader sources, in order of enumeration
+    static const char* UNIFORM_NAMES[] =
+    {
+        "activity",
+        "alpha",
+        "atlas",
+        "color",
+        "dim",
+        "dimColor",
+        "highlight",
+        "highlightColor",
+        "icon",
+        "iconColor",
+        "iconUVScale",
+        "image",
+        "mark",
+        "markColor",
+        "mask",
+        "matrix",
+        "orientation",
+        "penetration",
+        "pick",
+        "pickColor",
+        "pressing",
+        "resolution",
+        "scale",
+        "selection",
+        "selectionColor",
+        "threshold",
+        "thresholdColor",
+        "time"
+    };
+    static_assert(sizeof(UNIFORM_NAMES) / sizeof(UNIFORM_NAMES[0]) == (size_t)Shader::Uniform::COUNT, "Each uniform needs a name");
+
     Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
     {
         // Vertex shader
@@ -57,8 +92,15 @@ namespace eyegui
             // Add end of string
             name[nameLength] = 0;
 
-            // Save mapping from name to location in map
-            mUniformLocationCache[name] = glGetUniformLocation(mShaderProgram, name);
+            // Save location at index of uniform, uniforms unknown to enumeration cannot be filled
+            for (int j = 0; j < (int)Uniform::COUNT; j++)
+            {
+                if (std::strcmp(name, UNIFORM_NAMES[j]) == 0)
+                {
+                    mUniforms[j].location = glGetUniformLocation(mShaderProgram, name);
+                    break;
+                }
+            }
         }
     }
 
@@ -72,34 +114,40 @@ namespace eyegui
         glUseProgram(mShaderProgram);
     }
 
-        void Shader::fillValue(std::string location, const int rValue) const
+    void Shader::fillValue(Uniform uniform, const int rValue) const
     {
-        glUniform1i(mUniformLocationCache.at(location), rValue);
+        GLint location = cacheValue(uniform, &rValue, sizeof(rValue));
+        if (location >= 0) { glUniform1i(location, rValue); }
     }
 
-    void Shader::fillValue(std::string location, const float rValue) const
+    void Shader::fillValue(Uniform uniform, const float rValue) const
     {
-        glUniform1fv(mUniformLocationCache.at(location), 1, &rValue);
+        GLint location = cacheValue(uniform, &rValue, sizeof(rValue));
+        if (location >= 0) { glUniform1fv(location, 1, &rValue); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec2& rValue) const
+    void Shader::fillValue(Uniform uniform, const glm::vec2& rValue) const
     {
-        glUniform2fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        GLint location = cacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+        if (location >= 0) { glUniform2fv(location, 1, glm::value_ptr(rValue)); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec3& rValue) const
+    void Shader::fillValue(Uniform uniform, const glm::vec3& rValue) const
     {
-        glUniform3fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        GLint location = cacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+        if (location >= 0) { glUniform3fv(location, 1, glm::value_ptr(rValue)); }
     }
 
-    void Shader::fillValue(std::string location, const glm::vec4& rValue) const
+    void Shader::fillValue(Uniform uniform, const glm::vec4& rValue) const
     {
-        glUniform4fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        GLint location = cacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+        if (location >= 0) { glUniform4fv(location, 1, glm::value_ptr(rValue)); }
     }
 
-    void Shader::fillValue(std::string location, const glm::mat4x4& rValue) const
+    void Shader::fillValue(Uniform uniform, const glm::mat4x4& rValue) const
     {
-        glUniformMatrix4fv(mUniformLocationCache.at(location), 1, GL_FALSE, glm::value_ptr(rValue));
+        GLint location = cacheValue(uniform, glm::value_ptr(rValue), sizeof(rValue));
+        if (location >= 0) { glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(rValue)); }
     }
 
     GLuint Shader::getShaderProgram() const
@@ -107,6 +155,25 @@ namespace eyegui
         return mShaderProgram;
     }
 
+    GLint Shader::cacheValue(Uniform uniform, void const * pValue, size_t size) const
+    {
+        // Uniforms not used by shader are ignored like OpenGL does for location -1
+        UniformCache& rUniform = mUniforms[(int)uniform];
+        if (rUniform.location < 0)
+        {
+            return -1;
+        }
+
+        // Uniform values stay in program, so upload is only necessary when value differs
+        if (rUniform.filled && std::memcmp(rUniform.value, pValue, size) == 0)
+        {
+            return -1;
+        }
+        std::memcpy(rUniform.value, pValue, size);
+        rUniform.filled = true;
+        return rUniform.location;
+    }
+
     void Shader::evaluateShaderLog(GLuint handle) const
     {
         // Get length of compiling log
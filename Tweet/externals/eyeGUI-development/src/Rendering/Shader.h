@@ -13,7 +13,6 @@
 #include "externals/GLM/glm/glm.hpp"
 
 #include <string>
-#include <map>
 
 namespace eyegui
 {
@@ -21,6 +20,40 @@ namespace eyegui
     {
     public:
 
+        // Uniforms used by internal shaders, resolved once after linking
+        enum class Uniform
+        {
+            ACTIVITY,
+            ALPHA,
+            ATLAS,
+            COLOR,
+            DIM,
+            DIM_COLOR,
+            HIGHLIGHT,
+            HIGHLIGHT_COLOR,
+            ICON,
+            ICON_COLOR,
+            ICON_UV_SCALE,
+            IMAGE,
+            MARK,
+            MARK_COLOR,
+            MASK,
+            MATRIX,
+            ORIENTATION,
+            PENETRATION,
+            PICK,
+            PICK_COLOR,
+            PRESSING,
+            RESOLUTION,
+            SCALE,
+            SELECTION,
+            SELECTION_COLOR,
+            THRESHOLD,
+            THRESHOLD_COLOR,
+            TIME,
+            COUNT
+        };
+
         // Constructor
         Shader(char const * const pVertexShader, char const * const pFragmentShader);
 
@@ -30,25 +63,37 @@ namespace eyegui
         // Bind shader for filling uniforms and rendering
         void bind() const;
 
-        // Fill value for rendering
-        void fillValue(std::string location, const int rValue) const;
-        void fillValue(std::string location, const float rValue) const;
-        void fillValue(std::string location, const glm::vec2& rValue) const;
-        void fillValue(std::string location, const glm::vec3& rValue) const;
-        void fillValue(std::string location, const glm::vec4& rValue) const;
-        void fillValue(std::string location, const glm::mat4x4& rValue) const;
+        // Fill value for rendering. Skipped if uniform has that value already or is not used by shader
+        void fillValue(Uniform uniform, const int rValue) const;
+        void fillValue(Uniform uniform, const float rValue) const;
+        void fillValue(Uniform uniform, const glm::vec2& rValue) const;
+        void fillValue(Uniform uniform, const glm::vec3& rValue) const;
+        void fillValue(Uniform uniform, const glm::vec4& rValue) const;
+        void fillValue(Uniform uniform, const glm::mat4x4& rValue) const;
 
         // Getter for handle
         GLuint getShaderProgram() const;
 
     private:
 
+        // Location and last filled value of uniform
+        struct UniformCache
+        {
+            GLint location = -1;
+            bool filled = false;
+            unsigned char value[sizeof(glm::mat4x4)];
+        };
+
         // Evaluate shader compiling log
         void evaluateShaderLog(GLuint handle) const;
 
+        // Remember value of uniform. Returns location if value has changed, else -1
+        GLint cacheValue(Uniform uniform, void const * pValue, size_t size) const;
+
         // Member
         GLuint mShaderProgram;
-        std::map<std::string, int> mUniformLocationCache;
+        mutable UniformCache mUniforms[(int)Uniform::COUNT]; // indexed by uniform
+
     };
 }
 
@@ -255,6 +255,54 @@ namespace eyegui
             "   float value = texture(atlas, uv).r;\n"
             "   fragColor = vec4(color.rgb, color.a * value);\n"
             "}\n";
+
+        static const char* pGazeTrailVertexShader =
+            "#version 330 core\n"
+            "in vec2 posAttribute;\n" // in pixels
+            "in float alphaAttribute;\n"
+            "out float pointAlpha;\n"
+            "uniform vec2 resolution;\n"
+            "void main() {\n"
+            "   pointAlpha = alphaAttribute;\n"
+            "   gl_Position = vec4(2.0 * posAttribute.x / resolution.x - 1.0, 1.0 - 2.0 * posAttribute.y / resolution.y, 0, 1);\n"
+            "}\n";
+
+        static const char* pGazeTrailFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in float pointAlpha;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
+            "void main() {\n"
+            "   fragColor = vec4(color.rgb, color.a * pointAlpha);\n"
+            "}\n";
+
+        static const char* pGazePointVertexShader =
+            "#version 330 core\n"
+            "in vec2 quadAttribute;\n" // per vertex
+            "in vec2 posAttribute;\n" // per instance, in pixels
+            "in float diameterAttribute;\n" // per instance, in pixels
+            "in float alphaAttribute;\n" // per instance
+            "out vec2 uv;\n"
+            "out float pointAlpha;\n"
+            "uniform vec2 resolution;\n"
+            "void main() {\n"
+            "   uv = quadAttribute;\n"
+            "   pointAlpha = alphaAttribute;\n"
+            "   vec2 pos = posAttribute + (quadAttribute - 0.5) * diameterAttribute;\n"
+            "   gl_Position = vec4(2.0 * pos.x / resolution.x - 1.0, 1.0 - 2.0 * pos.y / resolution.y, 0, 1);\n"
+            "}\n";
+
+        static const char* pGazePointFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "in float pointAlpha;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
+            "void main() {\n"
+            "   float gradient = length(2*uv-1);\n" // simple gradient as base
+            "   float circle = (1-gradient) * 75;\n" // extend gradient to unclamped circle
+            "   fragColor = vec4(color.rgb, color.a * pointAlpha * min(circle, 1.0));\n"
+            "}\n";
     }
 }
 
@@ -9,6 +9,14 @@
 
 #include "externals/utf8rewind/include/utf8rewind/utf8rewind.h"
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
 namespace eyegui
 {
     // ### HELPER HELPERS ###
@@ -379,4 +387,31 @@ namespace eyegui
             rInput += u"\n";
         }
     }
+
+    FileStamp getFileStamp(std::string fullFilepath)
+    {
+        FileStamp stamp;
+#ifdef _WIN32
+        // Last write time in 100 nanoseconds
+        WIN32_FILE_ATTRIBUTE_DATA info;
+        if (GetFileAttributesExA(fullFilepath.c_str(), GetFileExInfoStandard, &info))
+        {
+            stamp.modificationTime = ((long long)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+            stamp.size = ((long long)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+        }
+#else
+        // Modification time in nanoseconds, seconds alone would miss edits within the same second
+        struct stat info;
+        if (stat(fullFilepath.c_str(), &info) == 0)
+        {
+#ifdef __APPLE__
+            stamp.modificationTime = (long long)info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec;
+#else
+            stamp.modificationTime = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#endif
+            stamp.size = (long long)info.st_size;
+        }
+#endif
+        return stamp;
+    }
 }
@@ -44,6 +44,17 @@ namespace eyegui
     // Streamline LF, CR and CR+LF endings to LF
     void streamlineLineEnding(std::string& rInput, bool addNewLineAtEnd = false);
     void streamlineLineEnding(std::u16string& rInput, bool addNewLineAtEnd = false);
+
+    // Modification time with sub-second resolution and size of file, both zero if file does not exist
+    struct FileStamp
+    {
+        long long modificationTime = 0;
+        long long size = 0;
+
+        bool operator==(FileStamp const & rOther) const { return modificationTime == rOther.modificationTime && size == rOther.size; }
+        bool operator!=(FileStamp const & rOther) const { return !(*this == rOther); }
+    };
+    FileStamp getFileStamp(std::string fullFilepath);
 }
 
 #endif // HELPER_H_
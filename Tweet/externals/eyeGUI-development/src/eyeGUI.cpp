@@ -159,6 +159,26 @@ namespace eyegui
         pLayout->setElementActivity(id, active, fade);
     }
 
+    ElementHandle fetchElementHandle(Layout* pLayout, std::string id)
+    {
+        return pLayout->fetchElementHandle(id);
+    }
+
+    std::string const & getElementId(Layout const * pLayout, ElementHandle handle)
+    {
+        return pLayout->getElementId(handle);
+    }
+
+    void setElementActivity(Layout* pLayout, ElementHandle handle, bool active, bool fade)
+    {
+        pLayout->setElementActivity(handle, active, fade);
+    }
+
+    bool isElementActive(Layout const * pLayout, ElementHandle handle)
+    {
+        return pLayout->isElementActive(handle);
+    }
+
     void toggleElementActivity(Layout* pLayout, std::string id, bool fade)
     {
         pLayout->setElementActivity(id, !pLayout->isElementActive(id), fade);
@@ -194,6 +214,14 @@ namespace eyegui
         pLayout->setStyleOfElement(id, style);
     }
 
+    void setStyleOfElement(
+        Layout* pLayout,
+        ElementHandle handle,
+        std::string style)
+    {
+        pLayout->setStyleOfElement(handle, style);
+    }
+
     bool isElementDimming(Layout const * pLayout, std::string id)
     {
         return pLayout->isElementDimming(id);
@@ -329,6 +357,21 @@ namespace eyegui
         pLayout->setContentOfTextBlock(id, content);
     }
 
+    TextBlockHandle fetchTextBlockHandle(Layout* pLayout, std::string id)
+    {
+        return pLayout->fetchTextBlockHandle(id);
+    }
+
+    void setContentOfTextBlock(Layout* pLayout, TextBlockHandle handle, std::u16string content)
+    {
+        pLayout->setContentOfTextBlock(handle, content);
+    }
+
+    void setContentOfTextBlock(Layout* pLayout, TextBlockHandle handle, std::string content)
+    {
+        pLayout->setContentOfTextBlock(handle, content);
+    }
+
     void setKeyOfTextBlock(Layout* pLayout, std::string id, std::string key)
     {
         pLayout->setKeyOfTextBlock(id, key);
@@ -409,6 +452,16 @@ namespace eyegui
         pLayout->registerButtonListener(id, wpListener);
     }
 
+    void registerButtonCallbacks(
+        Layout* pLayout,
+        std::string id,
+        std::function<void()> hitCallback,
+        std::function<void()> downCallback,
+        std::function<void()> upCallback)
+    {
+        pLayout->registerButtonCallbacks(id, hitCallback, downCallback, upCallback);
+    }
+
     void registerSensorListener(Layout* pLayout, std::string id, std::weak_ptr<SensorListener> wpListener)
     {
         pLayout->registerSensorListener(id, wpListener);
@@ -7,115 +7,162 @@
 #include "src/Keyboard/Keyboard.h"
 
 /**
-* ActionBarButton hit function
-* When a Button is hit, different functions of some Classes will be used
+* registerCallbacks function
+* Registers one callback per Button of the ActionBar
+* Buttons which need a connection only work while there is one
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void ActionBarButton::hit(eyegui::Layout* pLayout, std::string id)
+void ActionBarButton::registerCallbacks(eyegui::Layout* pLayout)
 {
-    if (TwitterApp::getInstance()->hasConnection()) {
-        std::cout << id + " has been hit" << std::endl;
-
-
-        if (id.compare("likeButton") == 0) {
-
-            std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-            TwitterApp::getInstance()->getTwitter()->createFavorites(tweetid);
-            TwitterApp::getInstance()->updateCurrentPage();
-        }
-        if (id.compare("writePNButton") == 0) {
-                        Keyboard::getInstance()->activate();
-            Keyboard::getInstance()->setCas(3);
-            Keyboard::getInstance()->setPointer(keyWord);
-        }
-
-        if (id.compare("dislikeButton") == 0) {
-
-            std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-            TwitterApp::getInstance()->getTwitter()->destroyFavorites(tweetid);
-            TwitterApp::getInstance()->updateCurrentPage();
-        }
-
-        if (id.compare("goToProfileButton") == 0) {
-
-
-            std::string userID = TwitterApp::getInstance()->actionButtonArea->userId;
-            TwitterApp::getInstance()->profileContentArea->setCurProfile(userID);
-
-            TwitterApp::getInstance()->changeState(PROFILE);
+    eyegui::registerButtonCallbacks(pLayout, "likeButton", [this]() { if (TwitterApp::getInstance()->hasConnection()) { like(); } });
+    eyegui::registerButtonCallbacks(pLayout, "dislikeButton", [this]() { if (TwitterApp::getInstance()->hasConnection()) { dislike(); } });
+    eyegui::registerButtonCallbacks(pLayout, "followButton", [this]() { follow(); });
+    eyegui::registerButtonCallbacks(pLayout, "unfollowButton", [this]() { unfollow(); });
+    eyegui::registerButtonCallbacks(pLayout, "goToProfileButton", [this]() { if (TwitterApp::getInstance()->hasConnection()) { goToProfile(); } });
+    eyegui::registerButtonCallbacks(pLayout, "retweetButton", [this]() { retweet(); });
+    eyegui::registerButtonCallbacks(pLayout, "respondButton", [this]() { if (TwitterApp::getInstance()->hasConnection()) { respond(); } });
+    eyegui::registerButtonCallbacks(pLayout, "deleteButton", [this]() { deleteTweet(); });
+    eyegui::registerButtonCallbacks(pLayout, "searchForButton", [this]() { searchFor(); });
+    eyegui::registerButtonCallbacks(pLayout, "showImageButton", [this]() { if (TwitterApp::getInstance()->hasConnection()) { showImage(); } });
+    eyegui::registerButtonCallbacks(
+        pLayout,
+        "writePNButton",
+        [this]() { if (TwitterApp::getInstance()->hasConnection()) { writePN(); } },
+        nullptr,
+        [this]() { sendPN(); });
+}
 
-        }
+/**
+* like function
+* Likes the selected Tweet
+*/
+void ActionBarButton::like()
+{
+    std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
+    TwitterApp::getInstance()->getTwitter()->createFavorites(tweetid);
+    TwitterApp::getInstance()->updateCurrentPage();
+}
 
-        if (id.compare("showImageButton") == 0) {
+/**
+* writePN function
+* Opens the Keyboard to write a direct message
+*/
+void ActionBarButton::writePN()
+{
+    Keyboard::getInstance()->activate();
+    Keyboard::getInstance()->setCas(3);
+    Keyboard::getInstance()->setPointer(keyWord);
+}
 
-            std::cout << "Image with " + TwitterApp::getInstance()->actionButtonArea->imageUrls +" is being displayed"<< std::endl;
-            TwitterApp::getInstance()->actionButtonArea->openImageFrame();
+/**
+* sendPN function
+* After the Keyboardclass was used the button goes up and a direct message will be posted
+*/
+void ActionBarButton::sendPN()
+{
+    TwitterApp::getInstance()->getTwitter()->sendDirectMessage(keyWord, TwitterApp::getInstance()->actionButtonArea->userId, true);
+    keyWord="";
+}
 
-        }
+/**
+* dislike function
+* Removes the like of the selected Tweet
+*/
+void ActionBarButton::dislike()
+{
+    std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
+    TwitterApp::getInstance()->getTwitter()->destroyFavorites(tweetid);
+    TwitterApp::getInstance()->updateCurrentPage();
+}
 
-        if (id.compare("respondButton") == 0) {
-            std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-            Keyboard::getInstance()->activate();
-            Keyboard::getInstance()->setCas(2);
-            Keyboard::getInstance()->setId(tweetid);
-            TwitterApp::getInstance()->updateCurrentPage();
+/**
+* goToProfile function
+* Shows the profile of the selected user
+*/
+void ActionBarButton::goToProfile()
+{
+    std::string userID = TwitterApp::getInstance()->actionButtonArea->userId;
+    TwitterApp::getInstance()->profileContentArea->setCurProfile(userID);
 
+    TwitterApp::getInstance()->changeState(PROFILE);
+}
 
-        }
-    }
+/**
+* showImage function
+* Opens the images of the selected Tweet
+*/
+void ActionBarButton::showImage()
+{
+    std::cout << "Image with " + TwitterApp::getInstance()->actionButtonArea->imageUrls +" is being displayed"<< std::endl;
+    TwitterApp::getInstance()->actionButtonArea->openImageFrame();
+}
 
-    if (id.compare("followButton") == 0) {
-        TwitterApp::getInstance()->getTwitter()->createFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
-        TwitterApp::getInstance()->updateCurrentPage();
+/**
+* respond function
+* Opens the Keyboard to respond to the selected Tweet
+*/
+void ActionBarButton::respond()
+{
+    std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
+    Keyboard::getInstance()->activate();
+    Keyboard::getInstance()->setCas(2);
+    Keyboard::getInstance()->setId(tweetid);
+    TwitterApp::getInstance()->updateCurrentPage();
+}
 
-    }
-    if (id.compare("searchForButton") == 0) {
-        TwitterApp::getInstance()->searchPageArea->setKeyWord(TwitterApp::getInstance()->actionButtonArea->userId);
-        if (TwitterApp::getInstance()->searchPageArea->userSearch)
-        {
-            TwitterApp::getInstance()->searchPageArea->switchSearch();
-        }
-        TwitterApp::getInstance()->changeState(SEARCH);
-        TwitterApp::getInstance()->searchPageArea->search();
+/**
+* follow function
+* Follows the selected user
+*/
+void ActionBarButton::follow()
+{
+    TwitterApp::getInstance()->getTwitter()->createFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
+    TwitterApp::getInstance()->updateCurrentPage();
+}
 
+/**
+* searchFor function
+* Searches for the selected user
+*/
+void ActionBarButton::searchFor()
+{
+    TwitterApp::getInstance()->searchPageArea->setKeyWord(TwitterApp::getInstance()->actionButtonArea->userId);
+    if (TwitterApp::getInstance()->searchPageArea->userSearch)
+    {
+        TwitterApp::getInstance()->searchPageArea->switchSearch();
     }
-    if (id.compare("unfollowButton") == 0) {
-        TwitterApp::getInstance()->getTwitter()->destroyFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
-        TwitterApp::getInstance()->updateCurrentPage();
+    TwitterApp::getInstance()->changeState(SEARCH);
+    TwitterApp::getInstance()->searchPageArea->search();
+}
 
-    }
-    if (id.compare("retweetButton") == 0) {
-        std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-        TwitterApp::getInstance()->getTwitter()->retweet(tweetid);
-        TwitterApp::getInstance()->updateCurrentPage();
-    }
-    if (id.compare("deleteButton") == 0) {
-        std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
-        TwitterApp::getInstance()->getTwitter()->statusDestroy(tweetid);
-        TwitterApp::getInstance()->updateCurrentPage();
-    }
+/**
+* unfollow function
+* Unfollows the selected user
+*/
+void ActionBarButton::unfollow()
+{
+    TwitterApp::getInstance()->getTwitter()->destroyFriendship(TwitterApp::getInstance()->actionButtonArea->userId, true);
+    TwitterApp::getInstance()->updateCurrentPage();
 }
 
 /**
-* ActionBarButton down function
-* Function not in use
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* retweet function
+* Retweets the selected Tweet
 */
-void ActionBarButton::down(eyegui::Layout* pLayout, std::string id) {
+void ActionBarButton::retweet()
+{
+    std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
+    TwitterApp::getInstance()->getTwitter()->retweet(tweetid);
+    TwitterApp::getInstance()->updateCurrentPage();
 }
 
 /**
-* ActionBarButto up function
-* After a Button is hit and it goes up a different functions of some Classes will be used
-* Here after the Keyboardclass was used the button goes up and a direct message will be posted
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* deleteTweet function
+* Deletes the selected Tweet
 */
-void ActionBarButton::up(eyegui::Layout* pLayout, std::string id) {
-        if (id.compare("writePNButton") == 0) {
-            TwitterApp::getInstance()->getTwitter()->sendDirectMessage(keyWord, TwitterApp::getInstance()->actionButtonArea->userId, true);
-            keyWord="";
-        }
+void ActionBarButton::deleteTweet()
+{
+    std::string tweetid = TwitterApp::getInstance()->actionButtonArea->tweetId;
+    TwitterApp::getInstance()->getTwitter()->statusDestroy(tweetid);
+    TwitterApp::getInstance()->updateCurrentPage();
 }
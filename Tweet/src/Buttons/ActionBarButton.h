@@ -7,13 +7,25 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
 
-class ActionBarButton :public eyegui::ButtonListener {
+class ActionBarButton {
 
 public:
 
     std::string keyWord="";
-    void virtual hit(eyegui::Layout* pLayout, std::string id);
-    void virtual up(eyegui::Layout* pLayout, std::string id);
-    void virtual down(eyegui::Layout* pLayout, std::string id);
-};
+    void registerCallbacks(eyegui::Layout* pLayout);
+
+private:
 
+    void like();
+    void writePN();
+    void sendPN();
+    void dislike();
+    void goToProfile();
+    void showImage();
+    void respond();
+    void follow();
+    void searchFor();
+    void unfollow();
+    void retweet();
+    void deleteTweet();
+};
@@ -2,43 +2,36 @@
 // Distributed under the Apache License, Version 2.0.
 //============================================================================
 
-#include "WallButton.h"
+#include "ConnectButton.h"
 #include "src/TwitterApp.h"
 
 /**
-* Connect button hit function
-* When a Button is hit, different functions of the Class will be used
+* Connect button registerCallbacks function
+* Registers the callback of a Button, which selects the content with the id of the Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* @param[in] id is the id of the Button
 */
-void ConnectButton::hit(eyegui::Layout* pLayout, std::string id)
+void ConnectButton::registerCallbacks(eyegui::Layout* pLayout, std::string id)
 {
-
-    if (TwitterApp::getInstance()->currentstate == CONNECT) {
-        if ((id.compare("receivedButton") == 0)|| (id.compare("sentButton") == 0)) {
-            TwitterApp::getInstance()->connectPageArea->switchStatus();
-        }
-        else {
+    eyegui::registerButtonCallbacks(pLayout, id, [id]() {
+        if (TwitterApp::getInstance()->currentstate == CONNECT) {
             TwitterApp::getInstance()->connectPageArea->selectContent(id);
         }
-    }
+    });
 }
 
 /**
-* Connect button down function
-* no content
+* Connect button registerSwitchCallbacks function
+* Registers the callbacks of the Buttons, which switch between received and sent messages
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void ConnectButton::down(eyegui::Layout* pLayout, std::string id) {
-}
-
-/**
-* Connect button up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void ConnectButton::up(eyegui::Layout* pLayout, std::string id) {
+void ConnectButton::registerSwitchCallbacks(eyegui::Layout* pLayout)
+{
+    for (const char* id : { "sentButton", "receivedButton" }) {
+        eyegui::registerButtonCallbacks(pLayout, id, []() {
+            if (TwitterApp::getInstance()->currentstate == CONNECT) {
+                TwitterApp::getInstance()->connectPageArea->switchStatus();
+            }
+        });
+    }
 }
-
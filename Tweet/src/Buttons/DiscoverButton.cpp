@@ -6,34 +6,16 @@
 #include "src/TwitterApp.h"
 
 /**
-* DiscoverButton hit function
-* When a Button is hit, different functions of the Class will be used
+* DiscoverButton registerCallbacks function
+* Registers the callback of a Button, which selects the content with the id of the Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* @param[in] id is the id of the Button
 */
-void DiscoverButton::hit(eyegui::Layout* pLayout, std::string id)
+void DiscoverButton::registerCallbacks(eyegui::Layout* pLayout, std::string id)
 {
-    if (TwitterApp::getInstance()->currentstate == DISCOVER) {
-        TwitterApp::getInstance()->discoverPageArea->selectTweet(id);
-    }
-
-}
-
-/**
-* DiscoverButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void DiscoverButton::down(eyegui::Layout* pLayout, std::string id) {
+    eyegui::registerButtonCallbacks(pLayout, id, [id]() {
+        if (TwitterApp::getInstance()->currentstate == DISCOVER) {
+            TwitterApp::getInstance()->discoverPageArea->selectTweet(id);
+        }
+    });
 }
-
-/**
-* DiscoverButton up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void DiscoverButton::up(eyegui::Layout* pLayout, std::string id) {
-}
-
@@ -6,39 +6,19 @@
 #include "src/TwitterApp.h"
 
 /**
-* ImageFrameButton hit function
-* When a Button is hit, different functions of the Class will be used
+* ImageFrameButton registerCallbacks function
+* Registers one callback per Button of the image frame
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void ImageFrameButton::hit(eyegui::Layout* pLayout, std::string id)
+void ImageFrameButton::registerCallbacks(eyegui::Layout* pLayout)
 {
-    if (id.compare("unshowImage") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, "unshowImage", []() {
         TwitterApp::getInstance()->actionButtonArea->closeImageFrame();
-    }
-    if (id.compare("imageLeft") == 0) {
+    });
+    eyegui::registerButtonCallbacks(pLayout, "imageLeft", []() {
         TwitterApp::getInstance()->actionButtonArea->scrollPics(-1);
-    }
-    if (id.compare("imageRight") == 0) {
+    });
+    eyegui::registerButtonCallbacks(pLayout, "imageRight", []() {
         TwitterApp::getInstance()->actionButtonArea->scrollPics(1);
-    }
+    });
 }
-
-/**
-* ImageFrameButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void ImageFrameButton::down(eyegui::Layout* pLayout, std::string id) {
-}
-
-/**
-* ImageFrameButton up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void ImageFrameButton::up(eyegui::Layout* pLayout, std::string id) {
-}
-
@@ -7,11 +7,9 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
 
-class ImageFrameButton :public eyegui::ButtonListener {
+class ImageFrameButton {
 
 public:
 
-    void virtual hit(eyegui::Layout* pLayout, std::string id);
-    void virtual up(eyegui::Layout* pLayout, std::string id);
-    void virtual down(eyegui::Layout* pLayout, std::string id);
+    void registerCallbacks(eyegui::Layout* pLayout);
 };
@@ -6,13 +6,17 @@
 
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
+#include <initializer_list>
 
-class KeyboardButton :public eyegui::ButtonListener {
+class KeyboardButton {
 
 public:
 
-    void virtual hit(eyegui::Layout* pLayout, std::string id);
-    void virtual up(eyegui::Layout* pLayout, std::string id);
-    void virtual down(eyegui::Layout* pLayout, std::string id);
-};
+    void registerCallbacks(eyegui::Layout* pLayout2);
+
+private:
 
+    void registerKeys(eyegui::Layout* pLayout2, std::initializer_list<const char*> ids, std::function<void()> callback);
+    static void write(std::string value);
+    static void enter();
+};
@@ -7,79 +7,68 @@
 #include "src/Keyboard/Keyboard.h"
 
 /**
-* MenueBarButton hit function
-* When a Button is hit, different functions of the Class will be used
+* MenueBarButton registerCallbacks function
+* Registers one callback per Button of the MenueBar
 * the functionality for the menuebarbuttons is implemented here
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void MenueBarButton::hit(eyegui::Layout* pLayout, std::string id)
+void MenueBarButton::registerCallbacks(eyegui::Layout* pLayout)
 {
     //functionality for the Back Button
-    if (id.compare("back_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, BACK_BUTTON, []() {
         std::cout << "Back-Button hit" << std::endl;
         TwitterApp::getInstance()->terminate = true;
-    }
-
-
-        //functionality for the Wall Button
-        if (id.compare("toTheTopButton") == 0) {
-            std::cout << "toTheTopButton hit" << std::endl;
-            TwitterApp::getInstance()->toTheTop();
-        }
+    });
 
     //functionality for the Wall Button
-    if (id.compare("wall_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, WALL_BUTTON, []() {
         std::cout << "Wall-Button hit" << std::endl;
         TwitterApp::getInstance()->changeState(WALL);
-    }
+    });
 
     //functionality for the Connect Button
-    if (id.compare("connect_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, CONNECT_BUTTON, []() {
         std::cout << "Connect-Button hit" << std::endl;
         TwitterApp::getInstance()->changeState(CONNECT);
-    }
+    });
 
     //functionality for the Discover Button
-    if (id.compare("discover_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, DISCOVER_BUTTON, []() {
         std::cout << "Discover-Button hit" << std::endl;
         TwitterApp::getInstance()->changeState(DISCOVER);
-    }
+    });
 
     //functionality for the Profile Button
-    if (id.compare("profile_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, PROFILE_BUTTON, []() {
         std::cout << "Profile-Button hit" << std::endl;
         TwitterApp::getInstance()->profileContentArea->setCurProfile(TwitterApp::getInstance()->userID);
         TwitterApp::getInstance()->changeState(PROFILE);
-    }
+    });
 
     //functionality for the Search Button
-    if (id.compare("search_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, SEARCH_BUTTON, []() {
         std::cout << "Search-Button hit" << std::endl;
         TwitterApp::getInstance()->changeState(SEARCH);
-    }
+    });
 
     //functionality for the Tweet Button
-    if (id.compare("tweet_button") == 0) {
+    eyegui::registerButtonCallbacks(pLayout, TWEET_BUTTON, []() {
         Keyboard::getInstance()->activate();
         Keyboard::getInstance()->setCas(1);
-    }
-}
+    });
 
-/**
-* MenueBarButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void MenueBarButton::down(eyegui::Layout* pLayout, std::string id) {
+    registerToTheTopCallback(pLayout);
 }
 
 /**
-* MenueBarButton up function
-* no content
+* MenueBarButton registerToTheTopCallback function
+* Registers the callback of the toTheTopButton, which is replaced by some pages
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void MenueBarButton::up(eyegui::Layout* pLayout, std::string id) {
+void MenueBarButton::registerToTheTopCallback(eyegui::Layout* pLayout)
+{
+    eyegui::registerButtonCallbacks(pLayout, "toTheTopButton", []() {
+        std::cout << "toTheTopButton hit" << std::endl;
+        TwitterApp::getInstance()->toTheTop();
+    });
 }
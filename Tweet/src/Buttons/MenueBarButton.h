@@ -7,11 +7,10 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
 
-class MenueBarButton:public eyegui::ButtonListener {
+class MenueBarButton {
 
 public:
 
-    void virtual hit(eyegui::Layout* pLayout, std::string id);
-    void virtual up(eyegui::Layout* pLayout, std::string id);
-    void virtual down(eyegui::Layout* pLayout, std::string id);
+    void registerCallbacks(eyegui::Layout* pLayout);
+    void registerToTheTopCallback(eyegui::Layout* pLayout);
 };
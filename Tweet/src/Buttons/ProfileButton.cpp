@@ -6,34 +6,16 @@
 #include "src/TwitterApp.h"
 
 /**
-* ProfileButton hit function
-* When a Button is hit, different functions of the Class will be used
+* ProfileButton registerCallbacks function
+* Registers the callback of a Button, which selects the content with the id of the Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* @param[in] id is the id of the Button
 */
-void ProfileButton::hit(eyegui::Layout* pLayout, std::string id)
+void ProfileButton::registerCallbacks(eyegui::Layout* pLayout, std::string id)
 {
-    if (TwitterApp::getInstance()->currentstate == PROFILE) {
-        TwitterApp::getInstance()->profileContentArea->selectContent(id);
-    }
-
-}
-
-/**
-* ProfileButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void ProfileButton::down(eyegui::Layout* pLayout, std::string id) {
+    eyegui::registerButtonCallbacks(pLayout, id, [id]() {
+        if (TwitterApp::getInstance()->currentstate == PROFILE) {
+            TwitterApp::getInstance()->profileContentArea->selectContent(id);
+        }
+    });
 }
-
-/**
-* ProfileButton up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void ProfileButton::up(eyegui::Layout* pLayout, std::string id) {
-}
-
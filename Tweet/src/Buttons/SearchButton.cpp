@@ -6,54 +6,52 @@
 #include "src/TwitterApp.h"
 
 /**
-* SearchButton hit function
-* When a Button is hit, different functions of the Class will be used
+* SearchButton registerCallbacks function
+* Registers the callback of a Button, which selects the content with the id of the Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* @param[in] id is the id of the Button
 */
-void SearchButton::hit(eyegui::Layout* pLayout, std::string id)
+void SearchButton::registerCallbacks(eyegui::Layout* pLayout, std::string id)
 {
-    if (TwitterApp::getInstance()->currentstate == SEARCH) {
-        if (id.compare("searchKeyboard") == 0) {
-            Keyboard::getInstance()->activate();
-            Keyboard::getInstance()->setCas(3);
-            Keyboard::getInstance()->setPointer(keyWord);
-        }
-        else if (id.compare("profileSearchButton") == 0) {
-            TwitterApp::getInstance()->searchPageArea->switchSearch();
-        }
-        else if (id.compare("tweetSearchButton") == 0) {
-            TwitterApp::getInstance()->searchPageArea->switchSearch();
-        }
-        else {
+    eyegui::registerButtonCallbacks(pLayout, id, [id]() {
+        if (TwitterApp::getInstance()->currentstate == SEARCH) {
             TwitterApp::getInstance()->searchPageArea->selectContent(id);
         }
-    }
-}
-
-/**
-* SearchButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void SearchButton::down(eyegui::Layout* pLayout, std::string id) {
+    });
 }
 
 /**
-* SearchButton up function
-* no content
+* SearchButton registerSearchCallbacks function
+* Registers the callbacks of the Buttons, which enter the keyword and switch between tweet and profile search
+* After the Keyboardclass was used the keyboard button goes up and the search is started
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void SearchButton::up(eyegui::Layout* pLayout, std::string id) {
-    if (id.compare("searchKeyboard") == 0) {
-        if (keyWord.compare(""))
-        {
-            TwitterApp::getInstance()->searchPageArea->setKeyWord(keyWord);
-            TwitterApp::getInstance()->searchPageArea->search();
-        }
-    keyWord = "";
+void SearchButton::registerSearchCallbacks(eyegui::Layout* pLayout)
+{
+    eyegui::registerButtonCallbacks(
+        pLayout,
+        "searchKeyboard",
+        [this]() {
+            if (TwitterApp::getInstance()->currentstate == SEARCH) {
+                Keyboard::getInstance()->activate();
+                Keyboard::getInstance()->setCas(3);
+                Keyboard::getInstance()->setPointer(keyWord);
+            }
+        },
+        nullptr,
+        [this]() {
+            if (keyWord.compare(""))
+            {
+                TwitterApp::getInstance()->searchPageArea->setKeyWord(keyWord);
+                TwitterApp::getInstance()->searchPageArea->search();
+            }
+            keyWord = "";
+        });
+    for (const char* id : { "tweetSearchButton", "profileSearchButton" }) {
+        eyegui::registerButtonCallbacks(pLayout, id, []() {
+            if (TwitterApp::getInstance()->currentstate == SEARCH) {
+                TwitterApp::getInstance()->searchPageArea->switchSearch();
+            }
+        });
     }
 }
-
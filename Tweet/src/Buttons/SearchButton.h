@@ -7,12 +7,11 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
 
-class SearchButton :public eyegui::ButtonListener {
+class SearchButton {
 
 public:
 
     std::string keyWord="";
-    void virtual hit(eyegui::Layout* pLayout, std::string id);
-    void virtual up(eyegui::Layout* pLayout, std::string id);
-    void virtual down(eyegui::Layout* pLayout, std::string id);
+    void registerCallbacks(eyegui::Layout* pLayout, std::string id);
+    void registerSearchCallbacks(eyegui::Layout* pLayout);
 };
@@ -6,39 +6,16 @@
 #include "src/TwitterApp.h"
 
 /**
-* SwitchButton hit function
-* When a Button is hit, different functions of the Class will be used
+* SwitchButton registerCallbacks function
+* Registers one callback per switch Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void SwitchButton::hit(eyegui::Layout* pLayout, std::string id)
+void SwitchButton::registerCallbacks(eyegui::Layout* pLayout)
 {
-
-    if (id.compare(LEFT_SWITCH_BUTTON_AREA) == 0) {
+    eyegui::registerButtonCallbacks(pLayout, LEFT_SWITCH_BUTTON_AREA, []() {
         TwitterApp::getInstance()->scrollDown();
-    }
-
-    if (id.compare(RIGHT_SWITCH_BUTTON_AREA) == 0) {
+    });
+    eyegui::registerButtonCallbacks(pLayout, RIGHT_SWITCH_BUTTON_AREA, []() {
         TwitterApp::getInstance()->scrollUp();
-    }
-
-}
-
-/**
-* SwitchButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void SwitchButton::down(eyegui::Layout* pLayout, std::string id) {
+    });
 }
-
-/**
-* SwitchButton up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void SwitchButton::up(eyegui::Layout* pLayout, std::string id) {
-}
-
@@ -6,34 +6,16 @@
 #include "src/TwitterApp.h"
 
 /**
-* WallButton hit function
-* When a Button is hit, different functions of the Class will be used
+* WallButton registerCallbacks function
+* Registers the callback of a Button, which selects the content with the id of the Button
 * @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
+* @param[in] id is the id of the Button
 */
-void WallButton::hit(eyegui::Layout* pLayout, std::string id)
+void WallButton::registerCallbacks(eyegui::Layout* pLayout, std::string id)
 {
-    if (TwitterApp::getInstance()->currentstate==WALL) {
-        TwitterApp::getInstance()->wallContentArea->selectTweet(id);
-    }
-
-}
-
-/**
-* WallButton down function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void WallButton::down(eyegui::Layout* pLayout, std::string id) {
+    eyegui::registerButtonCallbacks(pLayout, id, [id]() {
+        if (TwitterApp::getInstance()->currentstate == WALL) {
+            TwitterApp::getInstance()->wallContentArea->selectTweet(id);
+        }
+    });
 }
-
-/**
-* WallButton up function
-* no content
-* @param[in] pLayout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void WallButton::up(eyegui::Layout* pLayout, std::string id) {
-}
-
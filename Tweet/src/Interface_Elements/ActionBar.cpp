@@ -3,7 +3,7 @@
 //============================================================================
 
 #include "ActionBar.h"
-#include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 
 /**
 * Constructor for the ActionBar Class
@@ -30,17 +30,7 @@ void ActionBar::instanciateAllActionButtons() {
     searchForButton = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/searchForButton.beyegui", buttonX, buttonY + 6 * buttonGap, buttonWidth, buttonHeight);
     showImageButton = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/showImageButton.beyegui", buttonX, buttonY + 6 * buttonGap, buttonWidth, buttonHeight);
     writePNButton = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/writePNButton.beyegui", buttonX, buttonY + 6 * buttonGap, buttonWidth, buttonHeight);
-    eyegui::registerButtonListener(pLayout, "likeButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "dislikeButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "followButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "unfollowButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "goToProfileButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "retweetButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "respondButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "deleteButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "searchForButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "showImageButton", actionButtonListener);
-    eyegui::registerButtonListener(pLayout, "writePNButton", actionButtonListener);
+    actionButtonListener->registerCallbacks(pLayout);
     makeButtonsInvisible();
 }
 
@@ -174,9 +164,7 @@ void ActionBar::openImageFrame() {
     closeImageFrame();
     imageBackground = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/Utility/imageBackground.beyegui", 0.0f, 0.f, 1.f, 1.f);
     imageFrame = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/Utility/actionbuttonbrick.beyegui", 0.0f, 0.f, 1.f, 1.f);
-    eyegui::registerButtonListener(pLayout, "unshowImage", imageFrameButtonListener);
-    eyegui::registerButtonListener(pLayout, "imageLeft", imageFrameButtonListener);
-    eyegui::registerButtonListener(pLayout, "imageRight", imageFrameButtonListener);
+    imageFrameButtonListener->registerCallbacks(pLayout);
     picIndex = 0;
     renewImage();
     imageFrameOpen = true;
@@ -188,20 +176,18 @@ void ActionBar::openImageFrame() {
 */
 void ActionBar::renewImage() {
 
-    // Download avatar image:
-    std::string str = mediaLinks.at(picIndex);
+    // Show media image, downloaded in background
+    ImageCache::getInstance()->showInPicture(pLayout, "shownPicture", mediaLinks.at(picIndex));
 
-    // Extract file extension
-    size_t i = str.rfind('.', str.length());
-    std::string ext = str.substr(i + 1, str.length() - i);
-
-    // Set filename using this rule: profile_ + Profile ID + extension
-    std::string filename = "img/tmp/picture_" + str.substr(str.size() - 9, str.size() - 5) + "." + ext;
-
-    std::string path = CONTENT_PATH + std::string("/") + filename;
-    download_image((char*)str.c_str(), (char*)path.c_str());
-    eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-    eyegui::replaceElementWithPicture(pLayout, "shownPicture", filename, alignment, false);
+    // Prefetch neighboring images for scrolling
+    if (picIndex > 0)
+    {
+        ImageCache::getInstance()->prefetch(mediaLinks.at(picIndex - 1));
+    }
+    if (picIndex + 1 < (int)mediaLinks.size())
+    {
+        ImageCache::getInstance()->prefetch(mediaLinks.at(picIndex + 1));
+    }
 }
 
 /**
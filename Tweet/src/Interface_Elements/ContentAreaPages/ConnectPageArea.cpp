@@ -4,7 +4,7 @@
 
 #include "ConnectPageArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/imageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 #include <string>
 
 /**
@@ -28,12 +28,11 @@ void ConnectPageArea::show() {
 		{
 			textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
 			buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
-			eyegui::registerButtonListener(pLayout, std::to_string(i), connectButtonListener);
+			connectButtonListener->registerCallbacks(pLayout, std::to_string(i));
 		}
 		buttonFrames[4]=eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/receivedButton.beyegui", 0.0f, 0.26f, 0.125f, 0.101f);
 		buttonFrames[5]=eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ConnectPageArea/sentButton.beyegui", 0.0f, 0.39f, 0.125f, 0.101f);
-		eyegui::registerButtonListener(pLayout, "sentButton", connectButtonListener);
-		eyegui::registerButtonListener(pLayout, "receivedButton", connectButtonListener);
+		connectButtonListener->registerSwitchCallbacks(pLayout);
 	}
 	showStatus();
 }
@@ -200,25 +199,8 @@ void ConnectPageArea::showMessagesReceived() {
 			eyegui::setContentOfTextBlock(pLayout, textboxes[(i - index)], content[i]["sender"]["name"].GetString() + temp2 + content[i]["sender"]["screen_name"].GetString() + temp + date + temp + content[i]["text"].GetString());
 		
 			
-			// Download avatar image:
-			std::string str = content[i]["sender"]["profile_image_url"].GetString();
-
-			// Extract file extension
-			size_t z = str.rfind('.', str.length());
-			std::string ext = str.substr(z + 1, str.length() - z);
-
-			// Set filename using this rule: profile_ + Profile ID + extension
-			std::string filename = "img/tmp/profile_" + std::string(content[i]["sender"]["id_str"].GetString()) + "." + ext;
-
-			// Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-			int indexStr = str.find("_normal.");
-			str = str.replace(indexStr, 8, "_400x400.");
-
-			std::string path = CONTENT_PATH + std::string("/") + filename;
-			download_image((char*)str.c_str(), (char*)path.c_str());
-
-			eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-			eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+			// Show avatar image, downloaded in background
+			ImageCache::getInstance()->showInPicture(pLayout, "profilePic" + std::to_string(i - index + 1), ImageCache::toLargeProfileImage(content[i]["sender"]["profile_image_url"].GetString()));
 
 		
 		}
@@ -253,25 +235,8 @@ void ConnectPageArea::showMessagesSend() {
 			date = date.substr(0, date.size() - 10);
 			eyegui::setContentOfTextBlock(pLayout, textboxes[(i - index)], temp1 + content[i]["recipient"]["name"].GetString() + temp2 + content[i]["recipient"]["screen_name"].GetString() + temp + date + temp + content[i]["text"].GetString());
 
-			// Download avatar image:
-			std::string str = content[i]["recipient"]["profile_image_url"].GetString();
-
-			// Extract file extension
-			size_t z = str.rfind('.', str.length());
-			std::string ext = str.substr(z + 1, str.length() - z);
-
-			// Set filename using this rule: profile_ + Profile ID + extension
-			std::string filename = "img/tmp/profile_" + std::string(content[i]["recipient"]["id_str"].GetString()) + "." + ext;
-
-			// Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-			int indexStr = str.find("_normal.");
-			str = str.replace(indexStr, 8, "_400x400.");
-
-			std::string path = CONTENT_PATH + std::string("/") + filename;
-			download_image((char*)str.c_str(), (char*)path.c_str());
-
-			eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-			eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+			// Show avatar image, downloaded in background
+			ImageCache::getInstance()->showInPicture(pLayout, "profilePic" + std::to_string(i - index + 1), ImageCache::toLargeProfileImage(content[i]["recipient"]["profile_image_url"].GetString()));
 		}
 		std::string fillUp = " ";
 		for (int r = counter; r < 4; r++)
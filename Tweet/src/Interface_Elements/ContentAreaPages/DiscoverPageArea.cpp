@@ -4,7 +4,7 @@
 
 #include "DiscoverPageArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 #include <string>
 #include <stdlib.h>
 #include <time.h>
@@ -30,20 +30,20 @@ void DiscoverPageArea::show() {
         {
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.18125f+(0.328125f*(i % 2)), 0.2675f + (0.105f*(i/2)), 0.321875f, 0.095f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.18125f+(0.328125f*(i%2)), 0.2675f + (0.105f*(i/2)), 0.321875f, 0.095f);
-            eyegui::registerButtonListener(pLayout, std::to_string(i), discoverButtonListener);
+            discoverButtonListener->registerCallbacks(pLayout, std::to_string(i));
         }
 
         textFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingTweetBlock5.beyegui", 0.18125f,0.4875f, 0.65f, 0.14375f);
         buttonFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingButton5.beyegui", 0.18125f, 0.4875f, 0.65f, 0.14375f);
-        eyegui::registerButtonListener(pLayout, std::to_string(4), discoverButtonListener);
+        discoverButtonListener->registerCallbacks(pLayout, std::to_string(4));
 
         textFrames[5] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingTweetBlock6.beyegui", 0.18125f,0.6525f, 0.65f, 0.14375f);
         buttonFrames[5] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingButton6.beyegui", 0.18125f, 0.6525f, 0.65f, 0.14375f);
-        eyegui::registerButtonListener(pLayout, std::to_string(5), discoverButtonListener);
+        discoverButtonListener->registerCallbacks(pLayout, std::to_string(5));
 
         textFrames[6] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingTweetBlock7.beyegui", 0.18125f, 0.8175f, 0.65f, 0.14375f);
         buttonFrames[6] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/DiscoverPageArea/floatingButton7.beyegui", 0.18125f, 0.8175f, 0.65f, 0.14375f);
-        eyegui::registerButtonListener(pLayout, std::to_string(6), discoverButtonListener);
+        discoverButtonListener->registerCallbacks(pLayout, std::to_string(6));
         eyegui::replaceElementWithBlock(pLayout, "toTheTopButton", true);
     }
 }
@@ -62,7 +62,7 @@ void DiscoverPageArea::hide() {
             eyegui::removeFloatingFrame(pLayout, buttonFrames[i]);
         }
         eyegui::replaceElementWithBoxButton(pLayout, "toTheTopButton", "menuebar_elements/goTop2.png", u"", "");
-        eyegui::registerButtonListener(pLayout, "toTheTopButton", TwitterApp::getInstance()->menueButtonArea->menueButtonListener);
+        TwitterApp::getInstance()->menueButtonArea->menueButtonListener->registerToTheTopCallback(pLayout);
     }
     Element::hide();
 }
@@ -105,65 +105,10 @@ void DiscoverPageArea::showDiscoveryChannel() {
     bool downloadImage = true;
 
     if (downloadImage) {
-        // Download avatar image:
-        std::string str = suggestions["users"][suggestionnmbr]["profile_image_url"].GetString();
-
-        // Extract file extension
-        size_t i = str.rfind('.', str.length());
-        std::string ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture1", filename, alignment, false);
-
-        // Download avatar image:
-        str = suggestions["users"][suggestionnmbr+1]["profile_image_url"].GetString();
-
-        // Extract file extension
-        i = str.rfind('.', str.length());
-        ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr+1]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture2", filename, alignment, false);
-
-        // Download avatar image:
-        str = suggestions["users"][suggestionnmbr + 2]["profile_image_url"].GetString();
-
-        // Extract file extension
-        i = str.rfind('.', str.length());
-        ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        filename = "img/tmp/profile_" + std::string(suggestions["users"][suggestionnmbr + 2]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "picture3", filename, alignment, false);
+        // Show avatar images, downloaded in background
+        ImageCache::getInstance()->showInPicture(pLayout, "picture1", ImageCache::toLargeProfileImage(suggestions["users"][suggestionnmbr]["profile_image_url"].GetString()));
+        ImageCache::getInstance()->showInPicture(pLayout, "picture2", ImageCache::toLargeProfileImage(suggestions["users"][suggestionnmbr+1]["profile_image_url"].GetString()));
+        ImageCache::getInstance()->showInPicture(pLayout, "picture3", ImageCache::toLargeProfileImage(suggestions["users"][suggestionnmbr + 2]["profile_image_url"].GetString()));
     }
 }
 
@@ -4,7 +4,7 @@
 
 #include "ProfilePageArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 #include <string>
 
 /**
@@ -25,13 +25,13 @@ void ProfilePageArea::show() {
     {
         textFrames[0] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingTweetBlock" + std::to_string( 1) + ".beyegui", 0.1765625f, 0.2575f , 0.6484375f, 0.24f);
         buttonFrames[0] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingButton" + std::to_string(1) + ".beyegui", 0.1765625f, 0.2575f, 0.6484375f, 0.24f);
-        eyegui::registerButtonListener(pLayout, std::to_string(0), profileButtonListener);
+        profileButtonListener->registerCallbacks(pLayout, std::to_string(0));
         Element::show();
         for (int i = 1; i <4; i++)
         {
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.1765625f, 0.3575f + (0.155f*i), 0.6484375f, 0.1425f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/ProfilePageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.1765625f, 0.3575f + (0.155f*i), 0.6484375f, 0.1425f);
-            eyegui::registerButtonListener(pLayout, std::to_string(i), profileButtonListener);
+            profileButtonListener->registerCallbacks(pLayout, std::to_string(i));
         }
         eyegui::replaceElementWithBrick(pLayout, "toTheTopButton", "bricks/ProfilePageArea/topNameBrick.beyegui");
     }
@@ -51,7 +51,7 @@ void ProfilePageArea::hide() {
             eyegui::removeFloatingFrame(pLayout, buttonFrames[i]);
         }
         eyegui::replaceElementWithBoxButton(pLayout, "toTheTopButton", "menuebar_elements/goTop2.png", u"", "");
-        eyegui::registerButtonListener(pLayout, "toTheTopButton", TwitterApp::getInstance()->menueButtonArea->menueButtonListener);
+        TwitterApp::getInstance()->menueButtonArea->menueButtonListener->registerToTheTopCallback(pLayout);
     }
     Element::hide();
 }
@@ -242,25 +242,8 @@ void ProfilePageArea::updateTimeline(bool reset) {
 void ProfilePageArea::showCurrentProfile() {
     bool downloadImage = true ;
     if (downloadImage) {
-        // Download avatar image:
-        std::string str = usercontents["profile_image_url"].GetString();
-
-        // Extract file extension
-        size_t i = str.rfind('.', str.length());
-        std::string ext = str.substr(i + 1, str.length() - i);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(usercontents["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic", filename, alignment, false);
+        // Show avatar image, downloaded in background
+        ImageCache::getInstance()->showInPicture(pLayout, "profilePic", ImageCache::toLargeProfileImage(usercontents["profile_image_url"].GetString()));
     }
     std::string temp = " @";
     eyegui::setContentOfTextBlock(pLayout, "toTheTopButton", usercontents["name"].GetString() + temp + usercontents["screen_name"].GetString());
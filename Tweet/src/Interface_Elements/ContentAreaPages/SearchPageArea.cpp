@@ -4,7 +4,7 @@
 
 #include "SearchPageArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 #include <string>
 
 /**
@@ -29,15 +29,13 @@ void SearchPageArea::show() {
         {
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.175f, 0.41f + 0.14125f*i, 0.65f, 0.1325f);
-            eyegui::registerButtonListener(pLayout, std::to_string(i), searchButtonListener);
+            searchButtonListener->registerCallbacks(pLayout, std::to_string(i));
         }
         textFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchText.beyegui", 0.175f, 0.2875f, 0.65f, 0.11f);
         buttonFrames[4] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/searchButton.beyegui", 0.175f , 0.2875f , 0.65f, 0.11f);
         buttonFrames[5] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/tweetSearchButton.beyegui", 0.0f, 0.26f, 0.125f, 0.101f);
         buttonFrames[6] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/SearchPageArea/profileSearchButton.beyegui", 0.0f, 0.39f, 0.125f, 0.101f);
-        eyegui::registerButtonListener(pLayout, "searchKeyboard", searchButtonListener);
-        eyegui::registerButtonListener(pLayout, "tweetSearchButton", searchButtonListener);
-        eyegui::registerButtonListener(pLayout, "profileSearchButton", searchButtonListener);
+        searchButtonListener->registerSearchCallbacks(pLayout);
         eyegui::setContentOfTextBlock(pLayout, textboxes[0], searchWord);
         manageSearchButtons();
     }
@@ -315,25 +313,8 @@ void SearchPageArea::showTweets() {
         eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - index) + 2], "Likes: " + std::to_string(content["statuses"][i]["favorite_count"].GetInt()));
         eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - index) + 3], "Retweets: " + std::to_string(content["statuses"][i]["retweet_count"].GetInt()));
 
-        // Download avatar image:
-        std::string str = content["statuses"][i]["user"]["profile_image_url"].GetString();
-
-            // Extract file extension
-            size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content["statuses"][i]["user"]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int indexStr = str.find("_normal.");
-        str = str.replace(indexStr, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+        // Show avatar image, downloaded in background
+        ImageCache::getInstance()->showInPicture(pLayout, "profilePic" + std::to_string(i - index + 1), ImageCache::toLargeProfileImage(content["statuses"][i]["user"]["profile_image_url"].GetString()));
 
 
     }
@@ -364,25 +345,8 @@ void SearchPageArea::showUsers() {
         eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - index) + 3], std::to_string(content[i]["followers_count"].GetInt()));
         eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - index) + 1], content[i]["screen_name"].GetString() +temp2+ content[i]["name"].GetString()+temp+content[i]["description"].GetString());
 
-        // Download avatar image:
-        std::string str = content[i]["profile_image_url"].GetString();
-
-        // Extract file extension
-        size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content[i]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int indexStr = str.find("_normal.");
-        str = str.replace(indexStr, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
-
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic" + std::to_string(i - index + 1), filename, alignment, false);
+        // Show avatar image, downloaded in background
+        ImageCache::getInstance()->showInPicture(pLayout, "profilePic" + std::to_string(i - index + 1), ImageCache::toLargeProfileImage(content[i]["profile_image_url"].GetString()));
 
     }
     std::string fillUp = " ";
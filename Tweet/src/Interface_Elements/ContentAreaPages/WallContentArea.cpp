@@ -4,7 +4,9 @@
 
 #include "WallContentArea.h"
 #include "src/TwitterApp.h"
-#include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 /**
@@ -27,7 +29,7 @@ void WallContentArea::show() {
         {
             textFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/WallContentArea/floatingTweetBlock" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
             buttonFrames[i] = eyegui::addFloatingFrameWithBrick(pLayout, "bricks/WallContentArea/floatingButton" + std::to_string(i + 1) + ".beyegui", 0.178125f, 0.265f + (0.18f*i), 0.65f, 0.1675f);
-            eyegui::registerButtonListener(pLayout, std::to_string(i), wallButtonListener);
+            wallButtonListener->registerCallbacks(pLayout, std::to_string(i));
         }
     }
 }
@@ -51,38 +53,71 @@ void WallContentArea::hide() {
 
 /**
 * updateNewsFeed function
-* updates timeline of user over Twitter
+* shows timeline of user which has been synced so far and lets it sync over Twitter in background
 * @param[in] bool if the Tweetindex should be reseted to 0
 */
 void WallContentArea::updateNewsFeed(bool reset) {
 
-    if (TwitterApp::getInstance()->hasConnection()) {
-        content = (TwitterApp::getInstance()->getTwitter()->getTimelineHome(""));
+    if (TwitterApp::getInstance()->hasConnection() && TwitterApp::getInstance()->timelineSync) {
+        TwitterApp::getInstance()->timelineSync->requestSync(true);
+        spContent = TwitterApp::getInstance()->timelineSync->getTweets();
 
-
-        if (content.Size() < 4) {
-            std::cout << "Couldnt get 4 Tweets from twitter!" << std::endl;
-        }
         if (reset)
         {
             tweetIndex = 0;
         }
+        tweetIndex = std::max(0, std::min(tweetIndex, (int)spContent->size() - 4));
         showTweets();
     }
 }
 
+/**
+* pollNewsFeed function
+* shows tweets synced in background. Stays at shown tweet and waits while a tweet is selected
+*/
+void WallContentArea::pollNewsFeed() {
+    TimelineSync* pSync = TwitterApp::getInstance()->timelineSync;
+    if (!pSync || currentlySelected.compare("none"))
+    {
+        return;
+    }
+    auto spTweets = pSync->getTweets();
+    if (spTweets == spContent)
+    {
+        return;
+    }
+
+    // Keep tweet at top of page, which is pushed down by new tweets
+    std::string topId = tweetIndex < (int)spContent->size() ? (*spContent)[tweetIndex].id : "";
+    spContent = spTweets;
+    for (int i = 0; i < (int)spContent->size(); i++)
+    {
+        if ((*spContent)[i].id == topId)
+        {
+            tweetIndex = i;
+            break;
+        }
+    }
+
+    if (spContent->size() < 4) {
+        std::cout << "Couldnt get 4 Tweets from twitter!" << std::endl;
+    }
+    tweetIndex = std::max(0, std::min(tweetIndex, (int)spContent->size() - 4));
+    showTweets();
+}
+
 /**
 * scrollUp function
 * Scroll the shown conten up on the basis of an int
 * @param[in] i is the int for how much will be scrolled
 */
 void WallContentArea::scrollUp(int i) {
-    if (tweetIndex + 4+i <content.Size())
+    if (tweetIndex + 4+i <(int)spContent->size())
     {
         tweetIndex += i;
     }
     else {
-        tweetIndex = content.Size() - 4;
+        tweetIndex = std::max(0, (int)spContent->size() - 4);
     }
     showTweets();
 }
@@ -110,7 +145,7 @@ void WallContentArea::scrollDown(int i) {
 * @param[out] string of the ID of the tweet
 */
 std::string WallContentArea::getTweetIdAt(int i) {
-    return content[i + tweetIndex]["id_str"].GetString();
+    return (*spContent)[i + tweetIndex].id;
 }
 
 /**
@@ -120,7 +155,7 @@ std::string WallContentArea::getTweetIdAt(int i) {
 * @param[out] string of the ID of the user
 */
 std::string WallContentArea::getTweetUser(int i) {
-    return content[i + tweetIndex]["user"]["id_str"].GetString();
+    return (*spContent)[i + tweetIndex].userId;
 }
 
 /**
@@ -130,7 +165,7 @@ std::string WallContentArea::getTweetUser(int i) {
 * @param[out] bool if the the tweet was favorited
 */
 bool WallContentArea::getLikedAt(int i) {
-    return content[i + tweetIndex]["favorited"].GetBool();
+    return (*spContent)[i + tweetIndex].favorited;
 }
 
 /**
@@ -153,7 +188,7 @@ bool WallContentArea::getOwnAt(int i) {
 * @param[out] bool if the the tweet was retweeted
 */
 bool WallContentArea::getRetweetedAt(int i) {
-    return content[i + tweetIndex]["retweeted"].GetBool();
+    return (*spContent)[i + tweetIndex].retweeted;
 }
 
 /**
@@ -162,37 +197,31 @@ bool WallContentArea::getRetweetedAt(int i) {
 * shows the the tweets wich where found
 */
 void WallContentArea::showTweets() {
+    auto start = std::chrono::steady_clock::now();
     std::string temp = "\n";
-    for (rapidjson::SizeType i = tweetIndex; (i < content.Size()) && (i < tweetIndex + 4); i++) {
-        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i-tweetIndex)], content[i]["user"]["name"].GetString()+temp+content[i]["text"].GetString());
-		if (content[i].HasMember("retweeted_status")) {
-		eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(content[i]["retweeted_status"]["favorite_count"].GetInt()));
-		}
-		else {
-	    eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(content[i]["favorite_count"].GetInt()));
-		}
-        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 2], "Retweets: " + std::to_string(content[i]["retweet_count"].GetInt()));
-
-        // Download avatar image:
-        std::string str = content[i]["user"]["profile_image_url"].GetString();
-
-        // Extract file extension
-        size_t z = str.rfind('.', str.length());
-        std::string ext = str.substr(z + 1, str.length() - z);
-
-        // Set filename using this rule: profile_ + Profile ID + extension
-        std::string filename = "img/tmp/profile_" + std::string(content[i]["user"]["id_str"].GetString()) + "." + ext;
-
-        // Replace substring '_normal.' with '_400x400' to get profile image in the size of 400x400 pixels.
-        int index = str.find("_normal.");
-        str = str.replace(index, 8, "_400x400.");
-
-        std::string path = CONTENT_PATH + std::string("/") + filename;
-        download_image((char*)str.c_str(), (char*)path.c_str());
+    const TweetList& rContent = *spContent;
+    for (int i = tweetIndex; (i < (int)rContent.size()) && (i < tweetIndex + 4); i++) {
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i-tweetIndex)], rContent[i].userName+temp+rContent[i].text);
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 1], "Likes: " + std::to_string(rContent[i].favoriteCount));
+        eyegui::setContentOfTextBlock(pLayout, textboxes[3 * (i - tweetIndex) + 2], "Retweets: " + std::to_string(rContent[i].retweetCount));
+
+        // Show avatar image, downloaded in background
+        ImageCache::getInstance()->showInPicture(pLayout, "profilePic"+std::to_string(i - tweetIndex+1), ImageCache::toLargeProfileImage(rContent[i].profileImageUrl));
+    }
 
-        eyegui::ImageAlignment alignment = eyegui::ImageAlignment::ORIGINAL;
-        eyegui::replaceElementWithPicture(pLayout, "profilePic"+std::to_string(i - tweetIndex+1), filename, alignment, false);
+    // Prefetch images of next and previous page, so scrolling does not wait for downloads
+    int first = std::max(0, tweetIndex - 4);
+    int last = std::min((int)rContent.size(), tweetIndex + 8);
+    for (int i = first; i < last; i++)
+    {
+        ImageCache::getInstance()->prefetch(ImageCache::toLargeProfileImage(rContent[i].profileImageUrl));
+        for (const auto& rUrl : rContent[i].mediaUrls)
+        {
+            ImageCache::getInstance()->prefetch(rUrl);
+        }
     }
+
+    std::cout << "Showing tweets took " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << "ms" << std::endl;
 }
 
 /**
@@ -221,7 +250,7 @@ void WallContentArea::selectTweet(std::string id) {
                     selectTweet("1");
                     return;
                 }
-                if (stoi(currentlySelected) == 3 && tweetIndex != content.Size() - 4)
+                if (stoi(currentlySelected) == 3 && tweetIndex < (int)spContent->size() - 4)
                 {
                     scrollUp(1);
                     selectTweet("2");
@@ -239,13 +268,9 @@ void WallContentArea::selectTweet(std::string id) {
                 eyegui::replaceElementWithPicture(pLayout, "rightSide"+currentlySelected, "Eprojekt_Design/tweetConnection.png", alignment);
 
                 std::cout << "Tweet " + id + " has been hit" << std::endl;
-                if (content[stoi(currentlySelected)+tweetIndex]["entities"].HasMember("media"))
+                const std::vector<std::string>& links = (*spContent)[stoi(currentlySelected) + tweetIndex].mediaUrls;
+                if (!links.empty())
                 {
-                    std::vector<std::string> links;
-                    for (int i = 0; i < content[stoi(currentlySelected) + tweetIndex]["extended_entities"]["media"].Size(); i++)
-                    {
-                        links.push_back(content[stoi(currentlySelected) + tweetIndex]["extended_entities"]["media"][i]["media_url"].GetString());
-                    }
                     TwitterApp::getInstance()->actionButtonArea->mediaLinks = links;
                     TwitterApp::getInstance()->actionButtonArea->changeToTweetsWithPics(getTweetIdAt(stoi(currentlySelected)), getTweetUser(stoi(currentlySelected)), getLikedAt(stoi(currentlySelected)), getRetweetedAt(stoi(currentlySelected)), getOwnAt(stoi(currentlySelected)));
 
@@ -7,6 +7,7 @@
 #include "src/Interface_Elements/Element.h"
 #include "src/Buttons/WallButton.h"
 #include "src/TwitterClient/TwitterClient.h"
+#include "src/TwitterClient/TimelineSync.h"
 #include <thread>
 
 class WallContentArea : public Element {
@@ -20,6 +21,7 @@ public:
     void selectTweet(std::string id);
     void showTweets();
     void updateNewsFeed(bool reset);
+    void pollNewsFeed();
     void scrollUp(int i);
     void scrollDown(int i);
     std::string getTweetUser(int i);
@@ -33,7 +35,7 @@ private:
     bool getOwnAt(int i);
     std::string currentlySelected = "none";
     std::shared_ptr<WallButton> wallButtonListener = std::shared_ptr<WallButton>(new WallButton);
-    rapidjson::Document content;
+    std::shared_ptr<const TweetList> spContent = std::make_shared<const TweetList>();
     int buttonFrames[4];
     int textFrames[4];
     std::string textboxes[12] = {	"textBlock1_1","textBlock1_2","textBlock1_3",
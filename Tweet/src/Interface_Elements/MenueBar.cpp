@@ -18,14 +18,7 @@ MenueBar::MenueBar(eyegui::Layout* pLayout):Element("menue_button_area", "bricks
 */
 void MenueBar::show() {
     Element::show();
-    eyegui::registerButtonListener(pLayout, BACK_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, WALL_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, CONNECT_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, DISCOVER_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, PROFILE_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, SEARCH_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout, TWEET_BUTTON, menueButtonListener);
-    eyegui::registerButtonListener(pLayout,"toTheTopButton" , menueButtonListener);
+    menueButtonListener->registerCallbacks(pLayout);
     eyegui::setElementActivity(pLayout, WALL_BUTTON, false);
 }
 
@@ -114,6 +114,12 @@ void Keyboard::init() {
 
     Listener(); // initiating KeyListener for the Keyboard class
 
+    // Resolve text blocks once, they are updated at every key press
+    keyboardTextHandle = eyegui::fetchTextBlockHandle(pLayout2, "keyboardtext");
+    word1Handle = eyegui::fetchTextBlockHandle(pLayout2, "Word1");
+    word2Handle = eyegui::fetchTextBlockHandle(pLayout2, "Word2");
+    word3Handle = eyegui::fetchTextBlockHandle(pLayout2, "Word3");
+
     currentCursorPos = 0; // since there is no text yet, set cursor position to 0
     isUpper= true;
 }
@@ -173,9 +179,9 @@ void Keyboard::write(const char key) {
         //WordCompletion
         if (key == ' ') {
             tempWord = "";
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
         }
         else {
             tempWord += key;
@@ -186,7 +192,7 @@ void Keyboard::write(const char key) {
         //-------------------------------------
 
         ausgabe.insert(currentCursorPos, 1, key);
-        eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard3");
+        eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard3");
         if (ausgabe.size() > 1 && (((ausgabe.size() - 1) % 70) == 0)) {
             std::cout << "There will be a new line" << std::endl;
             ausgabe.insert(currentCursorPos + 1, 1, '\n');
@@ -202,7 +208,7 @@ void Keyboard::write(const char key) {
         }
     }
     else {
-        eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard2");
+        eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard2");
     }
 }
 
@@ -234,9 +240,9 @@ void Keyboard::write2(char key) {
         //WordCompletion
         if (key == ' ') {
             tempWord = "";
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
         }
         else {
             tempWord += key;
@@ -245,7 +251,7 @@ void Keyboard::write2(char key) {
         //-------------------------------------
 
         ausgabe.insert(currentCursorPos, 1, key);
-        eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard3");
+        eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard3");
         if (ausgabe.size() > 1 && (((ausgabe.size() - 1) % 70) == 0)) {
             std::cout << "There will be a new line" << std::endl;
             ausgabe.insert(currentCursorPos + 1, 1, '\n');
@@ -261,7 +267,7 @@ void Keyboard::write2(char key) {
         }
     }
     else {
-        eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard2");
+        eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard2");
     }
 }
 
@@ -277,9 +283,9 @@ void Keyboard::write3(std::string key){
     if (ausgabe.length()<140) {
         if (key == " ") {
             tempWord = "";
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
         }
         else {
             tempWord += key;
@@ -288,7 +294,7 @@ void Keyboard::write3(std::string key){
             }
         }
         ausgabe.insert(currentCursorPos, key);
-        eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard3");
+        eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard3");
         if (ausgabe.size() > 1 && (((ausgabe.size() - 1) % 70) == 0)) {
             std::cout << "There will be a new line" << std::endl;
             ausgabe.insert(currentCursorPos + 1, 1, '\n');
@@ -322,7 +328,7 @@ void Keyboard::insertCursorAndDisplayText(int offset) {
     tempAusgabe = ausgabe;
     currentCursorPos += offset;
     tempAusgabe.insert(currentCursorPos, "|");
-    eyegui::setContentOfTextBlock(pLayout2, "keyboardtext", tempAusgabe);
+    eyegui::setContentOfTextBlock(pLayout2, keyboardTextHandle, tempAusgabe);
 }
 
 /**
@@ -378,9 +384,9 @@ void Keyboard::deleteKey() {
     if (tempWord.length() > 0) {
         tempWord.erase(tempWord.end() - 1);
         if (tempWord.length() == 0) {
-            eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-            eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+            eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+            eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
         }
         else {
             showWordComp();
@@ -400,7 +406,7 @@ void Keyboard::deleteKey() {
           }
 
         if (ausgabe.length() < 140) {
-            eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard3");
+            eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard3");
         }
     }
 }
@@ -451,14 +457,14 @@ void Keyboard::abort() {
     word1 = "";
     word2 = "";
     word3 = "";
-    eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+    eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 
     clipboard = "";
     pointer = NULL;
     resetSpeed();
-    eyegui::setContentOfTextBlock(pLayout2, "keyboardtext", "Ausgabetext");
+    eyegui::setContentOfTextBlock(pLayout2, keyboardTextHandle, "Ausgabetext");
     eyegui::setVisibilityOfLayout(pLayout, true);
     eyegui::setVisibilityOfLayout(pLayout2, false);
 }
@@ -589,9 +595,9 @@ void Keyboard::showWordComp() {
     if (v.size() == 1) {
 
         v[0] = replaceChar2(v[0]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word1", v[0]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-        eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+        eyegui::setContentOfTextBlock(pLayout2, word1Handle, v[0]);
+        eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+        eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 
         word1 = v[0];
         word2 = "";
@@ -602,9 +608,9 @@ void Keyboard::showWordComp() {
         v[0] = replaceChar2(v[0]);
         v[1] = replaceChar2(v[1]);
 
-        eyegui::setContentOfTextBlock(pLayout2, "Word1", v[0]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word2", v[1]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+        eyegui::setContentOfTextBlock(pLayout2, word1Handle, v[0]);
+        eyegui::setContentOfTextBlock(pLayout2, word2Handle, v[1]);
+        eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 
         word1 = v[0];
         word2 = v[1];
@@ -616,9 +622,9 @@ void Keyboard::showWordComp() {
         v[1] = replaceChar2(v[1]);
         v[2] = replaceChar2(v[2]);
 
-        eyegui::setContentOfTextBlock(pLayout2, "Word1", v[0]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word2", v[1]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word3", v[2]);
+        eyegui::setContentOfTextBlock(pLayout2, word1Handle, v[0]);
+        eyegui::setContentOfTextBlock(pLayout2, word2Handle, v[1]);
+        eyegui::setContentOfTextBlock(pLayout2, word3Handle, v[2]);
         word1 = v[0];
         word2 = v[1];
         word3 = v[2];
@@ -806,7 +812,7 @@ void Keyboard::deleteKey2() {
         insertCursorAndDisplayText(-1);
 
         if (ausgabe.length() < 140) {
-            eyegui::setStyleOfElement(pLayout2, "keyboardtext", "keyboard3");
+            eyegui::setStyleOfElement(pLayout2, keyboardTextHandle, "keyboard3");
         }
     }
 }
@@ -823,9 +829,9 @@ void Keyboard::WordmoveRight() {
         v[Wcount - 2]= replaceChar2(v[Wcount - 2]);
         v[Wcount - 1]= replaceChar2(v[Wcount - 1]);
 
-        eyegui::setContentOfTextBlock(pLayout2, "Word1", v[Wcount - 3]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word2", v[Wcount - 2]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word3", v[Wcount - 1]);
+        eyegui::setContentOfTextBlock(pLayout2, word1Handle, v[Wcount - 3]);
+        eyegui::setContentOfTextBlock(pLayout2, word2Handle, v[Wcount - 2]);
+        eyegui::setContentOfTextBlock(pLayout2, word3Handle, v[Wcount - 1]);
         word1 = v[Wcount - 3];
         word2 = v[Wcount - 2];
         word3 = v[Wcount - 1];
@@ -843,9 +849,9 @@ void Keyboard::WordmoveLeft() {
         v[Wcount - 3] = replaceChar2(v[Wcount - 3]);
         v[Wcount - 2] = replaceChar2(v[Wcount - 2]);
         v[Wcount - 1] = replaceChar2(v[Wcount - 1]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word1", v[Wcount - 3]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word2", v[Wcount - 2]);
-        eyegui::setContentOfTextBlock(pLayout2, "Word3", v[Wcount - 1]);
+        eyegui::setContentOfTextBlock(pLayout2, word1Handle, v[Wcount - 3]);
+        eyegui::setContentOfTextBlock(pLayout2, word2Handle, v[Wcount - 2]);
+        eyegui::setContentOfTextBlock(pLayout2, word3Handle, v[Wcount - 1]);
         word1 = v[Wcount - 3];
         word2 = v[Wcount - 2];
         word3 = v[Wcount - 1];
@@ -860,6 +866,7 @@ void Keyboard::WordmoveLeft() {
 void Keyboard::writeWordComp(int Wordcase){
     useWordComp = false;
     if (Wordcase == 1 && word1.length() > 0) {
+        trie.learn(word1);
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
@@ -877,6 +884,7 @@ void Keyboard::writeWordComp(int Wordcase){
     }
 
     if (Wordcase == 2 && word2.length() > 0) {
+        trie.learn(word2);
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
@@ -893,6 +901,7 @@ void Keyboard::writeWordComp(int Wordcase){
     }
 
     if (Wordcase ==3 && word3.length() > 0) {
+        trie.learn(word3);
         for (size_t i = 0; i < tempWord.length(); i++) {
             deleteKey2();
         }
@@ -946,7 +955,6 @@ void Keyboard::addLinetoDict() {
 */
 void Keyboard::deleteLineinDict() {
     trie.deleteLineinDict(dict, ausgabe);
-    trie = Trie("");
     trie.loadDict(dict);
 
     ausgabe = "";
@@ -955,11 +963,11 @@ void Keyboard::deleteLineinDict() {
     word1 = "";
     word2 = "";
     word3 = "";
-    eyegui::setContentOfTextBlock(pLayout2, "keyboardtext", "");
+    eyegui::setContentOfTextBlock(pLayout2, keyboardTextHandle, "");
 
-    eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+    eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 
     showWordComp();
 }
@@ -974,11 +982,11 @@ void Keyboard::clearInput() {
     word1 = "";
     word2 = "";
     word3 = "";
-    eyegui::setContentOfTextBlock(pLayout2, "keyboardtext", "");
+    eyegui::setContentOfTextBlock(pLayout2, keyboardTextHandle, "");
 
-    eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+    eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 }
 
 /**
@@ -1000,7 +1008,6 @@ void Keyboard::changeDict(int lang) {
         dict = "../src/Keyboard/dutch.txt";
     }
 
-    trie = Trie("");
     trie.loadDict(dict);
 
     tempWord = " ";
@@ -1008,9 +1015,9 @@ void Keyboard::changeDict(int lang) {
     word2 = "";
     word3 = "";
 
-    eyegui::setContentOfTextBlock(pLayout2, "Word1", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word2", "");
-    eyegui::setContentOfTextBlock(pLayout2, "Word3", "");
+    eyegui::setContentOfTextBlock(pLayout2, word1Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word2Handle, "");
+    eyegui::setContentOfTextBlock(pLayout2, word3Handle, "");
 
     v = trie.autocomplete(tempWord);
 
@@ -1026,231 +1033,5 @@ void Keyboard::changeDict(int lang) {
 * Listener for all Buttons in the KeyboarClass
 */
 void Keyboard::Listener() {
-
-    // UpperKeys
-    eyegui::registerButtonListener(pLayout2, "keyA", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyB", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyC", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyD", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyE", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyF", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyG", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyH", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyI", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyJ", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyK", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyL", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyM", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyN", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyO", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyP", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyQ", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyR", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyS", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyT", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyU", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyV", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyW", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyX", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyY", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyZ", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyDelete", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer5", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyLeer6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter5", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyEnter6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyAbort", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLower", KeyboardButtonListener);
-
-    //----------------------------------------------------------------------------------
-    // LowerKeys
-    eyegui::registerButtonListener(pLayout2, "keya", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyb", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyc", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyd", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keye", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyf", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyg", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyh", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyi", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyj", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyk", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyl", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keym", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyn", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyo", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyp", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyq", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyr", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keys", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyt", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyu", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyv", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyw", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyx", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyy", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyz", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyDelete2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDelete3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDelete4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDelete5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDelete6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyLeer2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEnter2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyUpper", KeyboardButtonListener);
-
-    // Special Characters
-    eyegui::registerButtonListener(pLayout2, "keyHashtag", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2,"keyHashtag2", KeyboardButtonListener);
-
-    // Punctuation
-    eyegui::registerButtonListener(pLayout2,"keyDot", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2,"keyDot2", KeyboardButtonListener);
-
-    //--------SpecialCharacters
-    eyegui::registerButtonListener(pLayout2, "keySpecial", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySpecial2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySpecial3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySpecial4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySpecial5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySpecial6", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyAe", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyae", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyOe", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyoe", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyUe", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyue", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySz", KeyboardButtonListener);
-    //-------------Symbols ------------------------
-
-    eyegui::registerButtonListener(pLayout2, "keySymbols", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySymbols2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySymbols3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySymbols4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySymbols5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySymbols6", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyCircumflex", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyCircle", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyExclammark", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyQuotationMark", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyParagraph", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDollar", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyPercentage", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyAmpersand", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyForwardSlash", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyCurlyBracketOpen", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyRoundBracketOpen", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyRectangularBracketOpen", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyRoundBracketClosing", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyRectangularBracketClosing", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEquals", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyCurlyBracketClosing", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyQuestionmark", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyBackslash", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyAccentgrave", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyAccentaguie", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyStar", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyPlus", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyTilde", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keySingleQuotation", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyHashtag2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyUnderscore", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMinus", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyDot2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyColon", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySemicolon", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyComma", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyPipe", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySmallerThan", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyGreaterThan", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyAt", KeyboardButtonListener);
-    //eyegui::registerButtonListener(pLayout2, "keyEuro", KeyboardButtonListener);
-
-    //--------------Functions---------------
-    eyegui::registerButtonListener(pLayout2, "keyFunctions", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFunctions2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFunctions3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFunctions4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFunctions5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFunctions6", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyCopy", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyPaste", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyAddToDict", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDeleteFromDict", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyClear", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyEnglish", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyGerman", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFrensh" , KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyDutch", KeyboardButtonListener);
-
-    //--------------Numbers ----------------
-    eyegui::registerButtonListener(pLayout2, "keyNumbers", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNumbers2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNumbers3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNumbers4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNumbers5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNumbers6", KeyboardButtonListener);
-
-    eyegui::registerButtonListener(pLayout2, "keyOne", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyTwo", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyThree", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFour", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFive", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyZero", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySix", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySeven", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyEight", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyNine", KeyboardButtonListener);
-
-    //-------------------------------------
-    // Extra Keys
-    eyegui::registerButtonListener(pLayout2, "keyFaster", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFaster3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFaster4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFaster5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFaster6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyFaster2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keySlower2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight3", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight4", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight5", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight6", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveLeft2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyMoveRight2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "yes", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "no", KeyboardButtonListener);
-
-    //--------Numbers -----------
-
-    // WordComplition buttons
-    eyegui::registerButtonListener(pLayout2, "keyWleft", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyWright", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyWord1", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyWord2", KeyboardButtonListener);
-    eyegui::registerButtonListener(pLayout2, "keyWord3", KeyboardButtonListener);
+    KeyboardButtonListener->registerCallbacks(pLayout2);
 }
@@ -79,7 +79,7 @@ public:
     int Wcount;
     std::string  tempWord, word1, word2, word3,dict;
     std::vector<std::string> v;
-    Trie trie = Trie("");
+    Trie trie;
 
     // Test login
     void setPLayout(eyegui::Layout* newLayout) { this->pLayout = newLayout; }
@@ -97,5 +97,6 @@ private:
     eyegui::Layout* pLayout2;
     int keys, keys2, keys3, move, Word1, Word2, Word3, cas, numbers, specialKeys, keysSymbol, functionSymbol;
     std::string tweetid;
+    eyegui::TextBlockHandle keyboardTextHandle, word1Handle, word2Handle, word3Handle;
     std::shared_ptr<KeyboardButton> KeyboardButtonListener = std::shared_ptr<KeyboardButton>(new KeyboardButton);
 };
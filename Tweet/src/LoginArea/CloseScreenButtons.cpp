@@ -7,39 +7,18 @@
 #include <iostream>
 
 /**
-* CloseScreenButtons hit function
-* When a Button is hit, different functions of the Class will be used
+* CloseScreenButtons registerCallbacks function
+* Registers one callback per Button of the close screen
 * (1) close_yes closes the application
 * (2) close_no switches back to "Login screen"
 * @param[in] close_layout current layout file of GUI
-* @param[in] id is the ID of the hit Button
 */
-void CloseScreenButtons::hit(eyegui::Layout * close_layout, std::string id)
+void CloseScreenButtons::registerCallbacks(eyegui::Layout * close_layout)
 {
-	if (id.compare("close_yes") == 0) {
+	eyegui::registerButtonCallbacks(close_layout, "close_yes", []() {
 		Login::instance->getApplication()->getInstance()->terminate = true;
-	}
-	if (id.compare("close_no") == 0) {
+	});
+	eyegui::registerButtonCallbacks(close_layout, "close_no", []() {
 		Login::instance->toLoginScreen();
-	}
-}
-
-/**
-* LoginButton up function
-* no content
-* @param[in] close_layout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void CloseScreenButtons::up(eyegui::Layout * close_layout, std::string id)
-{
-}
-
-/**
-* LoginButton down function
-* no content
-* @param[in] close_layout current layout file of GUI
-* @param[in] id is the ID of the hit Button
-*/
-void CloseScreenButtons::down(eyegui::Layout * close_layout, std::string id)
-{
+	});
 }
\ No newline at end of file
@@ -6,11 +6,9 @@
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 #include <iostream>
 
-class CloseScreenButtons :public eyegui::ButtonListener {
+class CloseScreenButtons {
 
 public:
 
-	void virtual hit(eyegui::Layout* close_layout, std::string id);
-	void virtual up(eyegui::Layout* close_layout, std::string id);
-	void virtual down(eyegui::Layout* close_layout, std::string id);
+	void registerCallbacks(eyegui::Layout* close_layout);
 };
\ No newline at end of file
@@ -25,24 +25,11 @@ Login::Login(int width, int height) {
     eyegui::replaceElementWithBrick(pLayout, "middle", "login_bricks/middle_button_area.beyegui", false);
     eyegui::replaceElementWithBrick(pLayout, "right", "login_bricks/right_button_area.beyegui", false);
 
-    // Register button "connect_button"
-    eyegui::registerButtonListener(pLayout, "connect_button", LoginButtonListener);
+    // Register buttons "connect_button", "password_button", "username_button" and "close_button"
+    LoginButtonListener->registerCallbacks(pLayout);
 
-    // Register button "password_button"
-    eyegui::registerButtonListener(pLayout, "password_button", LoginButtonListener);
-
-    // Register button "username_button"
-    eyegui::registerButtonListener(pLayout, "username_button", LoginButtonListener);
-
-	//Register button "close_button"
-	eyegui::registerButtonListener(pLayout, "close_button", LoginButtonListener);
-
-	//Register buttons for close_screen
-	//Register button "close_yes"
-	eyegui::registerButtonListener(close_layout, "close_yes", CloseScreenButtonListener);
-
-	//Register button "close_no"
-	eyegui::registerButtonListener(close_layout, "close_no", CloseScreenButtonListener);
+	//Register buttons "close_yes" and "close_no" for close_screen
+	CloseScreenButtonListener->registerCallbacks(close_layout);
 }
 
 /**
@@ -3,6 +3,7 @@
 //============================================================================
 
 #include "TwitterApp.h"
+#include "src/TwitterClient/ImageCache.h"
 #include <iostream>
 
 /**
@@ -60,6 +61,10 @@ void TwitterApp::startUpMethod() {
         rapidjson::Document temp = (TwitterApp::getInstance()->getTwitter()->showUser(tempname, false));
         userID = temp["id_str"].GetString();
         profileContentArea->setCurProfile(userID);
+
+        // Timeline is synced in background with own account, since twitCurl is not thread safe
+        delete timelineSync;
+        timelineSync = new TimelineSync(TimelineSync::fetchHomeTimeline(std::shared_ptr<twitCurl>(twitter->mpAccount->clone())));
         changeState(WALL);
     }
 }
@@ -372,10 +377,24 @@ void TwitterApp::render() {
     eyegui::drawGUI(pGUI);
 }
 
+/**
+* update function
+* takes over content which has been fetched in background. Called once per frame
+*/
+void TwitterApp::update() {
+    if (currentstate == WALL)
+    {
+        wallContentArea->pollNewsFeed();
+    }
+}
+
 /**
 * ~TwitterApp function
 * terminates current Gui
 */
 TwitterApp::~TwitterApp() {
+    delete timelineSync;
+    ImageCache::forgetLayout(pLayout);
+    ImageCache::forgetLayout(pLayout2);
     eyegui::terminateGUI(pGUI);
 }
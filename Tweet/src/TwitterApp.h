@@ -13,6 +13,7 @@
 #include "src/Interface_Elements/ContentAreaPages/ConnectPageArea.h"
 #include "src/Interface_Elements/ContentAreaPages/DiscoverPageArea.h"
 #include "src/Keyboard/Keyboard.h"
+#include "src/TwitterClient/TimelineSync.h"
 #include "externals/eyeGUI-development/include/eyeGUI.h"
 
 // Just some constants to avoid typing errors, also you dont have to lookup the names always
@@ -39,6 +40,7 @@ public:
     ~TwitterApp();
     Twitter* getTwitter() { return twitter; }
     void render();
+    void update();
     eyegui::GUI* getGUI();
     void changeState(int state);
     void startUpMethod();
@@ -71,6 +73,7 @@ public:
     twitCurl account;
     twitCurl account2;
     Keyboard* keyboard;
+    TimelineSync* timelineSync = nullptr;
     bool terminate = false;
 
 private:
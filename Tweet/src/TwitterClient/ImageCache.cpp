@@ -0,0 +1,392 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "ImageCache.h"
+
+// Image download is based on libcurl, decoding uses stb_image compiled into eyeGUI
+#include "externals/twitCurl/twitcurl.h"
+#include "externals/eyeGUI-development/externals/stb/stb_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+// Count of threads downloading and decoding images
+static const int IMAGE_CACHE_WORKER_COUNT = 4;
+
+// Maximal bytes of decoded pixels kept in memory
+static const size_t IMAGE_CACHE_MAX_BYTES = 128 * 1024 * 1024;
+
+// Seconds until download is given up
+static const long IMAGE_CACHE_TIMEOUT = 10;
+
+// Shown in picture until pixels are available
+static const std::string IMAGE_CACHE_PLACEHOLDER = "img/invisProf.png";
+
+//Singletons have to be set to 0, when they are not instanciated yet
+ImageCache* ImageCache::instance = 0;
+
+/**
+* getInstance function
+* creates the instance at first call
+* @param[out] ImageCache instance
+*/
+ImageCache* ImageCache::getInstance() {
+    if (!instance)
+    {
+        instance = new ImageCache();
+    }
+    return instance;
+}
+
+/**
+* destroyInstance function
+* stops the worker threads and frees all cached images
+*/
+void ImageCache::destroyInstance() {
+    delete instance;
+    instance = 0;
+}
+
+/**
+* forgetLayout function
+* drops pictures of layout which wait for images. Has to be called before
+* layout is removed, so no image is shown in removed layout later
+* @param[in] pLayout layout which is removed
+*/
+void ImageCache::forgetLayout(eyegui::Layout const * pLayout) {
+    if (!instance)
+    {
+        return;
+    }
+    auto& rWaiting = instance->waitingPictures;
+    for (auto it = rWaiting.begin(); it != rWaiting.end();)
+    {
+        if (it->first.first == pLayout)
+        {
+            it = rWaiting.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/**
+* Constructor for the ImageCache Class
+* starts the worker threads
+*/
+ImageCache::ImageCache() {
+    // Global initialization of curl is not thread safe, so do it before workers start
+    curl_global_init(CURL_GLOBAL_ALL);
+
+    // Flipping is a global flag of stb_image without thread local variant in this version. It is set
+    // here before workers start and eyeGUI only ever sets the same value, so workers just read it
+    stbi_set_flip_vertically_on_load(true);
+
+    for (int i = 0; i < IMAGE_CACHE_WORKER_COUNT; i++)
+    {
+        workers.push_back(std::thread(&ImageCache::work, this));
+    }
+}
+
+/**
+* Destructor for the ImageCache Class
+* waits for running downloads, pending ones are dropped
+*/
+ImageCache::~ImageCache() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+        requests.clear();
+    }
+    condition.notify_all();
+    for (auto& rWorker : workers)
+    {
+        rWorker.join();
+    }
+    if (fetchCount > 0)
+    {
+        std::cout << "ImageCache: " << hitCount << " hits, " << missCount << " misses, "
+            << (fetchTime / fetchCount) << "ms average download and decode" << std::endl;
+    }
+}
+
+/**
+* prefetch function
+* downloads image in background unless cached or already requested
+* @param[in] url of image
+*/
+void ImageCache::prefetch(std::string url) {
+    if (images.find(url) == images.end())
+    {
+        request(url, false);
+    }
+}
+
+/**
+* showInPicture function
+* replaces element with picture showing image of url. Until the image is
+* available, a placeholder is shown
+* @param[in] pLayout layout of element
+* @param[in] id of element
+* @param[in] url of image
+*/
+void ImageCache::showInPicture(eyegui::Layout* pLayout, std::string id, std::string url) {
+    eyegui::replaceElementWithPicture(pLayout, id, IMAGE_CACHE_PLACEHOLDER, eyegui::ImageAlignment::ORIGINAL, false);
+    auto key = std::make_pair(pLayout, id);
+    auto spImage = find(url);
+    if (spImage)
+    {
+        hitCount++;
+        waitingPictures.erase(key);
+        setPicture(pLayout, id, *spImage);
+    }
+    else
+    {
+        missCount++;
+        waitingPictures[key] = url;
+        request(url, true);
+    }
+}
+
+/**
+* update function
+* takes over images finished by workers and shows them in waiting pictures.
+* Has to be called once per frame by thread owning the GUI
+*/
+void ImageCache::update() {
+    std::vector<std::pair<std::string, std::shared_ptr<DecodedImage> > > done;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (finished.empty())
+        {
+            return;
+        }
+        std::swap(done, finished);
+    }
+
+    for (auto& rPair : done)
+    {
+        inFlight.erase(rPair.first);
+        if (rPair.second)
+        {
+            insert(rPair.first, rPair.second);
+        }
+
+        // Show image in pictures which still wait for it. If download or decoding failed, placeholder stays
+        for (auto it = waitingPictures.begin(); it != waitingPictures.end();)
+        {
+            if (it->second == rPair.first)
+            {
+                if (rPair.second)
+                {
+                    setPicture(it->first.first, it->first.second, *rPair.second);
+                }
+                it = waitingPictures.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+/**
+* toLargeProfileImage function
+* replaces substring '_normal.' with '_400x400.' to get profile image in the size of 400x400 pixels
+* @param[in] url of profile image
+* @param[out] url of large profile image
+*/
+std::string ImageCache::toLargeProfileImage(std::string url) {
+    size_t index = url.find("_normal.");
+    if (index != std::string::npos)
+    {
+        url = url.replace(index, 8, "_400x400.");
+    }
+    return url;
+}
+
+/**
+* work function
+* loop of worker threads
+*/
+void ImageCache::work() {
+    while (true)
+    {
+        std::string url;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return shutdown || !requests.empty(); });
+            if (shutdown)
+            {
+                return;
+            }
+            url = requests.front();
+            requests.pop_front();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto spImage = fetch(url);
+        double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.push_back(std::make_pair(url, spImage));
+        fetchTime += duration;
+        fetchCount++;
+    }
+}
+
+/**
+* request function
+* queues url for workers. Urgent requests are handled before prefetching
+* @param[in] url of image
+* @param[in] urgent whether image is needed for display right now
+*/
+void ImageCache::request(const std::string& url, bool urgent) {
+    const bool queued = !inFlight.insert(url).second;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queued)
+        {
+            // Move urgent request to front if not already taken by worker
+            if (!urgent)
+            {
+                return;
+            }
+            auto it = std::find(requests.begin(), requests.end(), url);
+            if (it == requests.end())
+            {
+                return;
+            }
+            requests.erase(it);
+        }
+        if (urgent)
+        {
+            requests.push_front(url);
+        }
+        else
+        {
+            requests.push_back(url);
+        }
+    }
+    condition.notify_one();
+}
+
+/**
+* insert function
+* stores decoded image and drops least recently used images above budget
+* @param[in] url of image
+* @param[in] spImage decoded image
+*/
+void ImageCache::insert(const std::string& url, std::shared_ptr<const DecodedImage> spImage) {
+    if (images.find(url) != images.end())
+    {
+        return;
+    }
+    recentlyUsed.push_front(url);
+    images[url] = std::make_pair(spImage, recentlyUsed.begin());
+    cachedBytes += spImage->pixels.size();
+    while (cachedBytes > IMAGE_CACHE_MAX_BYTES && recentlyUsed.size() > 1)
+    {
+        auto it = images.find(recentlyUsed.back());
+        cachedBytes -= it->second.first->pixels.size();
+        images.erase(it);
+        recentlyUsed.pop_back();
+    }
+}
+
+/**
+* find function
+* looks up decoded image and marks it as recently used
+* @param[in] url of image
+* @param[out] decoded image or empty pointer
+*/
+std::shared_ptr<const DecodedImage> ImageCache::find(const std::string& url) {
+    auto it = images.find(url);
+    if (it == images.end())
+    {
+        return nullptr;
+    }
+    recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second.second);
+    return it->second.first;
+}
+
+/**
+* setPicture function
+* hands pixels to eyeGUI. Texture is named after layout and element, so each element reuses its
+* texture and elements with the same id in different layouts do not share one
+* @param[in] pLayout layout of element
+* @param[in] id of picture element
+* @param[in] rImage decoded image
+*/
+void ImageCache::setPicture(eyegui::Layout* pLayout, const std::string& id, const DecodedImage& rImage) {
+    eyegui::setImageOfPicture(
+        pLayout,
+        id,
+        "ImageCache_" + std::to_string((uintptr_t)pLayout) + "_" + id,
+        rImage.width,
+        rImage.height,
+        eyegui::ColorFormat::RGBA,
+        rImage.pixels.data(),
+        false);
+}
+
+/**
+* writeToBuffer function
+* appends downloaded bytes to buffer
+*/
+static size_t writeToBuffer(void *ptr, size_t size, size_t nmemb, std::vector<unsigned char>* pBuffer)
+{
+    unsigned char* pBytes = (unsigned char*)ptr;
+    pBuffer->insert(pBuffer->end(), pBytes, pBytes + size * nmemb);
+    return size * nmemb;
+}
+
+/**
+* fetch function
+* downloads image into memory and decodes it. Called by workers
+* @param[in] url of image
+* @param[out] decoded image or empty pointer on failure
+*/
+std::shared_ptr<DecodedImage> ImageCache::fetch(const std::string& url) {
+    // Download
+    std::vector<unsigned char> buffer;
+    CURL* curl = curl_easy_init();
+    if (!curl)
+    {
+        return nullptr;
+    }
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeToBuffer);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, IMAGE_CACHE_TIMEOUT);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // required for timeouts in threads
+    CURLcode result = curl_easy_perform(curl);
+    curl_easy_cleanup(curl);
+    if (result != CURLE_OK || buffer.empty())
+    {
+        std::cout << "ImageCache: Could not download " << url << std::endl;
+        return nullptr;
+    }
+
+    // Decode into RGBA, flipped like eyeGUI does when loading files (flag is set by constructor)
+    int width, height, channelCount;
+    unsigned char* pData = stbi_load_from_memory(buffer.data(), (int)buffer.size(), &width, &height, &channelCount, 4);
+    if (pData == NULL)
+    {
+        std::cout << "ImageCache: Could not decode " << url << std::endl;
+        return nullptr;
+    }
+    auto spImage = std::make_shared<DecodedImage>();
+    spImage->width = width;
+    spImage->height = height;
+    spImage->pixels.assign(pData, pData + (width * height * 4));
+    stbi_image_free(pData);
+    return spImage;
+}
@@ -0,0 +1,77 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#pragma once
+
+#include "externals/eyeGUI-development/include/eyeGUI.h"
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Decoded RGBA pixels of downloaded image, rows from bottom to top like eyeGUI loads files
+struct DecodedImage {
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+/**
+* Downloads and decodes images in background threads and keeps the decoded
+* pixels in memory, least recently used ones are dropped first. Pictures are
+* handed to eyeGUI as pixel data, so nothing is written to disk.
+*/
+class ImageCache {
+
+public:
+
+    static ImageCache* getInstance();
+    static void destroyInstance();
+    static void forgetLayout(eyegui::Layout const * pLayout);
+
+    void prefetch(std::string url);
+    void showInPicture(eyegui::Layout* pLayout, std::string id, std::string url);
+    void update();
+    static std::string toLargeProfileImage(std::string url);
+
+private:
+
+    ImageCache();
+    ~ImageCache();
+    void work();
+    void request(const std::string& url, bool urgent);
+    void insert(const std::string& url, std::shared_ptr<const DecodedImage> spImage);
+    std::shared_ptr<const DecodedImage> find(const std::string& url);
+    void setPicture(eyegui::Layout* pLayout, const std::string& id, const DecodedImage& rImage);
+    static std::shared_ptr<DecodedImage> fetch(const std::string& url);
+
+    static ImageCache* instance; // private cause of singleton-structure
+
+    // Shared with workers, guarded by mutex
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<std::string> requests;
+    std::vector<std::pair<std::string, std::shared_ptr<DecodedImage> > > finished;
+    bool shutdown = false;
+    double fetchTime = 0; // milliseconds spent downloading and decoding
+    int fetchCount = 0;
+
+    // Only used by main thread
+    std::set<std::string> inFlight;
+    std::list<std::string> recentlyUsed; // front is most recently used
+    std::unordered_map<std::string, std::pair<std::shared_ptr<const DecodedImage>, std::list<std::string>::iterator> > images;
+    size_t cachedBytes = 0;
+    std::map<std::pair<eyegui::Layout*, std::string>, std::string> waitingPictures; // picture element to url it waits for, layouts are removed by forgetLayout
+    int hitCount = 0;
+    int missCount = 0;
+};
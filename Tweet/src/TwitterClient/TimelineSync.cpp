@@ -0,0 +1,351 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#include "TimelineSync.h"
+#include "externals/twitCurl/include/rapidjson/reader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <unordered_set>
+
+// Seconds between two polls of the timeline
+static const int TIMELINE_SYNC_INTERVAL = 60;
+
+// Maximal seconds to wait after failed requests, e.g. when rate limit is exceeded
+static const int TIMELINE_SYNC_MAX_BACKOFF = 15 * 60;
+
+// Count of recent tweets kept
+static const size_t TIMELINE_SYNC_CAPACITY = 200;
+
+// Seconds until request is aborted, so shutdown never waits longer on worker thread
+static const long TIMELINE_SYNC_CONNECT_TIMEOUT = 10;
+static const long TIMELINE_SYNC_TIMEOUT = 30;
+
+// Error code of Twitter when rate limit is exceeded
+static const int TWITTER_RATE_LIMIT_ERROR = 88;
+
+/**
+* Handler for SAX parsing of timeline. Follows path of keys and writes only
+* fields of interest into tweets. Keys point into parsed buffer, so nothing is
+* copied except values of interest
+*/
+struct TimelineHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, TimelineHandler> {
+
+    TimelineHandler(TweetList& rTweets) : rTweets(rTweets) {}
+
+    // Path of open objects and arrays. Each is named after key it belongs to, elements of arrays by "#"
+    std::vector<const char*> path;
+    std::vector<bool> arrays; // whether open container is array
+    const char* key = "";
+    bool rootIsArray = false;
+    TweetList& rTweets;
+    int retweetedFavoriteCount = -1;
+    int errorCode = 0;
+
+    bool at(const char* a) const { return rootIsArray && path.size() == 2 && !strcmp(key, a); }
+    bool at(const char* a, const char* b) const { return rootIsArray && path.size() == 3 && !strcmp(path[2], a) && !strcmp(key, b); }
+
+    void open(bool isArray) {
+        path.push_back(key);
+        arrays.push_back(isArray);
+        key = isArray ? "#" : "";
+    }
+
+    void close() {
+        path.pop_back();
+        arrays.pop_back();
+        key = (!arrays.empty() && arrays.back()) ? "#" : "";
+    }
+
+    bool StartObject() {
+        if (rootIsArray && path.size() == 1)
+        {
+            rTweets.push_back(TweetEntry());
+            retweetedFavoriteCount = -1;
+        }
+        open(false);
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        close();
+        if (rootIsArray && path.size() == 1 && retweetedFavoriteCount >= 0)
+        {
+            rTweets.back().favoriteCount = retweetedFavoriteCount;
+        }
+        return true;
+    }
+
+    bool StartArray() {
+        if (path.empty())
+        {
+            rootIsArray = true;
+        }
+        open(true);
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        close();
+        return true;
+    }
+
+    bool Key(const char* str, rapidjson::SizeType, bool) {
+        key = str;
+        return true;
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        if (at("id_str")) { rTweets.back().id.assign(str, length); }
+        else if (at("text")) { rTweets.back().text.assign(str, length); }
+        else if (at("user", "id_str")) { rTweets.back().userId.assign(str, length); }
+        else if (at("user", "name")) { rTweets.back().userName.assign(str, length); }
+        else if (at("user", "profile_image_url")) { rTweets.back().profileImageUrl.assign(str, length); }
+        else if (path.size() == 5 && rootIsArray && !strcmp(path[2], "extended_entities") && !strcmp(path[3], "media") && !strcmp(key, "media_url"))
+        {
+            rTweets.back().mediaUrls.push_back(std::string(str, length));
+        }
+        return true;
+    }
+
+    bool Number(int64_t value) {
+        if (at("favorite_count")) { rTweets.back().favoriteCount = (int)value; }
+        else if (at("retweet_count")) { rTweets.back().retweetCount = (int)value; }
+        else if (at("retweeted_status", "favorite_count")) { retweetedFavoriteCount = (int)value; }
+        else if (!rootIsArray && path.size() == 3 && !strcmp(path[1], "errors") && !strcmp(key, "code")) { errorCode = (int)value; }
+        return true;
+    }
+
+    bool Int(int value) { return Number(value); }
+    bool Uint(unsigned value) { return Number(value); }
+    bool Int64(int64_t value) { return Number(value); }
+    bool Uint64(uint64_t value) { return Number((int64_t)value); }
+
+    bool Bool(bool value) {
+        if (at("favorited")) { rTweets.back().favorited = value; }
+        else if (at("retweeted")) { rTweets.back().retweeted = value; }
+        return true;
+    }
+};
+
+/**
+* isOlder function
+* compares ids of tweets, which are numbers too large for integers
+* @param[in] a id of first tweet
+* @param[in] b id of second tweet
+* @param[out] bool if first tweet is older
+*/
+static bool isOlder(const std::string& a, const std::string& b) {
+    return a.size() < b.size() || (a.size() == b.size() && a < b);
+}
+
+/**
+* Constructor for the TimelineSync Class
+* starts the worker thread, which syncs right away
+* @param[in] fetch function requesting the timeline
+*/
+TimelineSync::TimelineSync(FetchFunction fetch) : fetch(fetch) {
+    spTweets = std::make_shared<const TweetList>();
+    worker = std::thread(&TimelineSync::work, this);
+}
+
+/**
+* Destructor for the TimelineSync Class
+* waits for running request
+*/
+TimelineSync::~TimelineSync() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+    }
+    condition.notify_all();
+    worker.join();
+}
+
+/**
+* getTweets function
+* does not wait for running sync
+* @param[out] latest recent tweets, newest first
+*/
+std::shared_ptr<const TweetList> TimelineSync::getTweets() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return spTweets;
+}
+
+/**
+* requestSync function
+* lets worker sync now instead of waiting for next poll
+* @param[in] full if all recent tweets should be refreshed, e.g. after a tweet was liked
+*/
+void TimelineSync::requestSync(bool full) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        syncRequested = true;
+        fullRequested = fullRequested || full;
+    }
+    condition.notify_one();
+}
+
+/**
+* fetchHomeTimeline function
+* creates function which requests home timeline from Twitter
+* @param[in] spAccount account used only by worker, since twitCurl is not thread safe
+* @param[out] function to pass to constructor
+*/
+TimelineSync::FetchFunction TimelineSync::fetchHomeTimeline(std::shared_ptr<twitCurl> spAccount) {
+    return [spAccount](const std::string& sinceId, std::string& rResponse) {
+        if (!spAccount->timelineHomeGet(sinceId))
+        {
+            spAccount->getLastCurlError(rResponse);
+            return false;
+        }
+        spAccount->getLastWebResponse(rResponse);
+        return true;
+    };
+}
+
+/**
+* writeToString function
+* appends downloaded bytes to string
+*/
+static size_t writeToString(void *ptr, size_t size, size_t nmemb, std::string* pString)
+{
+    pString->append((char*)ptr, size * nmemb);
+    return size * nmemb;
+}
+
+/**
+* fetchFromUrl function
+* creates function which requests timeline from given url instead of Twitter,
+* e.g. from a local server answering with recorded responses
+* @param[in] url without parameters, since_id is appended
+* @param[out] function to pass to constructor
+*/
+TimelineSync::FetchFunction TimelineSync::fetchFromUrl(std::string url) {
+    return [url](const std::string& sinceId, std::string& rResponse) {
+        CURL* curl = curl_easy_init();
+        if (!curl)
+        {
+            return false;
+        }
+        std::string requestUrl = sinceId.empty() ? url : url + "?since_id=" + sinceId;
+        curl_easy_setopt(curl, CURLOPT_URL, requestUrl.c_str());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeToString);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &rResponse);
+        curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, TIMELINE_SYNC_CONNECT_TIMEOUT);
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, TIMELINE_SYNC_TIMEOUT);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // required for timeouts in threads
+        CURLcode result = curl_easy_perform(curl);
+        curl_easy_cleanup(curl);
+        return result == CURLE_OK;
+    };
+}
+
+/**
+* parseTimeline function
+* parses response in-situ, so response is destroyed
+* @param[in] rResponse timeline as JSON
+* @param[out] rTweets tweets of response are appended
+* @param[out] rErrorCode error code of Twitter or 0
+* @param[out] bool if response was a timeline
+*/
+bool TimelineSync::parseTimeline(std::string& rResponse, TweetList& rTweets, int& rErrorCode) {
+    TimelineHandler handler(rTweets);
+    rapidjson::InsituStringStream stream(&rResponse[0]);
+    rapidjson::Reader reader;
+    reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+    rErrorCode = handler.errorCode;
+    return !reader.HasParseError() && handler.rootIsArray;
+}
+
+/**
+* merge function
+* puts newer tweets in front of older ones. Older tweets which are newer than
+* the oldest of the newer tweets were not returned again, so they are dropped
+* as deleted. Tweets contained in both are taken from the newer ones
+* @param[in] rNewer tweets of latest response, newest first
+* @param[in] rOlder tweets known before, newest first
+* @param[in] capacity count of tweets kept
+* @param[out] merged tweets, newest first
+*/
+TweetList TimelineSync::merge(const TweetList& rNewer, const TweetList& rOlder, size_t capacity) {
+    TweetList merged(rNewer.begin(), rNewer.begin() + std::min(rNewer.size(), capacity));
+    std::unordered_set<std::string> ids;
+    for (const auto& rTweet : merged)
+    {
+        ids.insert(rTweet.id);
+    }
+    for (const auto& rTweet : rOlder)
+    {
+        if (merged.size() >= capacity)
+        {
+            break;
+        }
+        if (ids.find(rTweet.id) == ids.end() && (rNewer.empty() || isOlder(rTweet.id, rNewer.back().id)))
+        {
+            merged.push_back(rTweet);
+        }
+    }
+    return merged;
+}
+
+/**
+* work function
+* loop of worker thread. Polls for new tweets and backs off when requests fail
+*/
+void TimelineSync::work() {
+    int wait = 0;
+    int backoff = 0;
+    while (true)
+    {
+        bool full;
+        std::shared_ptr<const TweetList> spCurrent;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait_for(lock, std::chrono::seconds(wait), [this] { return shutdown || syncRequested; });
+            if (shutdown)
+            {
+                return;
+            }
+            full = fullRequested;
+            syncRequested = false;
+            fullRequested = false;
+            spCurrent = spTweets;
+        }
+
+        // Request only tweets newer than the newest one known
+        std::string sinceId = (full || spCurrent->empty()) ? "" : spCurrent->front().id;
+        auto start = std::chrono::steady_clock::now();
+        std::string response;
+        TweetList received;
+        int errorCode = 0;
+        if (!fetch(sinceId, response) || !parseTimeline(response, received, errorCode))
+        {
+            // Full sync has not happened, so do it with next request
+            if (full)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                fullRequested = true;
+            }
+            backoff = std::min(std::max(backoff * 2, TIMELINE_SYNC_INTERVAL), TIMELINE_SYNC_MAX_BACKOFF);
+            wait = backoff;
+            std::cout << "TimelineSync: " << (errorCode == TWITTER_RATE_LIMIT_ERROR ? "Rate limit exceeded" : "Request failed")
+                << ", retry in " << backoff << "s" << std::endl;
+            continue;
+        }
+        backoff = 0;
+        wait = TIMELINE_SYNC_INTERVAL;
+
+        if (!received.empty())
+        {
+            auto spMerged = std::make_shared<const TweetList>(merge(received, *spCurrent, TIMELINE_SYNC_CAPACITY));
+            std::lock_guard<std::mutex> lock(mutex);
+            spTweets = spMerged;
+        }
+        std::cout << "TimelineSync: Received " << received.size() << " tweets in "
+            << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << "ms" << std::endl;
+    }
+}
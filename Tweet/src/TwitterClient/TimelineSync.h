@@ -0,0 +1,69 @@
+//============================================================================
+// Distributed under the Apache License, Version 2.0.
+//============================================================================
+
+#pragma once
+
+#include "externals/twitCurl/twitcurl.h"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compact tweet with the fields shown by the interface
+struct TweetEntry {
+    std::string id;
+    std::string userId;
+    std::string userName;
+    std::string profileImageUrl;
+    std::string text;
+    int favoriteCount = 0; // of original tweet if this is a retweet
+    int retweetCount = 0;
+    bool favorited = false;
+    bool retweeted = false;
+    std::vector<std::string> mediaUrls;
+};
+
+// Recent tweets, newest first. Never changed after it has been handed out
+typedef std::vector<TweetEntry> TweetList;
+
+/**
+* Keeps the home timeline up to date in a background thread. Only tweets
+* newer than the newest known one are requested, unless a full refresh is
+* requested. Responses are parsed in-situ with a SAX handler directly into
+* compact tweets. The interface reads the latest list without waiting.
+*/
+class TimelineSync {
+
+public:
+
+    // Requests timeline since given id and writes response. Returns false if request failed
+    typedef std::function<bool(const std::string& sinceId, std::string& rResponse)> FetchFunction;
+
+    TimelineSync(FetchFunction fetch);
+    ~TimelineSync();
+
+    std::shared_ptr<const TweetList> getTweets();
+    void requestSync(bool full);
+
+    static FetchFunction fetchHomeTimeline(std::shared_ptr<twitCurl> spAccount);
+    static FetchFunction fetchFromUrl(std::string url);
+    static bool parseTimeline(std::string& rResponse, TweetList& rTweets, int& rErrorCode);
+    static TweetList merge(const TweetList& rNewer, const TweetList& rOlder, size_t capacity);
+
+private:
+
+    void work();
+
+    FetchFunction fetch;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::shared_ptr<const TweetList> spTweets; // guarded by mutex
+    bool syncRequested = true; // guarded by mutex
+    bool fullRequested = true; // guarded by mutex
+    bool shutdown = false; // guarded by mutex
+};
@@ -8,6 +8,7 @@
 #include "src/TwitterApp.h"
 #include "src/LoginArea/Login.h"
 #include "src/TwitterClient/ImageDownload.h"
+#include "src/TwitterClient/ImageCache.h"
 #include "src/Input.h"
 #include "src/Framebuffer.h"
 #include <iostream>
@@ -224,6 +225,12 @@ int main(int argc, char* argv[]) {
 		input.gazeX = (int)((float)input.gazeX * (1280.f / (float)resX));
 		input.gazeY = (int)((float)input.gazeY * (800.f / (float)resY));
 
+        // Show images which have been downloaded in background
+        ImageCache::getInstance()->update();
+
+        // Show tweets which have been synced in background
+        login->application->update();
+
         // Render GUI into framebuffer
 		framebuffer.Bind();
         eyegui::Input usedInput = eyegui::updateGUI(login->application->getGUI(), deltaTime, input);
@@ -244,6 +251,9 @@ int main(int argc, char* argv[]) {
 
     input_disconnect();
 
+    // Stop image downloads
+    ImageCache::destroyInstance();
+
     // Delete tmp image folder
     remove_folder(CONTENT_PATH + std::string("/img/tmp"));
 